@@ -0,0 +1,56 @@
+#include "tachyon/base/cpu.h"
+
+#include <stdint.h>
+
+#include "tachyon/build/build_config.h"
+
+#if ARCH_CPU_X86_FAMILY
+#include <cpuid.h>
+#endif
+
+namespace tachyon::base {
+
+#if ARCH_CPU_X86_FAMILY
+namespace {
+
+uint64_t GetXCR0() {
+  uint32_t eax, edx;
+  asm("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (uint64_t{edx} << 32) | eax;
+}
+
+}  // namespace
+#endif
+
+// static
+const CPU& CPU::GetInstance() {
+  static CPU cpu;
+  return cpu;
+}
+
+CPU::CPU() {
+#if ARCH_CPU_X86_FAMILY
+  unsigned int eax, ebx, ecx, edx;
+  bool os_saves_avx_state = false;
+  bool os_saves_avx512_state = false;
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 27)) != 0) {
+    // XCR0 must have the SSE and AVX state bits set for AVX and additionally
+    // the opmask, ZMM_Hi256 and Hi16_ZMM state bits set for AVX-512. The
+    // OSXSAVE bit checked above tells that XGETBV can be used.
+    uint64_t xcr0 = GetXCR0();
+    os_saves_avx_state = (xcr0 & 0x6) == 0x6;
+    os_saves_avx512_state = (xcr0 & 0xe6) == 0xe6;
+  }
+  // See "Structured Extended Feature Flags Enumeration Leaf" in the Intel® 64
+  // and IA-32 Architectures Software Developer’s Manual.
+  if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    has_bmi2_ = (ebx & (1u << 8)) != 0;
+    has_adx_ = (ebx & (1u << 19)) != 0;
+    has_avx2_ = os_saves_avx_state && (ebx & (1u << 5)) != 0;
+    has_avx512f_ = os_saves_avx512_state && (ebx & (1u << 16)) != 0;
+    has_avx512ifma_ = has_avx512f_ && (ebx & (1u << 21)) != 0;
+  }
+#endif
+}
+
+}  // namespace tachyon::base
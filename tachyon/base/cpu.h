@@ -0,0 +1,34 @@
+#ifndef TACHYON_BASE_CPU_H_
+#define TACHYON_BASE_CPU_H_
+
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |CPU| queries the features of the processor the binary is running on.
+class TACHYON_EXPORT CPU {
+ public:
+  static const CPU& GetInstance();
+
+  // BMI2 provides MULX.
+  bool has_bmi2() const { return has_bmi2_; }
+  // ADX provides ADCX and ADOX.
+  bool has_adx() const { return has_adx_; }
+  // These are false if the OS doesn't save the AVX or AVX-512 registers.
+  bool has_avx2() const { return has_avx2_; }
+  bool has_avx512f() const { return has_avx512f_; }
+  bool has_avx512ifma() const { return has_avx512ifma_; }
+
+ private:
+  CPU();
+
+  bool has_bmi2_ = false;
+  bool has_adx_ = false;
+  bool has_avx2_ = false;
+  bool has_avx512f_ = false;
+  bool has_avx512ifma_ = false;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_CPU_H_
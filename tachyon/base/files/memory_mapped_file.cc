@@ -0,0 +1,48 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <utility>
+
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::base {
+
+MemoryMappedFile::~MemoryMappedFile() { CloseHandles(); }
+
+bool MemoryMappedFile::Initialize(const FilePath& file_name) {
+  if (IsValid()) return false;
+
+  file_ = File(file_name, File::FLAG_OPEN | File::FLAG_READ);
+  if (!file_.IsValid()) {
+    LOG(ERROR) << "Couldn't open " << file_name.value();
+    return false;
+  }
+
+  if (!MapFileToMemory()) {
+    CloseHandles();
+    return false;
+  }
+  return true;
+}
+
+bool MemoryMappedFile::Initialize(File file) {
+  if (IsValid()) return false;
+
+  file_ = std::move(file);
+
+  if (!MapFileToMemory()) {
+    CloseHandles();
+    return false;
+  }
+  return true;
+}
+
+bool MemoryMappedFile::IsValid() const {
+  return data_ != nullptr || (file_.IsValid() && length_ == 0);
+}
+
+}  // namespace tachyon::base
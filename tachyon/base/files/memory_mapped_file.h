@@ -0,0 +1,62 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
+#define TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/export.h"
+#include "tachyon/base/files/file.h"
+
+namespace tachyon::base {
+
+class TACHYON_EXPORT MemoryMappedFile {
+ public:
+  // The default constructor sets all members to invalid/null values.
+  MemoryMappedFile();
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+  ~MemoryMappedFile();
+
+  // Opens an existing file and maps it into memory. Access is restricted to
+  // read only. If this object already points to a valid memory mapped file
+  // then this method will fail and return false. If it cannot open the file,
+  // the file does not exist, or the memory mapping fails, it will return
+  // false.
+  [[nodiscard]] bool Initialize(const FilePath& file_name);
+
+  // As above, but works with an already-opened file. MemoryMappedFile takes
+  // ownership of |file| and closes it when done. |file| must have been opened
+  // with at least read permissions.
+  [[nodiscard]] bool Initialize(File file);
+
+  const uint8_t* data() const { return data_; }
+  size_t length() const { return length_; }
+
+  absl::Span<const uint8_t> bytes() const { return {data_, length_}; }
+
+  // Is file_ a valid file handle that points to an open, memory mapped file?
+  bool IsValid() const;
+
+ private:
+  // Map the file to memory, set data_ to that memory address. Return true on
+  // success, false on any kind of failure. This is a helper for
+  // Initialize().
+  bool MapFileToMemory();
+
+  // Closes all open handles.
+  void CloseHandles();
+
+  File file_;
+  uint8_t* data_ = nullptr;
+  size_t length_ = 0;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
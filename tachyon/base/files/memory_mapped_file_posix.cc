@@ -0,0 +1,53 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <sys/mman.h>
+
+#include <limits>
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::base {
+
+MemoryMappedFile::MemoryMappedFile() = default;
+
+bool MemoryMappedFile::MapFileToMemory() {
+  int64_t file_len = file_.GetLength();
+  if (file_len < 0) {
+    DPLOG(ERROR) << "fstat " << file_.GetPlatformFile();
+    return false;
+  }
+  if (static_cast<uint64_t>(file_len) > std::numeric_limits<size_t>::max()) {
+    LOG(ERROR) << "File is too large to map";
+    return false;
+  }
+  length_ = static_cast<size_t>(file_len);
+  // NOTE(chokobole): mmap() fails with a zero length, so an empty file is
+  // treated as a valid mapping without any data.
+  if (length_ == 0) return true;
+
+  void* data = mmap(nullptr, length_, PROT_READ, MAP_SHARED,
+                    file_.GetPlatformFile(), 0);
+  if (data == MAP_FAILED) {
+    DPLOG(ERROR) << "mmap " << file_.GetPlatformFile();
+    length_ = 0;
+    return false;
+  }
+  data_ = static_cast<uint8_t*>(data);
+  return true;
+}
+
+void MemoryMappedFile::CloseHandles() {
+  if (data_ != nullptr) {
+    munmap(data_, length_);
+  }
+  file_.Close();
+
+  data_ = nullptr;
+  length_ = 0;
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,85 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::base {
+
+namespace {
+
+std::vector<uint8_t> CreateTestData(size_t size) {
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<uint8_t>(i * 7 + 3);
+  }
+  return data;
+}
+
+class MemoryMappedFileTest : public testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    file_path_ = temp_dir_.GetPath().Append("mapped_file");
+  }
+
+ protected:
+  ScopedTempDir temp_dir_;
+  FilePath file_path_;
+};
+
+}  // namespace
+
+TEST_F(MemoryMappedFileTest, MapWholeFile) {
+  std::vector<uint8_t> data = CreateTestData(5000);
+  ASSERT_TRUE(WriteFile(file_path_, data));
+
+  MemoryMappedFile map;
+  ASSERT_TRUE(map.Initialize(file_path_));
+  ASSERT_TRUE(map.IsValid());
+  ASSERT_EQ(map.length(), data.size());
+  EXPECT_EQ(std::vector<uint8_t>(map.bytes().begin(), map.bytes().end()),
+            data);
+
+  // It fails if it is already initialized.
+  EXPECT_FALSE(map.Initialize(file_path_));
+}
+
+TEST_F(MemoryMappedFileTest, MapOpenedFile) {
+  std::vector<uint8_t> data = CreateTestData(100);
+  ASSERT_TRUE(WriteFile(file_path_, data));
+
+  MemoryMappedFile map;
+  ASSERT_TRUE(map.Initialize(File(file_path_, File::FLAG_OPEN |
+                                                   File::FLAG_READ)));
+  ASSERT_EQ(map.length(), data.size());
+  EXPECT_EQ(std::vector<uint8_t>(map.bytes().begin(), map.bytes().end()),
+            data);
+}
+
+TEST_F(MemoryMappedFileTest, MapEmptyFile) {
+  ASSERT_TRUE(WriteFile(file_path_, absl::Span<const uint8_t>()));
+
+  MemoryMappedFile map;
+  ASSERT_TRUE(map.Initialize(file_path_));
+  EXPECT_TRUE(map.IsValid());
+  EXPECT_EQ(map.length(), size_t{0});
+}
+
+TEST_F(MemoryMappedFileTest, MapNonExistentFile) {
+  MemoryMappedFile map;
+  EXPECT_FALSE(map.Initialize(file_path_));
+  EXPECT_FALSE(map.IsValid());
+}
+
+}  // namespace tachyon::base
@@ -16,16 +16,21 @@
 
 namespace tachyon::base {
 
+// Returns the maximum number of threads used by a parallel region.
+inline size_t GetNumThreads() {
+#if defined(TACHYON_HAS_OPENMP)
+  return static_cast<size_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif
+}
+
 // NOTE(chokobole): This function might return 0. You should handle this case
 // carefully. See other examples where it is used.
 template <typename Container>
 size_t GetNumElementsPerThread(const Container& container,
                                std::optional<size_t> threshold = std::nullopt) {
-#if defined(TACHYON_HAS_OPENMP)
-  size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-#else
-  size_t thread_nums = 1;
-#endif
+  size_t thread_nums = GetNumThreads();
   size_t size = std::size(container);
   return (threshold.has_value() && size > threshold.value())
              ? (size + thread_nums - 1) / thread_nums
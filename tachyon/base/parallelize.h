@@ -1,6 +1,8 @@
 #ifndef TACHYON_BASE_PARALLELIZE_H_
 #define TACHYON_BASE_PARALLELIZE_H_
 
+#include <algorithm>
+#include <functional>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -9,6 +11,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/functional/functor_traits.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/base/threading/parallel_for.h"
 
 namespace tachyon::base {
 
@@ -19,6 +22,22 @@ using ParallelizeCallback2 = std::function<void(absl::Span<T>, size_t)>;
 template <typename T>
 using ParallelizeCallback3 = std::function<void(absl::Span<T>, size_t, size_t)>;
 
+namespace internal {
+
+// Same as |GetNumElementsPerThread()|, but the number of threads is the one of
+// |ThreadPool::Current()|.
+template <typename Container>
+size_t GetNumElementsPerPoolThread(const Container& container,
+                                   std::optional<size_t> threshold) {
+  size_t thread_nums = ThreadPool::Current()->num_threads();
+  size_t size = std::size(container);
+  return (threshold.has_value() && size > threshold.value())
+             ? (size + thread_nums - 1) / thread_nums
+             : size;
+}
+
+}  // namespace internal
+
 // Splits the |container| by |chunk_size| and executes |callback| in parallel.
 // See parallelize_unittest.cc for more details.
 template <typename Container, typename Callable,
@@ -36,7 +55,7 @@ void ParallelizeByChunkSize(Container& container, size_t chunk_size,
   std::vector<SpanTy> chunks =
       base::Map(chunked_adapter.begin(), chunked_adapter.end(),
                 [](SpanTy chunk) { return chunk; });
-  OPENMP_PARALLEL_FOR(size_t i = 0; i < chunks.size(); ++i) {
+  ParallelFor(0, chunks.size(), [&chunks, &callback, chunk_size](size_t i) {
     if constexpr (ArgNum == 1) {
       callback(chunks[i]);
     } else if constexpr (ArgNum == 2) {
@@ -45,7 +64,7 @@ void ParallelizeByChunkSize(Container& container, size_t chunk_size,
       static_assert(ArgNum == 3);
       callback(chunks[i], i, chunk_size);
     }
-  }
+  });
 }
 
 // Splits the |container| into threads and executes |callback| in parallel.
@@ -54,7 +73,7 @@ template <typename Container, typename Callable>
 void Parallelize(Container& container, Callable callback,
                  std::optional<size_t> threshold = std::nullopt) {
   size_t num_elements_per_thread =
-      GetNumElementsPerThread(container, threshold);
+      internal::GetNumElementsPerPoolThread(container, threshold);
   ParallelizeByChunkSize(container, num_elements_per_thread,
                          std::move(callback));
 }
@@ -82,16 +101,17 @@ std::vector<ReturnType> ParallelizeMapByChunkSize(Container& container,
                 [](SpanTy chunk) { return chunk; });
   std::vector<ReturnType> values;
   values.resize(chunks.size());
-  OPENMP_PARALLEL_FOR(size_t i = 0; i < chunks.size(); ++i) {
-    if constexpr (ArgNum == 1) {
-      values[i] = callback(chunks[i]);
-    } else if constexpr (ArgNum == 2) {
-      values[i] = callback(chunks[i], i);
-    } else {
-      static_assert(ArgNum == 3);
-      values[i] = callback(chunks[i], i, chunk_size);
-    }
-  }
+  ParallelFor(0, chunks.size(),
+              [&chunks, &callback, &values, chunk_size](size_t i) {
+                if constexpr (ArgNum == 1) {
+                  values[i] = callback(chunks[i]);
+                } else if constexpr (ArgNum == 2) {
+                  values[i] = callback(chunks[i], i);
+                } else {
+                  static_assert(ArgNum == 3);
+                  values[i] = callback(chunks[i], i, chunk_size);
+                }
+              });
   return values;
 }
 
@@ -103,11 +123,40 @@ template <typename Container, typename Callable>
 auto ParallelizeMap(Container& container, Callable callback,
                     std::optional<size_t> threshold = std::nullopt) {
   size_t num_elements_per_thread =
-      GetNumElementsPerThread(container, threshold);
+      internal::GetNumElementsPerPoolThread(container, threshold);
   return ParallelizeMapByChunkSize(container, num_elements_per_thread,
                                    std::move(callback));
 }
 
+// Sorts the |container| in parallel. The |container| is split into threads,
+// each chunk is sorted and then the sorted chunks are merged pairwise.
+// See parallelize_unittest.cc for more details.
+template <typename Container, typename Compare = std::less<>>
+void ParallelSort(Container& container, Compare compare = Compare(),
+                  std::optional<size_t> threshold = std::nullopt) {
+  size_t size = std::size(container);
+  size_t chunk_size =
+      internal::GetNumElementsPerPoolThread(container, threshold);
+  if (chunk_size == 0) return;
+  auto first = std::begin(container);
+  size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+  ParallelFor(0, num_chunks, [first, size, chunk_size, &compare](size_t i) {
+    size_t start = i * chunk_size;
+    size_t end = std::min(start + chunk_size, size);
+    std::sort(first + start, first + end, compare);
+  });
+  for (size_t width = chunk_size; width < size; width *= 2) {
+    size_t num_merges = (size + 2 * width - 1) / (2 * width);
+    ParallelFor(0, num_merges, [first, size, width, &compare](size_t i) {
+      size_t start = i * 2 * width;
+      size_t mid = std::min(start + width, size);
+      size_t end = std::min(mid + width, size);
+      if (mid == end) return;
+      std::inplace_merge(first + start, first + mid, first + end, compare);
+    });
+  }
+}
+
 }  // namespace tachyon::base
 
 #endif  // TACHYON_BASE_PARALLELIZE_H_
@@ -1,10 +1,13 @@
 #include "tachyon/base/parallelize.h"
 
+#include <algorithm>
 #include <functional>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "tachyon/base/random.h"
+
 namespace tachyon::base {
 
 namespace {
@@ -102,4 +105,22 @@ TEST(ParallelizeTest, ParallelizeMap) {
             15);
 }
 
+TEST(ParallelizeTest, ParallelSort) {
+  for (size_t size : {0, 1, 7, 1000}) {
+    std::vector<int> test_in = base::CreateVector(
+        size, []() { return base::Uniform(base::Range<int>::Until(100)); });
+
+    std::vector<int> expected = test_in;
+    std::sort(expected.begin(), expected.end());
+    std::vector<int> values = test_in;
+    ParallelSort(values, std::less<>(), /*threshold=*/10);
+    EXPECT_EQ(values, expected);
+
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    values = test_in;
+    ParallelSort(values, std::greater<>(), /*threshold=*/10);
+    EXPECT_EQ(values, expected);
+  }
+}
+
 }  // namespace tachyon::base
@@ -0,0 +1,62 @@
+#include "tachyon/base/task_graph.h"
+
+#include <atomic>
+#include <utility>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/task_group.h"
+
+namespace tachyon::base {
+
+namespace {
+
+template <typename Node>
+void SpawnTask(TaskGroup& group, std::vector<Node>& nodes,
+               std::vector<std::atomic<size_t>>& num_remaining_dependencies,
+               size_t id) {
+  group.Run([&group, &nodes, &num_remaining_dependencies, id]() {
+    nodes[id].task();
+    for (size_t dependent : nodes[id].dependents) {
+      // NOTE(chokobole): Only the last finished dependency sees 1 here, so
+      // each task is spawned exactly once.
+      if (num_remaining_dependencies[dependent].fetch_sub(
+              1, std::memory_order_acq_rel) == 1) {
+        SpawnTask(group, nodes, num_remaining_dependencies, dependent);
+      }
+    }
+  });
+}
+
+}  // namespace
+
+TaskGraph::TaskId TaskGraph::AddTask(std::function<void()> task,
+                                     const std::vector<TaskId>& dependencies) {
+  TaskId id = nodes_.size();
+  for (TaskId dependency : dependencies) {
+    CHECK_LT(dependency, id);
+    nodes_[dependency].dependents.push_back(id);
+  }
+  nodes_.push_back({std::move(task), {}, dependencies.size()});
+  return id;
+}
+
+void TaskGraph::Run(ThreadPool* pool) {
+  std::vector<std::atomic<size_t>> num_remaining_dependencies(nodes_.size());
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    num_remaining_dependencies[i].store(nodes_[i].num_dependencies,
+                                        std::memory_order_relaxed);
+  }
+  // NOTE(chokobole): A task spawns its dependents before it is marked as done,
+  // so |Wait()| returns only after all the tasks including the ones spawned by
+  // other tasks are done.
+  TaskGroup group(pool);
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    if (nodes_[i].num_dependencies == 0) {
+      SpawnTask(group, nodes_, num_remaining_dependencies, i);
+    }
+  }
+  group.Wait();
+  nodes_.clear();
+}
+
+}  // namespace tachyon::base
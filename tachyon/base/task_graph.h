@@ -0,0 +1,68 @@
+#ifndef TACHYON_BASE_TASK_GRAPH_H_
+#define TACHYON_BASE_TASK_GRAPH_H_
+
+#include <stddef.h>
+
+#include <functional>
+#include <vector>
+
+#include "tachyon/base/threading/thread_pool.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |TaskGraph| runs a set of tasks, where each task starts as soon as all the
+// tasks it depends on are done. This lets independent work, such as an MSM of
+// a column and an FFT of another column, overlap instead of running phase by
+// phase.
+//
+// A task may only depend on the tasks added before it. Hence, the order of
+// |AddTask()| is always a valid sequential order. Any state that must be
+// updated in a fixed order, such as a transcript or a random number
+// generator, has to be guarded by chaining the tasks touching it. For example:
+//
+//   TaskGraph graph;
+//   TaskGraph::TaskId a = graph.AddTask([]() { ... });
+//   TaskGraph::TaskId b = graph.AddTask([]() { ... });
+//   // |c| starts after both |a| and |b| are done.
+//   graph.AddTask([]() { ... }, {a, b});
+//   graph.Run();
+//
+// The tasks run on a |ThreadPool| through a |TaskGroup|, so a task can run a
+// |ParallelFor()| of its own and the idle threads pick up its chunks as well
+// as the other tasks of the graph.
+class TACHYON_EXPORT TaskGraph {
+ public:
+  using TaskId = size_t;
+
+  TaskGraph() = default;
+  TaskGraph(const TaskGraph& other) = delete;
+  TaskGraph& operator=(const TaskGraph& other) = delete;
+
+  size_t size() const { return nodes_.size(); }
+  bool empty() const { return nodes_.empty(); }
+
+  // Adds |task| which runs after all the tasks in |dependencies| are done and
+  // returns its id. Every id in |dependencies| must be the one returned from
+  // the previous |AddTask()|.
+  TaskId AddTask(std::function<void()> task,
+                 const std::vector<TaskId>& dependencies = {});
+
+  // Runs all the tasks on |pool| and blocks until they are done. The tasks
+  // are cleared after the run.
+  void Run(ThreadPool* pool = ThreadPool::Current());
+
+ private:
+  struct Node {
+    std::function<void()> task;
+    // The ids of the tasks that depend on this task.
+    std::vector<TaskId> dependents;
+    size_t num_dependencies = 0;
+  };
+
+  std::vector<Node> nodes_;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_TASK_GRAPH_H_
@@ -0,0 +1,94 @@
+#include "tachyon/base/task_graph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(TaskGraphTest, Empty) {
+  TaskGraph graph;
+  EXPECT_TRUE(graph.empty());
+  graph.Run();
+  EXPECT_TRUE(graph.empty());
+}
+
+TEST(TaskGraphTest, RunIndependentTasks) {
+  constexpr size_t kNumTasks = 100;
+
+  TaskGraph graph;
+  std::vector<int> values(kNumTasks, 0);
+  for (size_t i = 0; i < kNumTasks; ++i) {
+    graph.AddTask([&values, i]() { values[i] = static_cast<int>(i); });
+  }
+  EXPECT_EQ(graph.size(), kNumTasks);
+  graph.Run();
+  EXPECT_TRUE(graph.empty());
+  for (size_t i = 0; i < kNumTasks; ++i) {
+    EXPECT_EQ(values[i], static_cast<int>(i));
+  }
+}
+
+TEST(TaskGraphTest, RunAfterDependencies) {
+  // a   b
+  //  \ / \
+  //   c   d
+  //    \ /
+  //     e
+  TaskGraph graph;
+  std::mutex mutex;
+  std::vector<char> order;
+  auto record = [&mutex, &order](char c) {
+    return [&mutex, &order, c]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(c);
+    };
+  };
+  TaskGraph::TaskId a = graph.AddTask(record('a'));
+  TaskGraph::TaskId b = graph.AddTask(record('b'));
+  TaskGraph::TaskId c = graph.AddTask(record('c'), {a, b});
+  TaskGraph::TaskId d = graph.AddTask(record('d'), {b});
+  graph.AddTask(record('e'), {c, d});
+  graph.Run();
+
+  ASSERT_EQ(order.size(), size_t{5});
+  auto position = [&order](char c) {
+    return std::find(order.begin(), order.end(), c) - order.begin();
+  };
+  EXPECT_LT(position('a'), position('c'));
+  EXPECT_LT(position('b'), position('c'));
+  EXPECT_LT(position('b'), position('d'));
+  EXPECT_LT(position('c'), position('e'));
+  EXPECT_LT(position('d'), position('e'));
+}
+
+TEST(TaskGraphTest, ChainKeepsOrder) {
+  constexpr size_t kNumTasks = 64;
+
+  // Each task of the chain depends on an independent task as well as on the
+  // previous one in the chain, which is how a transcript write is ordered.
+  TaskGraph graph;
+  std::atomic<size_t> num_independent_tasks_done = 0;
+  std::vector<size_t> order;
+  std::optional<TaskGraph::TaskId> prev;
+  for (size_t i = 0; i < kNumTasks; ++i) {
+    TaskGraph::TaskId work = graph.AddTask(
+        [&num_independent_tasks_done]() { ++num_independent_tasks_done; });
+    std::vector<TaskGraph::TaskId> dependencies = {work};
+    if (prev.has_value()) dependencies.push_back(prev.value());
+    prev = graph.AddTask([&order, i]() { order.push_back(i); }, dependencies);
+  }
+  graph.Run();
+
+  EXPECT_EQ(num_independent_tasks_done, kNumTasks);
+  ASSERT_EQ(order.size(), kNumTasks);
+  for (size_t i = 0; i < kNumTasks; ++i) {
+    EXPECT_EQ(order[i], i);
+  }
+}
+
+}  // namespace tachyon::base
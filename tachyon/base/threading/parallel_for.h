@@ -0,0 +1,105 @@
+#ifndef TACHYON_BASE_THREADING_PARALLEL_FOR_H_
+#define TACHYON_BASE_THREADING_PARALLEL_FOR_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/threading/task_group.h"
+#include "tachyon/base/threading/thread_pool.h"
+
+namespace tachyon::base {
+
+namespace internal {
+
+// The range is split into at most this many chunks per thread, so that the
+// idle threads have something to steal when the chunks are uneven.
+constexpr size_t kNumChunksPerThread = 4;
+
+// Returns the size of the chunks that split [|begin|, |end|) on |pool|, which
+// is at least |grain_size|.
+inline size_t ComputeChunkSize(size_t begin, size_t end, size_t grain_size,
+                               const ThreadPool* pool) {
+  size_t size = end - begin;
+  size_t max_num_chunks = pool->num_threads() * kNumChunksPerThread;
+  size_t chunk_size = (size + max_num_chunks - 1) / max_num_chunks;
+  return std::max(chunk_size, std::max(grain_size, size_t{1}));
+}
+
+}  // namespace internal
+
+// Runs |callback(chunk_begin, chunk_end)| over the chunks of [|begin|, |end|)
+// in parallel, where each chunk has at least |grain_size| elements except for
+// the last one. It can be called inside another parallel loop.
+template <typename Callable>
+void ParallelForChunks(size_t begin, size_t end, Callable callback,
+                       size_t grain_size = 1,
+                       ThreadPool* pool = ThreadPool::Current()) {
+  if (begin >= end) return;
+  size_t chunk_size =
+      internal::ComputeChunkSize(begin, end, grain_size, pool);
+  if (pool->num_threads() == 1 || end - begin <= chunk_size) {
+    callback(begin, end);
+    return;
+  }
+  TaskGroup group(pool);
+  // NOTE(chokobole): The first chunk is left for the calling thread.
+  for (size_t i = begin + chunk_size; i < end; i += chunk_size) {
+    size_t chunk_end = std::min(i + chunk_size, end);
+    group.Run([&callback, i, chunk_end]() { callback(i, chunk_end); });
+  }
+  callback(begin, begin + chunk_size);
+  group.Wait();
+}
+
+// Runs |callback(i)| for every i in [|begin|, |end|) in parallel. See
+// |ParallelForChunks()|.
+template <typename Callable>
+void ParallelFor(size_t begin, size_t end, Callable callback,
+                 size_t grain_size = 1,
+                 ThreadPool* pool = ThreadPool::Current()) {
+  ParallelForChunks(
+      begin, end,
+      [&callback](size_t chunk_begin, size_t chunk_end) {
+        for (size_t i = chunk_begin; i < chunk_end; ++i) {
+          callback(i);
+        }
+      },
+      grain_size, pool);
+}
+
+// Returns |reduce(...reduce(reduce(identity, map(begin)), map(begin + 1))...,
+// map(end - 1))|, where the calls to |map| run in parallel. The partial
+// results of the chunks are reduced in order, so |reduce| only needs to be
+// associative and the result doesn't depend on the number of threads.
+template <typename T, typename Map, typename Reduce>
+T ParallelReduce(size_t begin, size_t end, const T& identity, Map map,
+                 Reduce reduce, size_t grain_size = 1,
+                 ThreadPool* pool = ThreadPool::Current()) {
+  if (begin >= end) return identity;
+  size_t chunk_size =
+      internal::ComputeChunkSize(begin, end, grain_size, pool);
+  size_t num_chunks = (end - begin + chunk_size - 1) / chunk_size;
+  std::vector<T> partials(num_chunks, identity);
+  ParallelForChunks(
+      begin, end,
+      [begin, chunk_size, &partials, &map, &reduce](size_t chunk_begin,
+                                                    size_t chunk_end) {
+        T& partial = partials[(chunk_begin - begin) / chunk_size];
+        for (size_t i = chunk_begin; i < chunk_end; ++i) {
+          partial = reduce(std::move(partial), map(i));
+        }
+      },
+      chunk_size, pool);
+  T ret = identity;
+  for (T& partial : partials) {
+    ret = reduce(std::move(ret), std::move(partial));
+  }
+  return ret;
+}
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_THREADING_PARALLEL_FOR_H_
@@ -0,0 +1,91 @@
+#include "tachyon/base/threading/parallel_for.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(ParallelForTest, ParallelFor) {
+  for (size_t num_threads : {1, 3}) {
+    ThreadPool pool(num_threads);
+    for (size_t size : {0, 1, 7, 1000}) {
+      std::vector<size_t> values(size, 0);
+      ParallelFor(
+          0, size, [&values](size_t i) { values[i] = i * i; },
+          /*grain_size=*/1, &pool);
+      for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(values[i], i * i);
+      }
+    }
+  }
+}
+
+TEST(ParallelForTest, ParallelForChunksWithGrainSize) {
+  ThreadPool pool(4);
+  constexpr size_t kGrainSize = 64;
+  std::atomic<size_t> num_small_chunks = 0;
+  std::vector<int> values(1000, 0);
+  ParallelForChunks(
+      10, 1000,
+      [&values, &num_small_chunks](size_t begin, size_t end) {
+        if (end - begin < kGrainSize) ++num_small_chunks;
+        for (size_t i = begin; i < end; ++i) {
+          ++values[i];
+        }
+      },
+      kGrainSize, &pool);
+  // Only the last chunk may be smaller than the grain size.
+  EXPECT_LE(num_small_chunks, size_t{1});
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(values[i], i < 10 ? 0 : 1);
+  }
+}
+
+TEST(ParallelForTest, Nested) {
+  ThreadPool pool(4);
+  constexpr size_t kRows = 16;
+  constexpr size_t kCols = 256;
+  std::vector<size_t> values(kRows * kCols, 0);
+  ParallelFor(
+      0, kRows,
+      [&values, &pool](size_t i) {
+        ParallelFor(
+            0, kCols, [&values, i](size_t j) { values[i * kCols + j] = i + j; },
+            /*grain_size=*/1, &pool);
+      },
+      /*grain_size=*/1, &pool);
+  for (size_t i = 0; i < kRows; ++i) {
+    for (size_t j = 0; j < kCols; ++j) {
+      EXPECT_EQ(values[i * kCols + j], i + j);
+    }
+  }
+}
+
+TEST(ParallelForTest, ParallelReduce) {
+  for (size_t num_threads : {1, 4}) {
+    ThreadPool pool(num_threads);
+    EXPECT_EQ(ParallelReduce(
+                  0, 0, size_t{7}, [](size_t i) { return i; },
+                  [](size_t a, size_t b) { return a + b; }, 1, &pool),
+              size_t{7});
+    EXPECT_EQ(ParallelReduce(
+                  0, 1001, size_t{0}, [](size_t i) { return i; },
+                  [](size_t a, size_t b) { return a + b; }, 1, &pool),
+              size_t{500500});
+  }
+}
+
+TEST(ParallelForTest, ParallelReduceKeepsOrder) {
+  ThreadPool pool(4);
+  // The string concatenation is associative but not commutative.
+  std::string ret = ParallelReduce(
+      0, 26, std::string(),
+      [](size_t i) { return std::string(1, static_cast<char>('a' + i)); },
+      [](std::string a, const std::string& b) { return a + b; }, 1, &pool);
+  EXPECT_EQ(ret, "abcdefghijklmnopqrstuvwxyz");
+}
+
+}  // namespace tachyon::base
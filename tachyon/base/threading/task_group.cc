@@ -0,0 +1,31 @@
+#include "tachyon/base/threading/task_group.h"
+
+#include <utility>
+
+namespace tachyon::base {
+
+void TaskGroup::Run(std::function<void()> task) {
+  num_pending_tasks_.fetch_add(1, std::memory_order_relaxed);
+  pool_->PostTask([this, pool = pool_, task = std::move(task)]() {
+    task();
+    // NOTE(chokobole): |this| may be destroyed as soon as the counter drops
+    // to 0, so the pool is captured instead of being read from |pool_|.
+    if (num_pending_tasks_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      pool->NotifyWaiters();
+    }
+  });
+}
+
+void TaskGroup::Wait() {
+  while (num_pending_tasks_.load(std::memory_order_acquire) > 0) {
+    if (pool_->RunPendingTask()) continue;
+    // NOTE(chokobole): The remaining tasks of this group are running on the
+    // other threads if there's nothing to run. It sleeps until they are done
+    // or until one of them spawns a task that it can steal.
+    pool_->WaitForTask([this]() {
+      return num_pending_tasks_.load(std::memory_order_acquire) == 0;
+    });
+  }
+}
+
+}  // namespace tachyon::base
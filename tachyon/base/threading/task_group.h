@@ -0,0 +1,47 @@
+#ifndef TACHYON_BASE_THREADING_TASK_GROUP_H_
+#define TACHYON_BASE_THREADING_TASK_GROUP_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <functional>
+
+#include "tachyon/base/threading/thread_pool.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |TaskGroup| spawns tasks to a |ThreadPool| and waits for all of them. While
+// waiting, the calling thread runs the pending tasks of the pool, so it can be
+// used inside another task, and it sleeps once there's nothing left to run.
+// For example:
+//
+//   TaskGroup group;
+//   group.Run([]() { ... });
+//   group.Run([]() { ... });
+//   group.Wait();
+class TACHYON_EXPORT TaskGroup {
+ public:
+  explicit TaskGroup(ThreadPool* pool = ThreadPool::Current()) : pool_(pool) {}
+  TaskGroup(const TaskGroup& other) = delete;
+  TaskGroup& operator=(const TaskGroup& other) = delete;
+  ~TaskGroup() { Wait(); }
+
+  ThreadPool* pool() const { return pool_; }
+
+  // Spawns |task|. It may run on any thread of |pool_| including the one that
+  // calls |Wait()|.
+  void Run(std::function<void()> task);
+
+  // Blocks until all the spawned tasks are done.
+  void Wait();
+
+ private:
+  // not owned
+  ThreadPool* const pool_;
+  std::atomic<size_t> num_pending_tasks_ = 0;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_THREADING_TASK_GROUP_H_
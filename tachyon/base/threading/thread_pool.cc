@@ -0,0 +1,217 @@
+#include "tachyon/base/threading/thread_pool.h"
+
+#include <algorithm>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "tachyon/base/environment.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon::base {
+
+namespace {
+
+thread_local ThreadPool* g_current_pool = nullptr;
+thread_local size_t g_current_worker_index = 0;
+
+// NOTE(chokobole): The code that isn't ported to |ThreadPool| yet may open an
+// OpenMP parallel region inside a task. A worker is not a thread of an OpenMP
+// team, so the region would spawn a whole new team on every worker. Since the
+// number of threads is a per-thread setting, the region is limited to the
+// running thread while a task runs.
+class ScopedSingleThreadedOpenMP {
+ public:
+#if defined(TACHYON_HAS_OPENMP)
+  ScopedSingleThreadedOpenMP() : num_threads_(omp_get_max_threads()) {
+    omp_set_num_threads(1);
+  }
+  ~ScopedSingleThreadedOpenMP() { omp_set_num_threads(num_threads_); }
+
+ private:
+  int num_threads_;
+#endif  // defined(TACHYON_HAS_OPENMP)
+};
+
+// Makes |pool| the current pool of the calling thread while it runs a task of
+// |pool| without being its worker, so that the task spawns its parallel loops
+// to |pool| as well.
+class ScopedCurrentPool {
+ public:
+  ScopedCurrentPool(ThreadPool* pool, size_t worker_index)
+      : pool_(g_current_pool), worker_index_(g_current_worker_index) {
+    g_current_pool = pool;
+    g_current_worker_index = worker_index;
+  }
+  ~ScopedCurrentPool() {
+    g_current_pool = pool_;
+    g_current_worker_index = worker_index_;
+  }
+
+ private:
+  ThreadPool* const pool_;
+  const size_t worker_index_;
+};
+
+}  // namespace
+
+class ThreadPool::Worker : public PlatformThread::Delegate {
+ public:
+  Worker(ThreadPool* pool, size_t index) : pool_(pool), index_(index) {}
+
+  void Start() { CHECK(PlatformThread::Create(0, this, &handle_)); }
+  void Join() { PlatformThread::Join(handle_); }
+
+  // PlatformThread::Delegate methods
+  void ThreadMain() override {
+    PlatformThread::SetName("ThreadPoolWorker");
+    g_current_pool = pool_;
+    g_current_worker_index = index_;
+    pool_->WorkerMain();
+  }
+
+ private:
+  // not owned
+  ThreadPool* const pool_;
+  const size_t index_;
+  PlatformThreadHandle handle_;
+};
+
+ThreadPool::ThreadPool(size_t num_threads) {
+  CHECK_GT(num_threads, size_t{0});
+  size_t num_workers = num_threads - 1;
+  queues_.reserve(num_workers + 1);
+  for (size_t i = 0; i < num_workers + 1; ++i) {
+    queues_.push_back(std::make_unique<TaskQueue>());
+  }
+  workers_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers_.push_back(std::make_unique<Worker>(this, i));
+  }
+  for (std::unique_ptr<Worker>& worker : workers_) {
+    worker->Start();
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    shutdown_ = true;
+  }
+  sleep_cv_.notify_all();
+  for (std::unique_ptr<Worker>& worker : workers_) {
+    worker->Join();
+  }
+}
+
+// static
+ThreadPool* ThreadPool::GetDefault() {
+  static NoDestructor<ThreadPool> pool(GetDefaultNumThreads());
+  return pool.get();
+}
+
+// static
+size_t ThreadPool::GetDefaultNumThreads() {
+  std::string_view value;
+  size_t num_threads;
+  if (Environment::Get("TACHYON_NUM_THREADS", &value) &&
+      StringToSizeT(value, &num_threads) && num_threads > 0) {
+    return num_threads;
+  }
+  // NOTE(chokobole): |std::thread::hardware_concurrency()| returns 0 if the
+  // number is not computable.
+  return std::max(size_t{std::thread::hardware_concurrency()}, size_t{1});
+}
+
+// static
+ThreadPool* ThreadPool::Current() {
+  return g_current_pool ? g_current_pool : GetDefault();
+}
+
+void ThreadPool::PostTask(Task task) {
+  TaskQueue& queue = *queues_[GetCurrentWorkerIndex()];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+  }
+  num_pending_tasks_.fetch_add(1, std::memory_order_release);
+  // NOTE(chokobole): |sleep_mutex_| is acquired to make sure that a worker
+  // that is about to sleep either sees the task or gets notified.
+  std::lock_guard<std::mutex> lock(sleep_mutex_);
+  if (num_sleeping_threads_ > 0) sleep_cv_.notify_one();
+}
+
+bool ThreadPool::RunPendingTask() {
+  Task task;
+  if (!PopTask(GetCurrentWorkerIndex(), &task)) return false;
+  if (g_current_pool == this) {
+    task();
+  } else {
+    // NOTE(chokobole): |workers_.size()| is the index of the queue shared by
+    // the threads that are not workers. See |GetCurrentWorkerIndex()|.
+    ScopedCurrentPool scoped_current_pool(this, workers_.size());
+    ScopedSingleThreadedOpenMP scoped_single_threaded_openmp;
+    task();
+  }
+  return true;
+}
+
+void ThreadPool::NotifyWaiters() {
+  std::lock_guard<std::mutex> lock(sleep_mutex_);
+  if (num_sleeping_threads_ > 0) sleep_cv_.notify_all();
+}
+
+size_t ThreadPool::GetCurrentWorkerIndex() const {
+  return g_current_pool == this ? g_current_worker_index : workers_.size();
+}
+
+bool ThreadPool::PopTask(size_t index, Task* task) {
+  if (num_pending_tasks_.load(std::memory_order_acquire) == 0) return false;
+
+  // Pops the most recent task of its own.
+  {
+    TaskQueue& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      *task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      num_pending_tasks_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  // Steals the oldest task of the others.
+  for (size_t i = 1; i < queues_.size(); ++i) {
+    TaskQueue& queue = *queues_[(index + i) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      *task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      num_pending_tasks_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::WorkerMain() {
+#if defined(TACHYON_HAS_OPENMP)
+  omp_set_num_threads(1);
+#endif  // defined(TACHYON_HAS_OPENMP)
+  while (true) {
+    if (RunPendingTask()) continue;
+
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    ++num_sleeping_threads_;
+    sleep_cv_.wait(lock, [this]() {
+      return shutdown_ ||
+             num_pending_tasks_.load(std::memory_order_acquire) > 0;
+    });
+    --num_sleeping_threads_;
+    if (shutdown_) return;
+  }
+}
+
+}  // namespace tachyon::base
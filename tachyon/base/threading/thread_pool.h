@@ -0,0 +1,118 @@
+#ifndef TACHYON_BASE_THREADING_THREAD_POOL_H_
+#define TACHYON_BASE_THREADING_THREAD_POOL_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "tachyon/base/threading/platform_thread.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |ThreadPool| is a work-stealing scheduler. Each worker owns a deque of
+// tasks. It pushes and pops its own tasks at the back and steals the tasks of
+// the other workers at the front, so that a worker keeps running the most
+// recently spawned, hence cache-hot, tasks while idle workers take the oldest,
+// hence biggest, ones.
+//
+// A thread that waits for tasks, see |TaskGroup::Wait()|, runs the pending
+// tasks instead of blocking and only sleeps once there's nothing left to run.
+// Therefore, a parallel loop inside a task doesn't spawn any new thread and
+// never deadlocks, which makes the parallel primitives compose when nested.
+// The thread calling into the pool participates as well, so a pool of
+// |num_threads| runs |num_threads| - 1 workers.
+//
+// The pool doesn't touch any process-global state, so a host process can run
+// several pools side by side. |ThreadPool::GetDefault()| is shared by the
+// callers that don't specify their own pool.
+class TACHYON_EXPORT ThreadPool {
+ public:
+  using Task = std::function<void()>;
+
+  // Creates a pool that runs tasks on |num_threads| threads including the
+  // calling thread. |num_threads| is at least 1.
+  explicit ThreadPool(size_t num_threads);
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+  ~ThreadPool();
+
+  // Returns the pool shared by default. Its number of threads is
+  // |GetDefaultNumThreads()|.
+  static ThreadPool* GetDefault();
+
+  // Returns |TACHYON_NUM_THREADS| if the environment variable is set to a
+  // positive number. Otherwise, returns the number of the hardware threads.
+  // It doesn't depend on whether OpenMP is enabled.
+  static size_t GetDefaultNumThreads();
+
+  // Returns the pool that owns the calling thread if it is a worker, or the
+  // pool whose task the calling thread is running. Otherwise, returns
+  // |GetDefault()|.
+  static ThreadPool* Current();
+
+  size_t num_threads() const { return workers_.size() + 1; }
+
+  // Posts |task| to the deque of the calling worker, or to the shared queue if
+  // the calling thread is not a worker of this pool.
+  void PostTask(Task task);
+
+  // Runs a single pending task on the calling thread. Returns false if there
+  // is no pending task.
+  bool RunPendingTask();
+
+  // Blocks the calling thread until there's a pending task or |done()|
+  // returns true. |done()| is evaluated with the lock of the pool held, so the
+  // thread that makes it true must call |NotifyWaiters()| afterwards.
+  template <typename Predicate>
+  void WaitForTask(Predicate done) {
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    ++num_sleeping_threads_;
+    sleep_cv_.wait(lock, [this, &done]() {
+      return done() || num_pending_tasks_.load(std::memory_order_acquire) > 0;
+    });
+    --num_sleeping_threads_;
+  }
+
+  // Wakes up the threads blocked in |WaitForTask()| to check their |done()|.
+  void NotifyWaiters();
+
+ private:
+  class Worker;
+
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  // Returns the index of the calling worker or |workers_.size()| if the
+  // calling thread is not a worker of this pool.
+  size_t GetCurrentWorkerIndex() const;
+
+  bool PopTask(size_t index, Task* task);
+
+  void WorkerMain();
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // |queues_[i]| is the deque of |workers_[i]| and |queues_.back()| is the
+  // one shared by the threads that are not workers.
+  std::vector<std::unique_ptr<TaskQueue>> queues_;
+  std::atomic<size_t> num_pending_tasks_ = 0;
+
+  // The workers and the threads in |WaitForTask()| sleep on |sleep_cv_| while
+  // there's no pending task.
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  size_t num_sleeping_threads_ = 0;
+  bool shutdown_ = false;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_THREADING_THREAD_POOL_H_
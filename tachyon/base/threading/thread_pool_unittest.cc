@@ -0,0 +1,122 @@
+#include "tachyon/base/threading/thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string_view>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/test/scoped_environment.h"
+#include "tachyon/base/threading/task_group.h"
+
+namespace tachyon::base {
+
+TEST(ThreadPoolTest, RunPendingTask) {
+  ThreadPool pool(1);
+  EXPECT_EQ(pool.num_threads(), size_t{1});
+  EXPECT_FALSE(pool.RunPendingTask());
+
+  int value = 0;
+  pool.PostTask([&value]() { value = 1; });
+  EXPECT_TRUE(pool.RunPendingTask());
+  EXPECT_EQ(value, 1);
+  EXPECT_FALSE(pool.RunPendingTask());
+}
+
+TEST(ThreadPoolTest, GetDefaultNumThreads) {
+  {
+    ScopedEnvironment env("TACHYON_NUM_THREADS", "3");
+    EXPECT_EQ(ThreadPool::GetDefaultNumThreads(), size_t{3});
+  }
+  size_t expected =
+      std::max(size_t{std::thread::hardware_concurrency()}, size_t{1});
+  for (std::string_view value : {"0", "abc"}) {
+    ScopedEnvironment env("TACHYON_NUM_THREADS", value);
+    EXPECT_EQ(ThreadPool::GetDefaultNumThreads(), expected);
+  }
+}
+
+TEST(ThreadPoolTest, Current) {
+  ThreadPool pool(4);
+  EXPECT_EQ(ThreadPool::Current(), ThreadPool::GetDefault());
+
+  std::atomic<size_t> num_tasks_on_pool = 0;
+  TaskGroup group(&pool);
+  for (size_t i = 0; i < 16; ++i) {
+    group.Run([&pool, &num_tasks_on_pool]() {
+      // The task may run on the waiting thread, which is not a worker, but
+      // the pool is current while it runs.
+      if (ThreadPool::Current() == &pool) ++num_tasks_on_pool;
+    });
+  }
+  group.Wait();
+  EXPECT_EQ(num_tasks_on_pool, size_t{16});
+  EXPECT_EQ(ThreadPool::Current(), ThreadPool::GetDefault());
+}
+
+TEST(ThreadPoolTest, CurrentOnSingleThread) {
+  // A pool of a single thread has no worker, so every task runs on the
+  // waiting thread.
+  ThreadPool pool(1);
+  ThreadPool* current = nullptr;
+  ThreadPool* nested_current = nullptr;
+  TaskGroup group(&pool);
+  group.Run([&current, &nested_current]() {
+    current = ThreadPool::Current();
+    TaskGroup inner_group;
+    inner_group.Run(
+        [&nested_current]() { nested_current = ThreadPool::Current(); });
+    inner_group.Wait();
+  });
+  group.Wait();
+  EXPECT_EQ(current, &pool);
+  EXPECT_EQ(nested_current, &pool);
+  EXPECT_EQ(ThreadPool::Current(), ThreadPool::GetDefault());
+}
+
+TEST(TaskGroupTest, Wait) {
+  for (size_t num_threads : {1, 2, 4}) {
+    ThreadPool pool(num_threads);
+    std::atomic<size_t> sum = 0;
+    TaskGroup group(&pool);
+    for (size_t i = 0; i < 100; ++i) {
+      group.Run([&sum, i]() { sum += i; });
+    }
+    group.Wait();
+    EXPECT_EQ(sum, size_t{4950});
+  }
+}
+
+TEST(TaskGroupTest, Nested) {
+  ThreadPool pool(4);
+  std::atomic<size_t> count = 0;
+  TaskGroup group(&pool);
+  for (size_t i = 0; i < 8; ++i) {
+    group.Run([&pool, &count]() {
+      // A group waiting inside a task runs the pending tasks instead of
+      // blocking the worker, so it never deadlocks.
+      TaskGroup inner_group(&pool);
+      for (size_t j = 0; j < 8; ++j) {
+        inner_group.Run([&count]() { ++count; });
+      }
+      inner_group.Wait();
+    });
+  }
+  group.Wait();
+  EXPECT_EQ(count, size_t{64});
+}
+
+TEST(TaskGroupTest, WaitOnDestruction) {
+  ThreadPool pool(2);
+  std::atomic<size_t> count = 0;
+  {
+    TaskGroup group(&pool);
+    for (size_t i = 0; i < 10; ++i) {
+      group.Run([&count]() { ++count; });
+    }
+  }
+  EXPECT_EQ(count, size_t{10});
+}
+
+}  // namespace tachyon::base
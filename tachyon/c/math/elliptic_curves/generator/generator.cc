@@ -754,6 +754,21 @@ int GenerationConfig::GenerateMSMHdr() const {
       "TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_affine_msm(",
       "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_g1_affine* bases,",
       "    const tachyon_%{type}_fr* scalars, size_t size);",
+      "",
+      "// Precomputes |bases|, so that |tachyon_%{type}_g1_precomputed_msm()| can",
+      "// reuse them across calls.",
+      "TACHYON_C_EXPORT void tachyon_%{type}_g1_msm_precompute_point2(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_g1_point2* bases,",
+      "    size_t size);",
+      "",
+      "TACHYON_C_EXPORT void tachyon_%{type}_g1_msm_precompute_affine(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_g1_affine* bases,",
+      "    size_t size);",
+      "",
+      "// Computes a MSM of |scalars| with the first |size| precomputed bases.",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_precomputed_msm(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_fr* scalars,",
+      "    size_t size);",
   };
   // clang-format on
   std::string tpl_content = absl::StrJoin(tpl, "\n");
@@ -798,6 +813,25 @@ int GenerationConfig::GenerateMSMSrc() const {
       "  return tachyon::c::math::DoMSM<tachyon::math::%{type}::G1JacobianPoint>(",
       "      *ptr, bases, scalars, size);",
       "}",
+      "",
+      "void tachyon_%{type}_g1_msm_precompute_point2(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_g1_point2* bases,",
+      "    size_t size) {",
+      "  tachyon::c::math::DoPrecomputeMSM(*ptr, bases, size);",
+      "}",
+      "",
+      "void tachyon_%{type}_g1_msm_precompute_affine(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_g1_affine* bases,",
+      "    size_t size) {",
+      "  tachyon::c::math::DoPrecomputeMSM(*ptr, bases, size);",
+      "}",
+      "",
+      "tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_precomputed_msm(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_fr* scalars,",
+      "    size_t size) {",
+      "  return tachyon::c::math::DoPrecomputedMSM<tachyon::math::%{type}::G1JacobianPoint>(",
+      "      *ptr, scalars, size);",
+      "}",
   };
   // clang-format on
   std::string tpl_content = absl::StrJoin(tpl, "\n");
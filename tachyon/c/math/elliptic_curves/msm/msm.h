@@ -1,11 +1,13 @@
 #ifndef TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_H_
 #define TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_H_
 
+#include <memory>
 #include <tuple>
 
 #include "tachyon/base/console/console_stream.h"
 #include "tachyon/c/math/elliptic_curves/msm/msm_input_provider.h"
 #include "tachyon/cc/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/elliptic_curves/msm/precomputed_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 
@@ -15,6 +17,8 @@ template <typename Point>
 struct MSMApi {
   MSMInputProvider<Point> provider;
   tachyon::math::VariableBaseMSM<Point> msm;
+  // Set by |DoPrecomputeMSM()| to commit against the same bases repeatedly.
+  std::unique_ptr<tachyon::math::PrecomputedMSM<Point>> precomputed_msm;
 
   explicit MSMApi(uint8_t degree) {
     // NOTE(chokobole): This constructor accepts |degree| for compatibility with
@@ -48,6 +52,32 @@ CRetPoint* DoMSM(MSMApi<Point>& msm_api, const CPoint* bases,
   return cret;
 }
 
+template <typename Point, typename CPoint>
+void DoPrecomputeMSM(MSMApi<Point>& msm_api, const CPoint* bases, size_t size) {
+  msm_api.precomputed_msm =
+      std::make_unique<tachyon::math::PrecomputedMSM<Point>>(
+          MSMInputProvider<Point>::CreateBases(bases, size));
+}
+
+template <
+    typename RetPoint, typename Point, typename CScalarField,
+    typename CRetPoint = typename cc::math::PointTraits<RetPoint>::CCurvePoint,
+    typename Bucket = typename tachyon::math::PrecomputedMSM<Point>::Bucket>
+CRetPoint* DoPrecomputedMSM(MSMApi<Point>& msm_api,
+                            const CScalarField* scalars, size_t size) {
+  using ScalarField = typename Point::ScalarField;
+
+  CHECK(msm_api.precomputed_msm) << "Bases are not precomputed";
+  Bucket bucket;
+  CHECK(msm_api.precomputed_msm->Run(
+      absl::MakeConstSpan(reinterpret_cast<const ScalarField*>(scalars), size),
+      &bucket));
+  auto ret = tachyon::math::ConvertPoint<RetPoint>(bucket);
+  CRetPoint* cret = new CRetPoint();
+  cc::math::ToCPoint3(ret, cret);
+  return cret;
+}
+
 }  // namespace tachyon::c::math
 
 #endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_H_
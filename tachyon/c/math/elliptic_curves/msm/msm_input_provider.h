@@ -27,6 +27,26 @@ class MSMInputProvider {
   absl::Span<const AffinePoint> bases() const { return bases_; }
   absl::Span<const ScalarField> scalars() const { return scalars_; }
 
+  // Converts |bases_in| into |AffinePoint|s without an alignment.
+  static std::vector<AffinePoint> CreateBases(const CPoint* bases_in,
+                                              size_t size) {
+    const tachyon::math::Point2<BaseField>* points =
+        reinterpret_cast<const tachyon::math::Point2<BaseField>*>(bases_in);
+    std::vector<AffinePoint> bases;
+    bases.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+      bases.emplace_back(points[i],
+                         points[i].x.IsZero() && points[i].y.IsZero());
+    }
+    return bases;
+  }
+
+  static std::vector<AffinePoint> CreateBases(const CCurvePoint* bases_in,
+                                              size_t size) {
+    const AffinePoint* points = reinterpret_cast<const AffinePoint*>(bases_in);
+    return std::vector<AffinePoint>(points, points + size);
+  }
+
   void Clear() {
     bases_owned_.clear();
     scalars_owned_.clear();
@@ -59,4 +59,17 @@ TEST_F(MSMTest, MSMG1Affine) {
   }
 }
 
+TEST_F(MSMTest, PrecomputedMSM) {
+  for (const MSMTestSet<bn254::G1AffinePoint>& t : test_sets_) {
+    tachyon_bn254_g1_msm_precompute_affine(
+        msm_, reinterpret_cast<const tachyon_bn254_g1_affine*>(t.bases.data()),
+        t.bases.size());
+    std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
+    ret.reset(tachyon_bn254_g1_precomputed_msm(
+        msm_, reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+        t.scalars.size()));
+    EXPECT_EQ(cc::math::ToJacobianPoint(*ret), t.answer.ToJacobian());
+  }
+}
+
 }  // namespace tachyon::math
@@ -7,20 +7,36 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/bits.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/threading/parallel_for.h"
+#include "tachyon/crypto/commitments/fri/fri_config.h"
 #include "tachyon/crypto/commitments/fri/fri_proof.h"
 #include "tachyon/crypto/commitments/fri/fri_storage.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
 #include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
 
 namespace tachyon::crypto {
 
+// Let n be the size of |domain_|, m = n * 2ᵇ be the size of the LDE(Low Degree
+// Extension) domain, where b = |config_.log_blowup_factor| and ω be the
+// generator of the LDE domain. The evaluations of the polynomial over the LDE
+// domain are committed and folded 2ᵃ to 1 at every step, where a =
+// |config_.log_folding_arity|, until the degree bound of the folded polynomial
+// reaches |config_.final_poly_size|. Then the coefficients of the final
+// polynomial are written to the proof.
+//
+// The leaves of each committed layer are ordered so that the 2ᵃ evaluations
+// that are folded into one are adjacent, which lets a query open them with a
+// single Merkle multiproof.
 template <typename F, size_t MaxDegree>
 class FRI final
     : public UnivariatePolynomialCommitmentScheme<FRI<F, MaxDegree>> {
@@ -30,85 +46,143 @@ class FRI final
   using Evals = typename Base::Evals;
   using Domain = typename Base::Domain;
 
+  constexpr static uint32_t kMaxLogBlowupFactor = 4;
+  constexpr static size_t kMaxLDESize = (MaxDegree + 1) << kMaxLogBlowupFactor;
+
+  using LDEPoly = math::UnivariateDensePolynomial<F, kMaxLDESize - 1>;
+  using LDEEvals = math::UnivariateEvaluations<F, kMaxLDESize - 1>;
+  using LDEDomain = math::UnivariateEvaluationDomain<F, kMaxLDESize - 1>;
+  using Tree = BinaryMerkleTree<F, F, kMaxLDESize>;
+
   FRI() = default;
   FRI(const Domain* domain, FRIStorage<F>* storage,
-      BinaryMerkleHasher<F, F>* hasher)
-      : domain_(domain), storage_(storage), hasher_(hasher) {
+      BinaryMerkleHasher<F, F>* hasher, const FRIConfig& config = {})
+      : domain_(domain), storage_(storage), hasher_(hasher), config_(config) {
     // This ensures last folding process.
     CHECK_GE(domain->size(), size_t{2}) << "Domain size must be at least 2";
-    uint32_t k = domain->log_size_of_group();
-    if (k > 1) {
-      sub_domains_ = base::CreateVector(k - 1, [k](size_t i) {
-        return Domain::Create(size_t{1} << (k - i - 1));
-      });
-    }
-    storage_->Allocate(k);
+    CHECK_LE(config_.log_blowup_factor, kMaxLogBlowupFactor);
+    CHECK_GE(config_.log_folding_arity, uint32_t{1});
+    CHECK(base::bits::IsPowerOfTwo(config_.final_poly_size));
+    CHECK_LT(config_.final_poly_size, domain->size());
+
+    lde_domain_ = LDEDomain::Create(domain->size()
+                                    << config_.log_blowup_factor);
+    size_t lde_size = lde_domain_->size();
+    num_rounds_ = domain->log_size_of_group() -
+                  base::bits::Log2Ceiling(config_.final_poly_size);
+    final_domain_ = LDEDomain::Create(lde_size >> num_rounds_);
+
+    // |inv_twiddles_[k]| = ω⁻ᵏ / 2 for k in [0, m / 2)
+    two_inv_ = F(2).Inverse();
+    inv_twiddles_ = F::GetSuccessivePowers(
+        lde_size >> 1, lde_domain_->group_gen().Inverse(), two_inv_);
+    storage_->Allocate(GetNumSteps());
   }
 
   // UnivariatePolynomialCommitmentScheme methods
   size_t N() const { return domain_->size(); }
 
+  const FRIConfig& config() const { return config_; }
+  size_t lde_size() const { return lde_domain_->size(); }
+
+  // Returns the number of the committed layers.
+  size_t GetNumSteps() const {
+    return (num_rounds_ + config_.log_folding_arity - 1) /
+           config_.log_folding_arity;
+  }
+
   [[nodiscard]] bool Commit(const Poly& poly, Transcript<F>* transcript) const {
-    uint32_t num_layers = domain_->log_size_of_group();
     TranscriptWriter<F>* writer = transcript->ToWriter();
-    BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(0), hasher_);
-    Evals evals = domain_->FFT(poly);
-    F root;
-    if (!tree.Commit(evals.evaluations(), &root)) return false;
-    if (!writer->WriteToProof(root)) return false;
-    const Poly* cur_poly = &poly;
-
-    F beta;
-    Poly folded_poly;
-    if (num_layers > 1) {
-      for (uint32_t i = 1; i < num_layers; ++i) {
-        // Pᵢ(X)   = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
-        // Pᵢ₊₁(X) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
-        beta = writer->SqueezeChallenge();
-        folded_poly = cur_poly->template Fold<false>(beta);
-        BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(i),
-                                                   hasher_);
-        evals = sub_domains_[i - 1]->FFT(folded_poly);
-        if (!tree.Commit(evals.evaluations(), &root)) return false;
-        if (!writer->WriteToProof(root)) return false;
-        cur_poly = &folded_poly;
+    if (poly.Degree() >= domain_->size()) {
+      LOG(ERROR) << "Degree of |poly| exceeds the size of the domain";
+      return false;
+    }
+    LDEEvals lde_evals =
+        lde_domain_->FFT(LDEPoly(typename LDEPoly::Coefficients(
+            poly.coefficients().coefficients())));
+    std::vector<F> evals = std::move(lde_evals.evaluations());
+    evals.resize(lde_domain_->size(), F::Zero());
+
+    size_t num_steps = GetNumSteps();
+    layers_.resize(num_steps);
+    uint32_t round = 0;
+    for (size_t step = 0; step < num_steps; ++step) {
+      uint32_t arity = GetArity(step);
+      layers_[step] = ToLeaves(evals, arity);
+      Tree tree(storage_->GetLayer(step), hasher_);
+      F root;
+      if (!tree.Commit(layers_[step], &root)) return false;
+      if (!writer->WriteToProof(root)) return false;
+
+      F beta = writer->SqueezeChallenge();
+      for (uint32_t i = 0; i < arity; ++i) {
+        // Folding 2ᵃ to 1 with β is the same as folding 2 to 1 a times with
+        // β, β², ..., β^{2ᵃ⁻¹}.
+        evals = Fold(evals, beta);
+        beta.SquareInPlace();
       }
+      round += arity;
     }
+    DCHECK_EQ(round, num_rounds_);
 
-    beta = writer->SqueezeChallenge();
-    folded_poly = cur_poly->template Fold<false>(beta);
-    const F* constant = folded_poly[0];
-    root = constant ? *constant : F::Zero();
-    return writer->WriteToProof(root);
+    LDEPoly final_poly = final_domain_->IFFT(LDEEvals(std::move(evals)));
+    std::vector<F>& coefficients = final_poly.coefficients().coefficients();
+    if (coefficients.size() > config_.final_poly_size) {
+      LOG(ERROR) << "Degree of the final polynomial is too high";
+      return false;
+    }
+    coefficients.resize(config_.final_poly_size, F::Zero());
+    for (const F& coefficient : coefficients) {
+      if (!writer->WriteToProof(coefficient)) return false;
+    }
+    return true;
   }
 
   [[nodiscard]] bool DoCreateOpeningProof(size_t index,
                                           FRIProof<F>* fri_proof) const {
-    size_t domain_size = domain_->size();
-    uint32_t num_layers = domain_->log_size_of_group();
-    for (uint32_t i = 0; i < num_layers; ++i) {
-      size_t leaf_index = index % domain_size;
-      BinaryMerkleTreeStorage<F>* layer = storage_->GetLayer(i);
-      BinaryMerkleTree<F, F, MaxDegree + 1> tree(layer, hasher_);
-      BinaryMerkleProof<F> proof;
-      if (!tree.CreateOpeningProof(leaf_index, &proof)) return false;
-      // Merkle proof for Pᵢ(ωʲ) against Cᵢ
-      fri_proof->paths.push_back(std::move(proof));
-      // Pᵢ(ωʲ)
-      fri_proof->evaluations.push_back(
-          layer->GetHash(domain_size - 1 + leaf_index));
-
-      size_t half_domain_size = domain_size >> 1;
-      size_t leaf_index_sym = (index + half_domain_size) % domain_size;
-      BinaryMerkleProof<F> proof_sym;
-      if (!tree.CreateOpeningProof(leaf_index_sym, &proof_sym)) return false;
-      // Merkle proof for Pᵢ(-ωʲ) against Cᵢ
-      fri_proof->paths_sym.push_back(std::move(proof_sym));
-      // Pᵢ(-ωʲ)
-      fri_proof->evaluations_sym.push_back(
-          layer->GetHash(domain_size - 1 + leaf_index_sym));
-
-      domain_size = half_domain_size;
+    return DoCreateOpeningProof(std::vector<size_t>{index}, fri_proof);
+  }
+
+  // Opens the evaluations at |indices|, which are taken modulo the size of the
+  // LDE domain, of every committed layer. The indices that share an opening
+  // are opened only once.
+  [[nodiscard]] bool DoCreateOpeningProof(const std::vector<size_t>& indices,
+                                          FRIProof<F>* fri_proof) const {
+    if (indices.empty()) {
+      LOG(ERROR) << "No indices to open";
+      return false;
+    }
+    size_t num_steps = GetNumSteps();
+    if (layers_.size() != num_steps) {
+      LOG(ERROR) << "The polynomial is not committed";
+      return false;
+    }
+    fri_proof->evaluations.resize(num_steps);
+    fri_proof->proofs.resize(num_steps);
+
+    size_t layer_size = lde_domain_->size();
+    std::vector<size_t> queries =
+        base::Map(indices, [layer_size](size_t index) {
+          return index % layer_size;
+        });
+    for (size_t step = 0; step < num_steps; ++step) {
+      uint32_t arity = GetArity(step);
+      size_t next_layer_size = layer_size >> arity;
+      std::vector<size_t> leaf_indices =
+          GetLeafIndices(queries, next_layer_size, arity);
+
+      Tree tree(storage_->GetLayer(step), hasher_);
+      if (!tree.CreateOpeningProof(leaf_indices, &fri_proof->proofs[step]))
+        return false;
+      fri_proof->evaluations[step] =
+          base::Map(leaf_indices, [this, step](size_t leaf_index) {
+            return layers_[step][leaf_index];
+          });
+
+      for (size_t& query : queries) {
+        query %= next_layer_size;
+      }
+      layer_size = next_layer_size;
     }
     return true;
   }
@@ -116,96 +190,224 @@ class FRI final
   [[nodiscard]] bool DoVerifyOpeningProof(Transcript<F>& transcript,
                                           size_t index,
                                           const FRIProof<F>& proof) const {
+    return DoVerifyOpeningProof(transcript, std::vector<size_t>{index}, proof);
+  }
+
+  [[nodiscard]] bool DoVerifyOpeningProof(Transcript<F>& transcript,
+                                          const std::vector<size_t>& indices,
+                                          const FRIProof<F>& proof) const {
     TranscriptReader<F>* reader = transcript.ToReader();
-    size_t domain_size = domain_->size();
-    uint32_t num_layers = domain_->log_size_of_group();
-    F root;
-    F x;
-    F beta;
-    F evaluation;
-    F evaluation_sym;
-    F two_inv = F(2).Inverse();
-    for (uint32_t i = 0; i < num_layers; ++i) {
-      BinaryMerkleTreeStorage<F>* layer = storage_->GetLayer(i);
-      BinaryMerkleTree<F, F, MaxDegree + 1> tree(layer, hasher_);
-
-      if (!reader->ReadFromProof(&root)) return false;
-      if (!tree.VerifyOpeningProof(root, proof.evaluations[i], proof.paths[i]))
+    size_t num_steps = GetNumSteps();
+    if (indices.empty()) {
+      LOG(ERROR) << "No indices to verify";
+      return false;
+    }
+    if (proof.evaluations.size() != num_steps ||
+        proof.proofs.size() != num_steps) {
+      LOG(ERROR) << "Proof doesn't have " << num_steps << " layers";
+      return false;
+    }
+
+    std::vector<F> roots(num_steps);
+    std::vector<F> betas(num_steps);
+    for (size_t step = 0; step < num_steps; ++step) {
+      if (!reader->ReadFromProof(&roots[step])) return false;
+      betas[step] = reader->SqueezeChallenge();
+    }
+    std::vector<F> final_coefficients(config_.final_poly_size);
+    for (F& coefficient : final_coefficients) {
+      if (!reader->ReadFromProof(&coefficient)) return false;
+    }
+
+    size_t layer_size = lde_domain_->size();
+    std::vector<size_t> queries =
+        base::Map(indices, [layer_size](size_t index) {
+          return index % layer_size;
+        });
+    // |expected[i]| is the value of the i-th query folded from the previous
+    // layer.
+    std::vector<F> expected(queries.size());
+    for (size_t step = 0; step < num_steps; ++step) {
+      uint32_t arity = GetArity(step);
+      size_t coset_size = size_t{1} << arity;
+      size_t next_layer_size = layer_size >> arity;
+      std::vector<size_t> leaf_indices =
+          GetLeafIndices(queries, next_layer_size, arity);
+      const std::vector<F>& evaluations = proof.evaluations[step];
+      if (evaluations.size() != leaf_indices.size()) {
+        LOG(ERROR) << "Wrong number of evaluations at layer [" << step << "]";
         return false;
+      }
 
-      if (!tree.VerifyOpeningProof(root, proof.evaluations_sym[i],
-                                   proof.paths_sym[i]))
+      Tree tree(storage_->GetLayer(step), hasher_);
+      BinaryMerkleMultiOpening<F> opening;
+      opening.leaves_size = layer_size;
+      opening.leaf_hashes = base::Map(evaluations, [this](const F& evaluation) {
+        return hasher_->ComputeLeafHash(evaluation);
+      });
+      opening.indices = std::move(leaf_indices);
+      if (!tree.VerifyOpeningProof(roots[step], opening, proof.proofs[step])) {
+        LOG(ERROR) << "Failed to verify Merkle proof at layer [" << step
+                   << "]";
         return false;
+      }
 
-      // Given equations:
-      // Pᵢ(X)  = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
-      // Pᵢ(-X) = Pᵢ_even(X²) - X * Pᵢ_odd(X²)
-      //
-      // Using Gaussian elimination, we derive:
-      // Pᵢ_even(X²) = (Pᵢ(X) + Pᵢ(-X)) / 2
-      // Pᵢ_odd(X²)  = (Pᵢ(X) - Pᵢ(-X)) / (2 * X)
-      //
-      // Next layer equation:
-      // Pᵢ₊₁(X) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
-      //
-      // If the domain of Pᵢ(X) is Dᵢ = {ω⁰, ω¹, ..., ωⁿ⁻¹},
-      // then the domain of Pᵢ₊₁(X) is Dᵢ₊₁ = {ω⁰, ω¹, ..., ωᵏ⁻¹},
-      // where k = n / 2.
-      //
-      // As per the definition:
-      // Pᵢ₊₁(ωʲ) = Pᵢ_even((ωʲ)²) + β * Pᵢ_odd((ωʲ)²)
-      //
-      // Substituting Pᵢ_even and Pᵢ_odd:
-      // Pᵢ₊₁(ωʲ) = (Pᵢ(ωʲ) + Pᵢ(-ωʲ)) / 2 + β * (Pᵢ(ωʲ) - Pᵢ(-ωʲ)) / (2 * ωʲ)
-      //           = ((1 + β * ω⁻ʲ) * Pᵢ(ωʲ) + (1 - β * ω⁻ʲ) * Pᵢ(-ωʲ)) / 2
-      size_t leaf_index = index % domain_size;
-      if (i == 0) {
-        evaluation = proof.evaluations[i];
-        evaluation_sym = proof.evaluations_sym[i];
-        x = domain_->GetElement(leaf_index);
-      } else {
-        evaluation *= (F::One() + beta);
-        evaluation_sym *= (F::One() - beta);
-        evaluation += evaluation_sym;
-        evaluation *= two_inv;
-
-        if (evaluation != proof.evaluations[i]) {
+      for (size_t i = 0; i < queries.size(); ++i) {
+        size_t j = queries[i] % next_layer_size;
+        size_t offset = FindCoset(opening.indices, j * coset_size);
+        // |coset[t]| = Pᵢ(ω^{(j + t * s') * (m / s)}), where s and s' are
+        // |layer_size| and |next_layer_size|.
+        std::vector<F> coset(evaluations.begin() + offset,
+                             evaluations.begin() + offset + coset_size);
+        size_t t = queries[i] / next_layer_size;
+        if (step > 0 && coset[t] != expected[i]) {
           LOG(ERROR)
-              << "Proof doesn't match with expected evaluation at layer [" << i
-              << "]";
+              << "Proof doesn't match with expected evaluation at layer ["
+              << step << "]";
           return false;
         }
-        evaluation_sym = proof.evaluations_sym[i];
-        x = sub_domains_[i - 1]->GetElement(leaf_index);
+        expected[i] = FoldCoset(std::move(coset), j, layer_size,
+                                next_layer_size, betas[step]);
+        queries[i] = j;
       }
-      beta = reader->SqueezeChallenge();
-      beta *= x.Inverse();
-      domain_size = domain_size >> 1;
+      layer_size = next_layer_size;
     }
 
-    evaluation *= (F::One() + beta);
-    evaluation_sym *= (F::One() - beta);
-    evaluation += evaluation_sym;
-    evaluation *= two_inv;
-
-    if (!reader->ReadFromProof(&root)) return false;
-    if (root != evaluation) {
-      LOG(ERROR) << "Root doesn't match with expected evaluation";
-      return false;
+    for (size_t i = 0; i < queries.size(); ++i) {
+      F x = lde_domain_->GetElement(queries[i] << num_rounds_);
+      F evaluation = F::Zero();
+      for (auto it = final_coefficients.rbegin();
+           it != final_coefficients.rend(); ++it) {
+        evaluation *= x;
+        evaluation += *it;
+      }
+      if (evaluation != expected[i]) {
+        LOG(ERROR) << "Final polynomial doesn't match with expected evaluation";
+        return false;
+      }
     }
     return true;
   }
 
  private:
+  uint32_t GetArity(size_t step) const {
+    return std::min(config_.log_folding_arity,
+                    num_rounds_ - static_cast<uint32_t>(
+                                      step * config_.log_folding_arity));
+  }
+
+  // Reorders |evals| so that the evaluations folded into the j-th evaluation of
+  // the next layer are at [j * 2ᵃ, (j + 1) * 2ᵃ), where a = |arity|.
+  static std::vector<F> ToLeaves(const std::vector<F>& evals, uint32_t arity) {
+    size_t coset_size = size_t{1} << arity;
+    size_t next_layer_size = evals.size() >> arity;
+    std::vector<F> leaves(evals.size());
+    base::ParallelFor(0, next_layer_size, [&evals, &leaves, coset_size,
+                                           next_layer_size](size_t j) {
+      for (size_t t = 0; t < coset_size; ++t) {
+        leaves[j * coset_size + t] = evals[j + t * next_layer_size];
+      }
+    });
+    return leaves;
+  }
+
+  // Returns the sorted leaf indices of the cosets opened by |queries|.
+  static std::vector<size_t> GetLeafIndices(const std::vector<size_t>& queries,
+                                            size_t next_layer_size,
+                                            uint32_t arity) {
+    size_t coset_size = size_t{1} << arity;
+    std::vector<size_t> cosets =
+        base::Map(queries, [next_layer_size](size_t query) {
+          return query % next_layer_size;
+        });
+    std::sort(cosets.begin(), cosets.end());
+    cosets.erase(std::unique(cosets.begin(), cosets.end()), cosets.end());
+    std::vector<size_t> leaf_indices;
+    leaf_indices.reserve(cosets.size() * coset_size);
+    for (size_t j : cosets) {
+      for (size_t t = 0; t < coset_size; ++t) {
+        leaf_indices.push_back(j * coset_size + t);
+      }
+    }
+    return leaf_indices;
+  }
+
+  static size_t FindCoset(const std::vector<size_t>& leaf_indices,
+                          size_t leaf_index) {
+    auto it = std::lower_bound(leaf_indices.begin(), leaf_indices.end(),
+                               leaf_index);
+    DCHECK(it != leaf_indices.end() && *it == leaf_index);
+    return it - leaf_indices.begin();
+  }
+
+  // Given equations:
+  // Pᵢ(X)  = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
+  // Pᵢ(-X) = Pᵢ_even(X²) - X * Pᵢ_odd(X²)
+  //
+  // Using Gaussian elimination, we derive:
+  // Pᵢ_even(X²) = (Pᵢ(X) + Pᵢ(-X)) / 2
+  // Pᵢ_odd(X²)  = (Pᵢ(X) - Pᵢ(-X)) / (2 * X)
+  //
+  // Next layer equation:
+  // Pᵢ₊₁(X²) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
+  //
+  // If the domain of Pᵢ(X) is Dᵢ = {ω⁰, ω¹, ..., ωˢ⁻¹}, then ωʲ⁺ˢᐟ² = -ωʲ and
+  // the j-th evaluation of the next layer is
+  //
+  // Pᵢ₊₁(ω²ʲ) = (Pᵢ(ωʲ) + Pᵢ(-ωʲ)) / 2 + β * (Pᵢ(ωʲ) - Pᵢ(-ωʲ)) * ω⁻ʲ / 2
+  //
+  // where ω⁻ʲ / 2 is looked up from |inv_twiddles_|.
+  std::vector<F> Fold(const std::vector<F>& evals, const F& beta) const {
+    size_t half = evals.size() >> 1;
+    size_t stride = lde_domain_->size() / evals.size();
+    std::vector<F> ret(half);
+    base::ParallelFor(0, half, [this, &evals, &beta, &ret, half,
+                                stride](size_t j) {
+      const F& lo = evals[j];
+      const F& hi = evals[j + half];
+      ret[j] =
+          (lo + hi) * two_inv_ + beta * (lo - hi) * inv_twiddles_[j * stride];
+    });
+    return ret;
+  }
+
+  // Folds |coset|, the evaluations at the positions j + t * |next_layer_size|
+  // of the layer of size |layer_size|, into the j-th evaluation of the next
+  // layer.
+  F FoldCoset(std::vector<F> coset, size_t j, size_t layer_size,
+              size_t next_layer_size, F beta) const {
+    while (coset.size() > 1) {
+      size_t half = coset.size() >> 1;
+      size_t stride = lde_domain_->size() / layer_size;
+      for (size_t t = 0; t < half; ++t) {
+        const F& lo = coset[t];
+        const F& hi = coset[t + half];
+        size_t position = j + t * next_layer_size;
+        coset[t] = (lo + hi) * two_inv_ +
+                   beta * (lo - hi) * inv_twiddles_[position * stride];
+      }
+      coset.resize(half);
+      beta.SquareInPlace();
+      layer_size >>= 1;
+    }
+    return coset[0];
+  }
+
   // not owned
   const Domain* domain_ = nullptr;
   // not owned
   mutable FRIStorage<F>* storage_ = nullptr;
   // not owned
   BinaryMerkleHasher<F, F>* hasher_ = nullptr;
-  // not owned
-  Transcript<F>* transcript_ = nullptr;
-  std::vector<std::unique_ptr<Domain>> sub_domains_;
+  FRIConfig config_;
+  std::unique_ptr<LDEDomain> lde_domain_;
+  std::unique_ptr<LDEDomain> final_domain_;
+  uint32_t num_rounds_ = 0;
+  F two_inv_;
+  std::vector<F> inv_twiddles_;
+  // |layers_[i]| are the leaves of the i-th committed layer, kept to open
+  // the evaluations.
+  mutable std::vector<std::vector<F>> layers_;
 };
 
 template <typename F, size_t MaxDegree>
@@ -0,0 +1,27 @@
+// Use of this source code is governed by a Apache-2.0 style license that
+// can be found in the LICENSE.lambdaworks.
+
+#ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_CONFIG_H_
+#define TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_CONFIG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace tachyon::crypto {
+
+struct FRIConfig {
+  // log₂ of the ratio of the size of the evaluation domain to the degree
+  // bound of the polynomial, which is the inverse of the rate of the code.
+  uint32_t log_blowup_factor = 0;
+  // log₂ of the number of the evaluations folded into one at each committed
+  // layer.
+  uint32_t log_folding_arity = 1;
+  // The folding stops when the degree bound of the folded polynomial is at
+  // most this, and its coefficients are sent instead. It must be a power of
+  // two.
+  size_t final_poly_size = 1;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_CONFIG_H_
@@ -12,10 +12,12 @@ namespace tachyon::crypto {
 
 template <typename F>
 struct FRIProof {
-  std::vector<BinaryMerkleProof<F>> paths;
-  std::vector<BinaryMerkleProof<F>> paths_sym;
-  std::vector<F> evaluations;
-  std::vector<F> evaluations_sym;
+  // |evaluations[i]| are the evaluations of the i-th committed layer opened by
+  // all the queries, sorted by the leaf index without duplicates.
+  std::vector<std::vector<F>> evaluations;
+  // |proofs[i]| proves |evaluations[i]| against the root of the i-th
+  // committed layer.
+  std::vector<BinaryMerkleMultiProof<F>> proofs;
 };
 
 }  // namespace tachyon::crypto
@@ -3,6 +3,7 @@
 
 #include "tachyon/crypto/commitments/fri/fri.h"
 
+#include "absl/strings/substitute.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
@@ -91,4 +92,76 @@ TEST_F(FRITest, CommitAndVerify) {
   ASSERT_TRUE(pcs_.VerifyOpeningProof(reader, index, proof));
 }
 
+TEST_F(FRITest, CommitAndVerifyWithConfigs) {
+  struct {
+    FRIConfig config;
+    size_t num_steps;
+  } tests[] = {
+      {{0, 1, 1}, 3},
+      {{1, 1, 1}, 3},
+      {{2, 2, 1}, 2},
+      {{1, 2, 2}, 1},
+      {{3, 3, 4}, 1},
+  };
+
+  for (const auto& test : tests) {
+    SCOPED_TRACE(absl::Substitute(
+        "log_blowup_factor: $0, log_folding_arity: $1, final_poly_size: $2",
+        test.config.log_blowup_factor, test.config.log_folding_arity,
+        test.config.final_poly_size));
+    PCS pcs(domain_.get(), &storage_, &hasher_, test.config);
+    EXPECT_EQ(pcs.GetNumSteps(), test.num_steps);
+
+    Poly poly = Poly::Random(kMaxDegree);
+    base::Uint8VectorBuffer write_buffer;
+    SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+    ASSERT_TRUE(pcs.Commit(poly, &writer));
+
+    std::vector<size_t> indices = base::CreateVector(5, [&pcs]() {
+      return base::Uniform(base::Range<size_t>::Until(pcs.lde_size()));
+    });
+    FRIProof<math::Goldilocks> proof;
+    ASSERT_TRUE(pcs.CreateOpeningProof(indices, &proof));
+
+    SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+    reader.buffer().set_buffer_offset(0);
+    ASSERT_TRUE(pcs.VerifyOpeningProof(reader, indices, proof));
+  }
+}
+
+TEST_F(FRITest, RejectHighDegree) {
+  std::unique_ptr<Domain> domain = Domain::Create(N / 2);
+  PCS pcs(domain.get(), &storage_, &hasher_);
+  Poly poly = Poly::Random(kMaxDegree);
+  base::Uint8VectorBuffer write_buffer;
+  SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+  EXPECT_FALSE(pcs.Commit(poly, &writer));
+}
+
+TEST_F(FRITest, RejectTamperedProof) {
+  PCS pcs(domain_.get(), &storage_, &hasher_, {1, 2, 1});
+  Poly poly = Poly::Random(kMaxDegree);
+  base::Uint8VectorBuffer write_buffer;
+  SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+  ASSERT_TRUE(pcs.Commit(poly, &writer));
+  base::Uint8VectorBuffer buffer = std::move(writer).TakeBuffer();
+
+  std::vector<size_t> indices = {0, 5, 9};
+  FRIProof<math::Goldilocks> proof;
+  ASSERT_TRUE(pcs.CreateOpeningProof(indices, &proof));
+
+  for (size_t i = 0; i < proof.evaluations.size(); ++i) {
+    FRIProof<math::Goldilocks> tampered = proof;
+    tampered.evaluations[i][0] += F::One();
+    SimpleTranscriptReader<F> reader(
+        base::Buffer(buffer.buffer(), buffer.buffer_len()));
+    EXPECT_FALSE(pcs.VerifyOpeningProof(reader, indices, tampered));
+  }
+
+  SimpleTranscriptReader<F> reader(
+      base::Buffer(buffer.buffer(), buffer.buffer_len()));
+  std::vector<size_t> other_indices = {0, 5, 10};
+  EXPECT_FALSE(pcs.VerifyOpeningProof(reader, other_indices, proof));
+}
+
 }  // namespace tachyon::crypto
@@ -14,9 +14,13 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
+#include "tachyon/math/elliptic_curves/msm/precomputed_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
@@ -51,6 +55,27 @@ class KZG {
     return g1_powers_of_tau_lagrange_;
   }
 
+  bool HasPrecomputedMSM() const { return !!precomputed_msm_; }
+
+  // Precomputes the per-window multiples of |g1_powers_of_tau_| and
+  // |g1_powers_of_tau_lagrange_|, so that later commitments skip the doubling
+  // chain of the MSM. The precomputation is shared by the copies of this. It
+  // is dropped when the SRS is set up again and rebuilt when the SRS is
+  // downsized. See |math::PrecomputedMSM|.
+  void PrecomputeMSM() {
+    precomputed_msm_ =
+        std::make_shared<math::PrecomputedMSM<G1Point>>(g1_powers_of_tau_);
+    precomputed_lagrange_msm_ = std::make_shared<math::PrecomputedMSM<G1Point>>(
+        g1_powers_of_tau_lagrange_);
+  }
+
+  void PrecomputeMSM(size_t window_bits) {
+    precomputed_msm_ = std::make_shared<math::PrecomputedMSM<G1Point>>(
+        g1_powers_of_tau_, window_bits);
+    precomputed_lagrange_msm_ = std::make_shared<math::PrecomputedMSM<G1Point>>(
+        g1_powers_of_tau_lagrange_, window_bits);
+  }
+
   void ResizeBatchCommitments(size_t size) { batch_commitments_.resize(size); }
 
   std::vector<Commitment> GetBatchCommitments(BatchCommitmentState& state) {
@@ -73,17 +98,21 @@ class KZG {
   }
 
   [[nodiscard]] bool UnsafeSetup(size_t size, const Field& tau) {
-    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+    precomputed_msm_.reset();
+    precomputed_lagrange_msm_.reset();
+
     using Domain = math::UnivariateEvaluationDomain<Field, kMaxDegree>;
 
-    // |g1_powers_of_tau_| = [𝜏⁰g₁, 𝜏¹g₁, ... , 𝜏ⁿ⁻¹g₁]
+    // Both SRS are multiples of g₁, so they share a single fixed-base table.
     G1Point g1 = G1Point::Generator();
+    math::FixedBaseMSM<G1Point> g1_msm(
+        g1, math::FixedBaseMSM<G1Point>::ComputeWindowBits(2 * size));
+
+    // |g1_powers_of_tau_| = [𝜏⁰g₁, 𝜏¹g₁, ... , 𝜏ⁿ⁻¹g₁]
     std::vector<Field> powers_of_tau = Field::GetSuccessivePowers(size, tau);
-    std::vector<G1JacobianPoint> g1_powers_of_tau_jacobian;
 
     g1_powers_of_tau_.resize(size);
-    if (!G1Point::BatchMapScalarFieldToPoint(g1, powers_of_tau,
-                                             &g1_powers_of_tau_)) {
+    if (!g1_msm.Run(powers_of_tau, &g1_powers_of_tau_)) {
       return false;
     }
 
@@ -91,73 +120,150 @@ class KZG {
     std::unique_ptr<Domain> domain = Domain::Create(size);
     std::vector<Field> lagrange_coeffs =
         domain->EvaluateAllLagrangeCoefficients(tau);
-    std::vector<G1JacobianPoint> g1_powers_of_tau_lagrange_jacobian;
 
     g1_powers_of_tau_lagrange_.resize(size);
-    return G1Point::BatchMapScalarFieldToPoint(g1, lagrange_coeffs,
-                                               &g1_powers_of_tau_lagrange_);
+    return g1_msm.Run(lagrange_coeffs, &g1_powers_of_tau_lagrange_);
   }
 
-  // Return false if |n| >= |N()|.
+  // Return false if |n| >= |N()|. If |PrecomputeMSM()| was called, the
+  // precomputation is rebuilt for the remaining |n| bases with the same window
+  // bits.
   [[nodiscard]] bool Downsize(size_t n) {
     if (n >= N()) return false;
     g1_powers_of_tau_.resize(n);
     g1_powers_of_tau_lagrange_.resize(n);
+    if (precomputed_msm_) {
+      PrecomputeMSM(precomputed_msm_->window_bits());
+    }
     return true;
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v, Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_, v, out);
+    return DoMSM(g1_powers_of_tau_, precomputed_msm_.get(), v, out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v,
                             BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_, v, state, index);
+    return DoMSM(g1_powers_of_tau_, precomputed_msm_.get(), v, state, index);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, out);
+    return DoMSM(g1_powers_of_tau_lagrange_, precomputed_lagrange_msm_.get(),
+                 v, out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, state, index);
+    return DoMSM(g1_powers_of_tau_lagrange_, precomputed_lagrange_msm_.get(),
+                 v, state, index);
+  }
+
+  // Commits to every container in |vs| and stores the commitments in
+  // |batch_commitments_| starting at |start_index|. The MSMs share the
+  // lagrange bases, so they are computed together. See
+  // |VariableBaseMSM::RunBatch()|.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool BatchCommitLagrange(absl::Span<const ScalarContainer> vs,
+                                         BatchCommitmentState& state,
+                                         size_t start_index) {
+    return DoBatchMSM(g1_powers_of_tau_lagrange_,
+                      precomputed_lagrange_msm_.get(), vs, state,
+                      start_index);
   }
 
  private:
   template <typename BaseContainer, typename ScalarContainer>
-  static bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
-                    Commitment* out) {
-    math::VariableBaseMSM<G1Point> msm;
-    absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
-        bases.data(), std::min(bases.size(), scalars.size()));
+  static bool DoMSM(const BaseContainer& bases,
+                    const math::PrecomputedMSM<G1Point>* precomputed_msm,
+                    const ScalarContainer& scalars, Commitment* out) {
     if constexpr (std::is_same_v<Commitment, Bucket>) {
-      return msm.Run(bases_span, scalars, out);
+      return DoMSMInternal(bases, precomputed_msm, scalars, out);
     } else {
       Bucket result;
-      if (!msm.Run(bases_span, scalars, &result)) return false;
+      if (!DoMSMInternal(bases, precomputed_msm, scalars, &result)) {
+        return false;
+      }
       *out = math::ConvertPoint<Commitment>(result);
       return true;
     }
   }
 
   template <typename BaseContainer, typename ScalarContainer>
-  bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
-             BatchCommitmentState& state, size_t index) {
+  bool DoMSM(const BaseContainer& bases,
+             const math::PrecomputedMSM<G1Point>* precomputed_msm,
+             const ScalarContainer& scalars, BatchCommitmentState& state,
+             size_t index) {
+    return DoMSMInternal(bases, precomputed_msm, scalars,
+                         &batch_commitments_[index]);
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  bool DoBatchMSM(const BaseContainer& bases,
+                  const math::PrecomputedMSM<G1Point>* precomputed_msm,
+                  absl::Span<const ScalarContainer> scalars_list,
+                  BatchCommitmentState& state, size_t start_index) {
+    if (scalars_list.empty()) return true;
+    if (start_index + scalars_list.size() > batch_commitments_.size()) {
+      LOG(ERROR) << "Too many commitments: " << start_index << " + "
+                 << scalars_list.size() << " vs "
+                 << batch_commitments_.size();
+      return false;
+    }
+
+    size_t scalars_size = std::size(scalars_list[0]);
+    bool same_size = std::all_of(
+        scalars_list.begin(), scalars_list.end(),
+        [scalars_size](const ScalarContainer& scalars) {
+          return std::size(scalars) == scalars_size;
+        });
+    // NOTE(chokobole): The precomputed MSM doesn't read the bases at all, so
+    // there's nothing to share between the MSMs.
+    if (!same_size || scalars_size > bases.size() ||
+        (precomputed_msm && scalars_size <= precomputed_msm->size())) {
+      for (size_t i = 0; i < scalars_list.size(); ++i) {
+        if (!DoMSMInternal(bases, precomputed_msm, scalars_list[i],
+                           &batch_commitments_[start_index + i])) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    math::VariableBaseMSM<G1Point> msm;
+    absl::Span<const G1Point> bases_span =
+        absl::Span<const G1Point>(bases.data(), scalars_size);
+    std::vector<Bucket> results;
+    if (!msm.RunBatch(bases_span, scalars_list, &results)) return false;
+    std::move(results.begin(), results.end(),
+              batch_commitments_.begin() + start_index);
+    return true;
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  static bool DoMSMInternal(
+      const BaseContainer& bases,
+      const math::PrecomputedMSM<G1Point>* precomputed_msm,
+      const ScalarContainer& scalars, Bucket* out) {
+    if (precomputed_msm && std::size(scalars) <= precomputed_msm->size()) {
+      return precomputed_msm->Run(scalars, out);
+    }
     math::VariableBaseMSM<G1Point> msm;
     absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
         bases.data(), std::min(bases.size(), scalars.size()));
-    return msm.Run(bases_span, scalars, &batch_commitments_[index]);
+    return msm.Run(bases_span, scalars, out);
   }
 
   std::vector<G1Point> g1_powers_of_tau_;
   std::vector<G1Point> g1_powers_of_tau_lagrange_;
   std::vector<Bucket> batch_commitments_;
+  std::shared_ptr<const math::PrecomputedMSM<G1Point>> precomputed_msm_;
+  std::shared_ptr<const math::PrecomputedMSM<G1Point>>
+      precomputed_lagrange_msm_;
 };
 
 }  // namespace crypto
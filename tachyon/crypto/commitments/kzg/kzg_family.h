@@ -10,7 +10,11 @@
 #include <stddef.h>
 
 #include <utility>
+#include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/kzg/kzg.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -28,6 +32,10 @@ class KZGFamily {
 
   size_t N() const { return kzg_.N(); }
 
+  // Precomputes the SRS bases for the commitments.
+  // See |KZG::PrecomputeMSM()|.
+  void PrecomputeMSM() { kzg_.PrecomputeMSM(); }
+
   [[nodiscard]] bool DoUnsafeSetup(size_t size) {
     return DoUnsafeSetup(size, F::Random());
   }
@@ -85,6 +93,17 @@ class KZGFamily {
     return kzg_.CommitLagrange(evals.evaluations(), state, index);
   }
 
+  [[nodiscard]] bool DoBatchCommitLagrange(
+      const std::vector<math::UnivariateEvaluations<F, MaxDegree>>& evals_list,
+      BatchCommitmentState& state, size_t start_index) {
+    std::vector<absl::Span<const F>> scalars_list = base::Map(
+        evals_list, [](const math::UnivariateEvaluations<F, MaxDegree>& evals) {
+          return absl::MakeConstSpan(evals.evaluations());
+        });
+    return kzg_.BatchCommitLagrange(absl::MakeConstSpan(scalars_list), state,
+                                    start_index);
+  }
+
  protected:
   [[nodiscard]] virtual bool DoUnsafeSetupWithTau(size_t size,
                                                   const F& tau) = 0;
@@ -88,6 +88,47 @@ TEST_F(KZGTest, BatchCommitLagrange) {
   EXPECT_EQ(state.batch_count, size_t{0});
 
   EXPECT_EQ(batch_commitments, batch_commitments_lagrange);
+
+  std::vector<absl::Span<const math::bn254::Fr>> scalars_list =
+      base::Map(poly_evals, [](const Evals& evals) {
+        return absl::MakeConstSpan(evals.evaluations());
+      });
+  state.batch_mode = true;
+  state.batch_count = num_polys;
+  pcs.ResizeBatchCommitments(num_polys);
+  ASSERT_TRUE(pcs.BatchCommitLagrange(absl::MakeConstSpan(scalars_list), state,
+                                      0));
+  std::vector<math::bn254::G1AffinePoint> batch_commitments_multi_msm =
+      pcs.GetBatchCommitments(state);
+
+  EXPECT_EQ(batch_commitments, batch_commitments_multi_msm);
+}
+
+TEST_F(KZGTest, PrecomputeMSM) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  Poly poly = Poly::Random(N - 1);
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  Evals poly_evals = domain->FFT(poly);
+
+  math::bn254::G1AffinePoint expected;
+  ASSERT_TRUE(pcs.Commit(poly.coefficients().coefficients(), &expected));
+
+  EXPECT_FALSE(pcs.HasPrecomputedMSM());
+  pcs.PrecomputeMSM();
+  EXPECT_TRUE(pcs.HasPrecomputedMSM());
+
+  math::bn254::G1AffinePoint commit;
+  ASSERT_TRUE(pcs.Commit(poly.coefficients().coefficients(), &commit));
+  EXPECT_EQ(commit, expected);
+
+  math::bn254::G1AffinePoint commit_lagrange;
+  ASSERT_TRUE(pcs.CommitLagrange(poly_evals.evaluations(), &commit_lagrange));
+  EXPECT_EQ(commit_lagrange, expected);
+
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+  EXPECT_FALSE(pcs.HasPrecomputedMSM());
 }
 
 TEST_F(KZGTest, Downsize) {
@@ -98,6 +139,38 @@ TEST_F(KZGTest, Downsize) {
   EXPECT_EQ(pcs.N(), N / 2);
 }
 
+TEST_F(KZGTest, DownsizeAfterPrecomputeMSM) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+  PCS precomputed_pcs = pcs;
+  precomputed_pcs.PrecomputeMSM();
+
+  ASSERT_TRUE(pcs.Downsize(N / 2));
+  ASSERT_TRUE(precomputed_pcs.Downsize(N / 2));
+  EXPECT_TRUE(precomputed_pcs.HasPrecomputedMSM());
+
+  Poly poly = Poly::Random(N / 2 - 1);
+  const std::vector<math::bn254::Fr>& scalars =
+      poly.coefficients().coefficients();
+  math::bn254::G1AffinePoint expected;
+  ASSERT_TRUE(pcs.Commit(scalars, &expected));
+  math::bn254::G1AffinePoint commit;
+  ASSERT_TRUE(precomputed_pcs.Commit(scalars, &commit));
+  EXPECT_EQ(commit, expected);
+
+  ASSERT_TRUE(pcs.CommitLagrange(scalars, &expected));
+  ASSERT_TRUE(precomputed_pcs.CommitLagrange(scalars, &commit));
+  EXPECT_EQ(commit, expected);
+
+  // The bases beyond |N / 2| are gone, so the precomputation can't commit to
+  // more scalars either.
+  Poly large_poly = Poly::Random(N - 1);
+  EXPECT_FALSE(
+      pcs.Commit(large_poly.coefficients().coefficients(), &expected));
+  EXPECT_FALSE(precomputed_pcs.Commit(large_poly.coefficients().coefficients(),
+                                      &commit));
+}
+
 TEST_F(KZGTest, Copyable) {
   PCS expected;
   ASSERT_TRUE(expected.UnsafeSetup(N));
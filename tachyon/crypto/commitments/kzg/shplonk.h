@@ -7,14 +7,22 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_SHPLONK_H_
 #define TACHYON_CRYPTO_COMMITMENTS_KZG_SHPLONK_H_
 
+#include <stdint.h>
+
 #include <array>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+#include "openssl/blake2.h"
+
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/kzg/kzg_family.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
 #include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/pairing/pairing.h"
 
 namespace tachyon {
@@ -48,6 +56,14 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   using Point = typename Poly::Point;
   using PointDeepRef = base::DeepRef<const Point>;
 
+  // The pairing check of an opening proof, e(|p|, [1]₂) * e(|q|, [-𝜏]₂) ≟ gᴛ⁰,
+  // which is deferred so that many of them can be checked at once. See
+  // |VerifyAccumulators()|.
+  struct Accumulator {
+    G1Point p;
+    G1Point q;
+  };
+
   SHPlonk() = default;
   explicit SHPlonk(KZG<G1Point, MaxDegree, Commitment>&& kzg)
       : KZGFamily<G1Point, MaxDegree, Commitment>(std::move(kzg)) {}
@@ -61,6 +77,179 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
     return this->kzg_.GetBatchCommitments(this->batch_commitment_state_);
   }
 
+  // Reads the opening proof of |poly_openings| from |reader| and reduces it to
+  // |accumulator| without computing the pairing.
+  template <typename Container>
+  [[nodiscard]] bool ComputeAccumulator(const Container& poly_openings,
+                                        TranscriptReader<Commitment>* reader,
+                                        Accumulator* accumulator) const {
+    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+
+    Field y = reader->SqueezeChallenge();
+    Field v = reader->SqueezeChallenge();
+
+    Commitment h;
+    if (!reader->ReadFromProof(&h)) return false;
+
+    Field u = reader->SqueezeChallenge();
+
+    Commitment q;
+    if (!reader->ReadFromProof(&q)) return false;
+
+    PolynomialOpeningGrouper<Poly, Commitment> grouper;
+    grouper.GroupByPolyOracleAndPoints(poly_openings);
+
+    // Group |poly_openings| to |grouped_poly_openings_vec|.
+    // {[C₀, C₁, C₂], [x₀, x₁, x₂]}
+    // {[C₃], [x₂, x₃]}
+    // {[C₄], [x₄]}
+    const std::vector<GroupedPolynomialOpenings<Poly, Commitment>>&
+        grouped_poly_openings_vec = grouper.grouped_poly_openings_vec();
+    const absl::btree_set<PointDeepRef>& super_point_set =
+        grouper.super_point_set();
+
+    Field first_z_diff_inverse = Field::Zero();
+    Field first_z = Field::Zero();
+
+    std::vector<G1JacobianPoint> normalized_l_commitments;
+    normalized_l_commitments.reserve(grouped_poly_openings_vec.size());
+    size_t i = 0;
+    for (const auto& [poly_openings_vec, point_refs] :
+         grouped_poly_openings_vec) {
+      // |commitments₀| = [C₀, C₁, C₂]
+      // |commitments₁| = [C₃]
+      // |commitments₂| = [C₄]
+      std::vector<Commitment> commitments = base::Map(
+          poly_openings_vec,
+          [](const PolynomialOpenings<Poly, Commitment>& poly_openings) {
+            return *poly_openings.poly_oracle;
+          });
+      // |points₀| = [x₀, x₁, x₂]
+      // |points₁| = [x₂, x₃]
+      // |points₂| = [x₄]
+      std::vector<Point> points = base::Map(
+          point_refs, [](const PointDeepRef& point_ref) { return *point_ref; });
+      // |diffs₀| = [x₃, x₄]
+      // |diffs₁| = [x₀, x₁, x₄]
+      // |diffs₂| = [x₀, x₁, x₂, x₃]
+      std::vector<Point> diffs;
+      diffs.reserve(super_point_set.size() - point_refs.size());
+      for (const PointDeepRef& point_ref : super_point_set) {
+        if (std::find(point_refs.begin(), point_refs.end(), point_ref) ==
+            point_refs.end()) {
+          diffs.push_back(*point_ref);
+        }
+      }
+
+      // clang-format off
+      // |normalized_z_diff₀| = Zᴛ\₀(u) / Zᴛ\₀(u) = 1
+      // |normalized_z_diff₁| = Zᴛ\₁(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₄) / (u - x₃)(u - x₄)
+      // |normalized_z_diff₂| = Zᴛ\₂(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃) / (u - x₃)(u - x₄)
+      // clang-format on
+      Point normalized_z_diff = Poly::EvaluateVanishingPolyByRoots(diffs, u);
+      if (i == 0) {
+        // Zᴛ = [x₀, x₁, x₂, x₃, x₄]
+        // |first_z| = Z₀(u) = Zᴛ(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₂)
+        first_z = Poly::EvaluateVanishingPolyByRoots(points, u);
+        // Z₀(u)⁻¹ = (u - x₃)(u - x₄)⁻¹
+        first_z_diff_inverse = normalized_z_diff.InverseInPlace();
+        normalized_z_diff = Field::One();
+      } else {
+        normalized_z_diff *= first_z_diff_inverse;
+      }
+
+      // |r_commitments₀| = [[R₀(u)]₁, [R₁(u)]₁, [R₂(u)]₁]
+      // |r_commitments₁| = [[R₃(u)]₁]
+      // |r_commitments₂| = [[R₄(u)]₁]
+      std::vector<G1JacobianPoint> r_commitments = base::Map(
+          poly_openings_vec,
+          [&points,
+           &u](const PolynomialOpenings<Poly, Commitment>& poly_openings) {
+            Poly r;
+            CHECK(
+                math::LagrangeInterpolate(points, poly_openings.openings, &r));
+            return r.Evaluate(u) * G1Point::Generator();
+          });
+
+      // clang-format off
+      // |l_commitment₀| = (C₀ - [R₀(u)]₁) + y(C₁ - [R₁(u)]₁) + y²(C₂ - [R₂(u)]₁)
+      // |l_commitment₁| = C₁ - [R₁(u)]₁
+      // |l_commitment₂| = C₂ - [R₂(u)]₁
+      // clang-format on
+      G1JacobianPoint l_commitment = G1JacobianPoint::Zero();
+      for (size_t j = commitments.size() - 1; j != SIZE_MAX; --j) {
+        l_commitment *= y;
+        l_commitment += (commitments[j] - r_commitments[j]);
+      }
+
+      // clang-format off
+      // |normalized_l_commitments₀| = [L₀(𝜏)]₁ / Zᴛ\₀(u) = (C₀ - [R₀(u)]₁) + y(C₁ - [R₁(u)]₁) + y²(C₂ - [R₂(u)]₁) * Zᴛ\₀(u) / Zᴛ\₀(u)
+      // |normalized_l_commitments₁| = [L₁(𝜏)]₁ / Zᴛ\₀(u) = (C₁ - [R₁(u)]₁) * Zᴛ\₁(u) / Zᴛ\₀(u)
+      // |normalized_l_commitments₂| = [L₂(𝜏)]₁ / Zᴛ\₀(u) = (C₂ - [R₂(u)]₁) * Zᴛ\₂(u) / Zᴛ\₀(u)
+      // clang-format on
+      l_commitment *= normalized_z_diff;
+      normalized_l_commitments.push_back(std::move(l_commitment));
+      ++i;
+    }
+
+    // clang-format off
+    // |p| = ([L₀(𝜏)]₁ + v[L₁(𝜏)]₁ + v²[L₂(𝜏)]₁) / Zᴛ\₀(u) - Z₀(u)[H(𝜏)]₁ + u[Q(𝜏)]₁
+    // clang-format on
+    G1JacobianPoint& p =
+        G1JacobianPoint::template LinearCombinationInPlace</*forward=*/false>(
+            normalized_l_commitments, v);
+
+    p -= (first_z * h);
+    p += (u * q);
+
+    // clang-format off
+    // e(p, [1]₂) * e([Q(𝜏)]₁, [-𝜏]₂) ≟ gᴛ⁰
+    // (L₀(𝜏) + v * L₁(𝜏) + v² * L₂(𝜏)) / Zᴛ\₀(u) - Z₀(u) * H(𝜏) + u * Q(𝜏) - 𝜏 * Q(𝜏) ≟ 0
+    // (L₀(𝜏) + v * L₁(𝜏) + v² * L₂(𝜏)) / Zᴛ\₀(u) - Z₀(u) * H(𝜏) ≟ (𝜏 - u) * Q(𝜏)
+    // (L₀(𝜏) + v * L₁(𝜏) + v² * L₂(𝜏) - Zᴛ(u) * H(𝜏)) / Zᴛ\₀(u) ≟ (𝜏 - u) * Q(𝜏)
+    // L(𝜏) ≟ (𝜏 - u) * Q(𝜏) * Zᴛ\₀(u)
+    // clang-format on
+    *accumulator = {p.ToAffine(), std::move(q)};
+    return true;
+  }
+
+  // e(p, [1]₂) * e(q, [-𝜏]₂) ≟ gᴛ⁰
+  [[nodiscard]] bool VerifyAccumulator(const Accumulator& accumulator) const {
+    G1Point g1_arr[] = {accumulator.p, accumulator.q};
+    return math::Pairing<Curve>(g1_arr, g2_arr_).IsOne();
+  }
+
+  // Checks all |accumulators| with a single multi-Miller loop and a single
+  // final exponentiation. They are combined with weights rᵢ as
+  //
+  //   e(Σ rᵢ * pᵢ, [1]₂) * e(Σ rᵢ * qᵢ, [-𝜏]₂) ≟ gᴛ⁰
+  //
+  // which holds iff every accumulator holds, except with a negligible
+  // probability. It doesn't tell which one is invalid if it fails. The
+  // weights are derived from a BLAKE2b hash of all the accumulators, so that
+  // whoever made the accumulators can't predict them. See
+  // |ComputeAccumulatorWeights()|.
+  [[nodiscard]] bool VerifyAccumulators(
+      absl::Span<const Accumulator> accumulators) const {
+    if (accumulators.empty()) return true;
+    if (accumulators.size() == 1) return VerifyAccumulator(accumulators[0]);
+
+    std::vector<Field> weights = ComputeAccumulatorWeights(accumulators);
+    std::vector<G1Point> ps =
+        base::Map(accumulators,
+                  [](const Accumulator& accumulator) { return accumulator.p; });
+    std::vector<G1Point> qs =
+        base::Map(accumulators,
+                  [](const Accumulator& accumulator) { return accumulator.q; });
+
+    math::VariableBaseMSM<G1Point> msm;
+    typename math::VariableBaseMSM<G1Point>::Bucket p;
+    typename math::VariableBaseMSM<G1Point>::Bucket q;
+    if (!msm.Run(ps, weights, &p)) return false;
+    if (!msm.Run(qs, weights, &q)) return false;
+    return VerifyAccumulator({p.ToAffine(), q.ToAffine()});
+  }
+
  private:
   friend class VectorCommitmentScheme<SHPlonk<Curve, MaxDegree, Commitment>>;
   friend class UnivariatePolynomialCommitmentScheme<
@@ -68,6 +257,48 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   template <typename, size_t, size_t, typename>
   friend class zk::SHPlonkExtension;
 
+  // Returns the weights for |VerifyAccumulators()|. rᵢ is
+  // H(H(p₀, q₀, ..., pₙ₋₁, qₙ₋₁), i), where H is BLAKE2b, which makes them
+  // Fiat-Shamir challenges over all the accumulators.
+  // NOTE(chokobole): The first weight is fixed to one, which doesn't weaken
+  // the check since only the ratios between the weights matter.
+  static std::vector<Field> ComputeAccumulatorWeights(
+      absl::Span<const Accumulator> accumulators) {
+    constexpr static char kPersonal[] = "SHPlonk-Batching";
+    using BaseBigInt = typename G1Point::BaseField::BigIntTy;
+
+    BLAKE2B_CTX state;
+    BLAKE2B512_InitWithPersonal(&state, kPersonal);
+    uint64_t num_accumulators = accumulators.size();
+    BLAKE2B512_Update(&state, &num_accumulators, sizeof(num_accumulators));
+    auto update = [&state](const G1Point& point) {
+      uint8_t infinity = point.infinity();
+      BLAKE2B512_Update(&state, &infinity, sizeof(infinity));
+      BLAKE2B512_Update(&state, point.x().ToBigInt().ToBytesLE().data(),
+                        BaseBigInt::kByteNums);
+      BLAKE2B512_Update(&state, point.y().ToBigInt().ToBytesLE().data(),
+                        BaseBigInt::kByteNums);
+    };
+    for (const Accumulator& accumulator : accumulators) {
+      update(accumulator.p);
+      update(accumulator.q);
+    }
+    uint8_t seed[BLAKE2B512_DIGEST_LENGTH];
+    BLAKE2B512_Final(seed, &state);
+
+    return base::CreateVector(accumulators.size(), [&seed](size_t i) {
+      if (i == 0) return Field::One();
+      BLAKE2B_CTX weight_state;
+      BLAKE2B512_InitWithPersonal(&weight_state, kPersonal);
+      BLAKE2B512_Update(&weight_state, seed, sizeof(seed));
+      uint64_t index = i;
+      BLAKE2B512_Update(&weight_state, &index, sizeof(index));
+      uint8_t result[BLAKE2B512_DIGEST_LENGTH];
+      BLAKE2B512_Final(result, &weight_state);
+      return Field::FromAnySizedBigInt(math::BigInt<8>::FromBytesLE(result));
+    });
+  }
+
   const std::vector<G1Point>& GetG1PowersOfTau() const {
     return this->kzg_.g1_powers_of_tau();
   }
@@ -214,134 +445,9 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   [[nodiscard]] bool DoVerifyOpeningProof(
       const Container& poly_openings,
       TranscriptReader<Commitment>* reader) const {
-    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
-
-    Field y = reader->SqueezeChallenge();
-    Field v = reader->SqueezeChallenge();
-
-    Commitment h;
-    if (!reader->ReadFromProof(&h)) return false;
-
-    Field u = reader->SqueezeChallenge();
-
-    Commitment q;
-    if (!reader->ReadFromProof(&q)) return false;
-
-    PolynomialOpeningGrouper<Poly, Commitment> grouper;
-    grouper.GroupByPolyOracleAndPoints(poly_openings);
-
-    // Group |poly_openings| to |grouped_poly_openings_vec|.
-    // {[C₀, C₁, C₂], [x₀, x₁, x₂]}
-    // {[C₃], [x₂, x₃]}
-    // {[C₄], [x₄]}
-    const std::vector<GroupedPolynomialOpenings<Poly, Commitment>>&
-        grouped_poly_openings_vec = grouper.grouped_poly_openings_vec();
-    const absl::btree_set<PointDeepRef>& super_point_set =
-        grouper.super_point_set();
-
-    Field first_z_diff_inverse = Field::Zero();
-    Field first_z = Field::Zero();
-
-    std::vector<G1JacobianPoint> normalized_l_commitments;
-    normalized_l_commitments.reserve(grouped_poly_openings_vec.size());
-    size_t i = 0;
-    for (const auto& [poly_openings_vec, point_refs] :
-         grouped_poly_openings_vec) {
-      // |commitments₀| = [C₀, C₁, C₂]
-      // |commitments₁| = [C₃]
-      // |commitments₂| = [C₄]
-      std::vector<Commitment> commitments = base::Map(
-          poly_openings_vec,
-          [](const PolynomialOpenings<Poly, Commitment>& poly_openings) {
-            return *poly_openings.poly_oracle;
-          });
-      // |points₀| = [x₀, x₁, x₂]
-      // |points₁| = [x₂, x₃]
-      // |points₂| = [x₄]
-      std::vector<Point> points = base::Map(
-          point_refs, [](const PointDeepRef& point_ref) { return *point_ref; });
-      // |diffs₀| = [x₃, x₄]
-      // |diffs₁| = [x₀, x₁, x₄]
-      // |diffs₂| = [x₀, x₁, x₂, x₃]
-      std::vector<Point> diffs;
-      diffs.reserve(super_point_set.size() - point_refs.size());
-      for (const PointDeepRef& point_ref : super_point_set) {
-        if (std::find(point_refs.begin(), point_refs.end(), point_ref) ==
-            point_refs.end()) {
-          diffs.push_back(*point_ref);
-        }
-      }
-
-      // clang-format off
-      // |normalized_z_diff₀| = Zᴛ\₀(u) / Zᴛ\₀(u) = 1
-      // |normalized_z_diff₁| = Zᴛ\₁(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₄) / (u - x₃)(u - x₄)
-      // |normalized_z_diff₂| = Zᴛ\₂(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃) / (u - x₃)(u - x₄)
-      // clang-format on
-      Point normalized_z_diff = Poly::EvaluateVanishingPolyByRoots(diffs, u);
-      if (i == 0) {
-        // Zᴛ = [x₀, x₁, x₂, x₃, x₄]
-        // |first_z| = Z₀(u) = Zᴛ(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₂)
-        first_z = Poly::EvaluateVanishingPolyByRoots(points, u);
-        // Z₀(u)⁻¹ = (u - x₃)(u - x₄)⁻¹
-        first_z_diff_inverse = normalized_z_diff.InverseInPlace();
-        normalized_z_diff = Field::One();
-      } else {
-        normalized_z_diff *= first_z_diff_inverse;
-      }
-
-      // |r_commitments₀| = [[R₀(u)]₁, [R₁(u)]₁, [R₂(u)]₁]
-      // |r_commitments₁| = [[R₃(u)]₁]
-      // |r_commitments₂| = [[R₄(u)]₁]
-      std::vector<G1JacobianPoint> r_commitments = base::Map(
-          poly_openings_vec,
-          [&points,
-           &u](const PolynomialOpenings<Poly, Commitment>& poly_openings) {
-            Poly r;
-            CHECK(
-                math::LagrangeInterpolate(points, poly_openings.openings, &r));
-            return r.Evaluate(u) * G1Point::Generator();
-          });
-
-      // clang-format off
-      // |l_commitment₀| = (C₀ - [R₀(u)]₁) + y(C₁ - [R₁(u)]₁) + y²(C₂ - [R₂(u)]₁)
-      // |l_commitment₁| = C₁ - [R₁(u)]₁
-      // |l_commitment₂| = C₂ - [R₂(u)]₁
-      // clang-format on
-      G1JacobianPoint l_commitment = G1JacobianPoint::Zero();
-      for (size_t j = commitments.size() - 1; j != SIZE_MAX; --j) {
-        l_commitment *= y;
-        l_commitment += (commitments[j] - r_commitments[j]);
-      }
-
-      // clang-format off
-      // |normalized_l_commitments₀| = [L₀(𝜏)]₁ / Zᴛ\₀(u) = (C₀ - [R₀(u)]₁) + y(C₁ - [R₁(u)]₁) + y²(C₂ - [R₂(u)]₁) * Zᴛ\₀(u) / Zᴛ\₀(u)
-      // |normalized_l_commitments₁| = [L₁(𝜏)]₁ / Zᴛ\₀(u) = (C₁ - [R₁(u)]₁) * Zᴛ\₁(u) / Zᴛ\₀(u)
-      // |normalized_l_commitments₂| = [L₂(𝜏)]₁ / Zᴛ\₀(u) = (C₂ - [R₂(u)]₁) * Zᴛ\₂(u) / Zᴛ\₀(u)
-      // clang-format on
-      l_commitment *= normalized_z_diff;
-      normalized_l_commitments.push_back(std::move(l_commitment));
-      ++i;
-    }
-
-    // clang-format off
-    // |p| = ([L₀(𝜏)]₁ + v[L₁(𝜏)]₁ + v²[L₂(𝜏)]₁) / Zᴛ\₀(u) - Z₀(u)[H(𝜏)]₁ + u[Q(𝜏)]₁
-    // clang-format on
-    G1JacobianPoint& p =
-        G1JacobianPoint::template LinearCombinationInPlace</*forward=*/false>(
-            normalized_l_commitments, v);
-
-    p -= (first_z * h);
-    p += (u * q);
-
-    // clang-format off
-    // e(p, [1]₂) * e([Q(𝜏)]₁, [-𝜏]₂) ≟ gᴛ⁰
-    // (L₀(𝜏) + v * L₁(𝜏) + v² * L₂(𝜏)) / Zᴛ\₀(u) - Z₀(u) * H(𝜏) + u * Q(𝜏) - 𝜏 * Q(𝜏) ≟ 0
-    // (L₀(𝜏) + v * L₁(𝜏) + v² * L₂(𝜏)) / Zᴛ\₀(u) - Z₀(u) * H(𝜏) ≟ (𝜏 - u) * Q(𝜏)
-    // (L₀(𝜏) + v * L₁(𝜏) + v² * L₂(𝜏) - Zᴛ(u) * H(𝜏)) / Zᴛ\₀(u) ≟ (𝜏 - u) * Q(𝜏)
-    // L(𝜏) ≟ (𝜏 - u) * Q(𝜏) * Zᴛ\₀(u)
-    // clang-format on
-    G1Point g1_arr[] = {p.ToAffine(), std::move(q)};
-    return math::Pairing<Curve>(g1_arr, g2_arr_).IsOne();
+    Accumulator accumulator;
+    if (!ComputeAccumulator(poly_openings, reader, &accumulator)) return false;
+    return VerifyAccumulator(accumulator);
   }
 
   // KZGFamily methods
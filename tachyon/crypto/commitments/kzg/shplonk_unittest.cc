@@ -113,4 +113,32 @@ TEST_F(SHPlonkTest, CreateAndVerifyProof) {
   EXPECT_TRUE((pcs_.VerifyOpeningProof(verifier_openings_, &reader)));
 }
 
+TEST_F(SHPlonkTest, VerifyAccumulators) {
+  constexpr size_t kNumProofs = 4;
+
+  std::vector<PCS::Accumulator> accumulators;
+  for (size_t i = 0; i < kNumProofs; ++i) {
+    SimpleTranscriptWriter<Commitment> writer((base::Uint8VectorBuffer()));
+    ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings_, &writer));
+
+    base::Buffer read_buf(writer.buffer().buffer(),
+                          writer.buffer().buffer_len());
+    SimpleTranscriptReader<Commitment> reader(std::move(read_buf));
+    PCS::Accumulator accumulator;
+    ASSERT_TRUE(
+        pcs_.ComputeAccumulator(verifier_openings_, &reader, &accumulator));
+    EXPECT_TRUE(pcs_.VerifyAccumulator(accumulator));
+    accumulators.push_back(std::move(accumulator));
+  }
+  EXPECT_TRUE(pcs_.VerifyAccumulators(accumulators));
+
+  accumulators[2].p = (accumulators[2].p + Commitment::Generator()).ToAffine();
+  EXPECT_FALSE(pcs_.VerifyAccumulator(accumulators[2]));
+  EXPECT_FALSE(pcs_.VerifyAccumulators(accumulators));
+
+  // The errors cancel out if the weights are all one.
+  accumulators[3].p = (accumulators[3].p - Commitment::Generator()).ToAffine();
+  EXPECT_FALSE(pcs_.VerifyAccumulators(accumulators));
+}
+
 }  // namespace tachyon::crypto
@@ -4,6 +4,10 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_HASHER_H_
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_HASHER_H_
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+
 namespace tachyon::crypto {
 
 template <typename Leaf, typename Hash>
@@ -14,6 +18,18 @@ class BinaryMerkleHasher {
   virtual Hash ComputeLeafHash(const Leaf& leaf) const = 0;
 
   virtual Hash ComputeParentHash(const Hash& left, const Hash& right) const = 0;
+
+  // Computes the hashes of |parents.size()| parents at once, where
+  // |children[2 * i]| and |children[2 * i + 1]| are the left and the right
+  // child of |parents[i]|. Override this if the hasher can process many nodes
+  // faster than one by one.
+  virtual void ComputeParentHashes(absl::Span<const Hash> children,
+                                   absl::Span<Hash> parents) const {
+    CHECK_EQ(children.size(), 2 * parents.size());
+    for (size_t i = 0; i < parents.size(); ++i) {
+      parents[i] = ComputeParentHash(children[2 * i], children[2 * i + 1]);
+    }
+  }
 };
 
 }  // namespace tachyon::crypto
@@ -4,6 +4,8 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
 
+#include <stddef.h>
+
 #include <vector>
 
 namespace tachyon::crypto {
@@ -33,6 +35,31 @@ struct BinaryMerkleProof {
   }
 };
 
+// A proof for multiple leaves of a tree at once. It holds only the sibling
+// hashes that can't be computed from the opened leaves, level by level from
+// the leaves to the root, and in the order of the node index in each level.
+template <typename Hash>
+struct BinaryMerkleMultiProof {
+  std::vector<Hash> hashes;
+
+  bool operator==(const BinaryMerkleMultiProof& other) const {
+    return hashes == other.hashes;
+  }
+  bool operator!=(const BinaryMerkleMultiProof& other) const {
+    return hashes != other.hashes;
+  }
+};
+
+// The leaves to be verified against a |BinaryMerkleMultiProof|.
+template <typename Hash>
+struct BinaryMerkleMultiOpening {
+  size_t leaves_size = 0;
+  // The indices of the leaves, which must be sorted without duplicates.
+  std::vector<size_t> indices;
+  // |leaf_hashes[i]| is the hash of the leaf at |indices[i]|.
+  std::vector<Hash> leaf_hashes;
+};
+
 }  // namespace tachyon::crypto
 
 #endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
@@ -8,9 +8,11 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/numerics/checked_math.h"
 #include "tachyon/base/openmp_util.h"
@@ -120,6 +122,112 @@ class BinaryMerkleTree final
     return hash == root;
   }
 
+  // Creates a proof for the leaves at |indices|, which must be sorted without
+  // duplicates. A sibling is added to the proof only if it isn't on the path
+  // of another opened leaf, so the shared upper paths are sent only once.
+  [[nodiscard]] bool DoCreateOpeningProof(
+      const std::vector<size_t>& indices,
+      BinaryMerkleMultiProof<Hash>* proof) const {
+    size_t leaves_size = (storage_->GetSize() + 1) >> 1;
+    if (!ValidateIndices(indices, leaves_size)) return false;
+
+    // The nodes are indexed as in |DoCommit()|, where the children of the
+    // node i are 2i + 1 and 2i + 2.
+    std::vector<size_t> nodes =
+        base::Map(indices, [leaves_size](size_t index) {
+          return leaves_size - 1 + index;
+        });
+    proof->hashes.clear();
+    while (nodes.front() != 0) {
+      std::vector<size_t> parents;
+      parents.reserve(nodes.size());
+      for (size_t i = 0; i < nodes.size(); ++i) {
+        size_t node = nodes[i];
+        size_t sibling = node % 2 == 1 ? node + 1 : node - 1;
+        if (i + 1 < nodes.size() && nodes[i + 1] == sibling) {
+          ++i;
+        } else {
+          proof->hashes.push_back(storage_->GetHash(sibling));
+        }
+        parents.push_back((node - 1) >> 1);
+      }
+      nodes = std::move(parents);
+    }
+    return true;
+  }
+
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Hash& root, const BinaryMerkleMultiOpening<Hash>& opening,
+      const BinaryMerkleMultiProof<Hash>& proof) const {
+    if (!base::bits::IsPowerOfTwo(opening.leaves_size)) {
+      LOG(ERROR) << opening.leaves_size << " is not a power of two";
+      return false;
+    }
+    if (opening.indices.size() != opening.leaf_hashes.size()) {
+      LOG(ERROR) << "Size of |indices| and |leaf_hashes| do not match";
+      return false;
+    }
+    if (!ValidateIndices(opening.indices, opening.leaves_size)) return false;
+
+    std::vector<size_t> nodes =
+        base::Map(opening.indices, [&opening](size_t index) {
+          return opening.leaves_size - 1 + index;
+        });
+    std::vector<Hash> hashes = opening.leaf_hashes;
+    size_t proof_idx = 0;
+    while (nodes.front() != 0) {
+      std::vector<size_t> parents;
+      std::vector<Hash> parent_hashes;
+      parents.reserve(nodes.size());
+      parent_hashes.reserve(nodes.size());
+      for (size_t i = 0; i < nodes.size(); ++i) {
+        size_t node = nodes[i];
+        const Hash& hash = hashes[i];
+        bool is_left = node % 2 == 1;
+        const Hash* sibling_hash;
+        if (is_left && i + 1 < nodes.size() && nodes[i + 1] == node + 1) {
+          sibling_hash = &hashes[++i];
+        } else {
+          if (proof_idx == proof.hashes.size()) {
+            LOG(ERROR) << "Proof is too short";
+            return false;
+          }
+          sibling_hash = &proof.hashes[proof_idx++];
+        }
+        parent_hashes.push_back(
+            is_left ? hasher_->ComputeParentHash(hash, *sibling_hash)
+                    : hasher_->ComputeParentHash(*sibling_hash, hash));
+        parents.push_back((node - 1) >> 1);
+      }
+      nodes = std::move(parents);
+      hashes = std::move(parent_hashes);
+    }
+    if (proof_idx != proof.hashes.size()) {
+      LOG(ERROR) << "Proof is too long";
+      return false;
+    }
+    return hashes[0] == root;
+  }
+
+  static bool ValidateIndices(const std::vector<size_t>& indices,
+                              size_t leaves_size) {
+    if (indices.empty()) {
+      LOG(ERROR) << "No leaves to open";
+      return false;
+    }
+    for (size_t i = 0; i < indices.size(); ++i) {
+      if (indices[i] >= leaves_size) {
+        LOG(ERROR) << "Leaf index " << indices[i] << " is out of range";
+        return false;
+      }
+      if (i > 0 && indices[i - 1] >= indices[i]) {
+        LOG(ERROR) << "Leaf indices are not sorted or duplicated";
+        return false;
+      }
+    }
+    return true;
+  }
+
   template <typename Container>
   bool FillLeaves(const Container& leaves) const {
     size_t leaves_size = std::size(leaves);
@@ -140,12 +248,22 @@ class BinaryMerkleTree final
     return true;
   }
 
+  // Each level is hashed with a single |ComputeParentHashes()| call.
   void BuildTreeFromLeaves(base::Range<size_t> range) const {
+    std::vector<Hash> children;
+    std::vector<Hash> parents;
     while (range.GetSize() > 0) {
-      for (size_t i = range.from; i < range.to; i += 2) {
-        storage_->SetHash(i >> 1,
-                          hasher_->ComputeParentHash(storage_->GetHash(i),
-                                                     storage_->GetHash(i + 1)));
+      // NOTE(chokobole): |range.to| is exclusive for the left children, so
+      // the last pair may start at |range.to - 1|.
+      size_t num_parents = (range.GetSize() + 1) >> 1;
+      parents.resize(num_parents);
+      children.resize(num_parents << 1);
+      for (size_t i = 0; i < children.size(); ++i) {
+        children[i] = storage_->GetHash(range.from + i);
+      }
+      hasher_->ComputeParentHashes(children, absl::MakeSpan(parents));
+      for (size_t i = 0; i < parents.size(); ++i) {
+        storage_->SetHash((range.from >> 1) + i, parents[i]);
       }
       range = base::Range<size_t>(range.from >> 1, (range.to >> 1) - 1);
     }
@@ -111,4 +111,39 @@ TEST_F(BinaryMerkleTreeTest, CommitAndVerify) {
   ASSERT_TRUE(vcs_.VerifyOpeningProof(commitment, leaf_hash, proof));
 }
 
+TEST_F(BinaryMerkleTreeTest, CommitAndVerifyMultiOpening) {
+  CreateLeaves();
+
+  int commitment;
+  ASSERT_TRUE(vcs_.Commit(leaves_, &commitment));
+
+  std::vector<size_t> indices = {1, 2, 3, 6};
+  BinaryMerkleMultiProof<int> proof;
+  ASSERT_TRUE(vcs_.CreateOpeningProof(indices, &proof));
+
+  // The leaves 2 and 3 share their parent, and so do the subtrees of the
+  // leaves 1 and 2 ~ 3.
+  BinaryMerkleMultiProof<int> expected_proof;
+  expected_proof.hashes = {0, 7, 14};
+  EXPECT_EQ(proof, expected_proof);
+
+  BinaryMerkleMultiOpening<int> opening;
+  opening.leaves_size = N;
+  opening.indices = indices;
+  opening.leaf_hashes = base::Map(
+      indices, [this](size_t index) { return hasher_.ComputeLeafHash(index); });
+  ASSERT_TRUE(vcs_.VerifyOpeningProof(commitment, opening, proof));
+
+  opening.leaf_hashes[3] += 1;
+  EXPECT_FALSE(vcs_.VerifyOpeningProof(commitment, opening, proof));
+  opening.leaf_hashes[3] -= 1;
+
+  BinaryMerkleMultiProof<int> short_proof = proof;
+  short_proof.hashes.pop_back();
+  EXPECT_FALSE(vcs_.VerifyOpeningProof(commitment, opening, short_proof));
+
+  std::vector<size_t> unsorted_indices = {2, 1};
+  EXPECT_FALSE(vcs_.CreateOpeningProof(unsorted_indices, &proof));
+}
+
 }  // namespace tachyon::crypto
@@ -0,0 +1,83 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON_BINARY_MERKLE_HASHER_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON_BINARY_MERKLE_HASHER_H_
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_hasher.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_batch_permutation.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config.h"
+
+namespace tachyon::crypto {
+
+// |PoseidonBinaryMerkleHasher| hashes the nodes with a Poseidon sponge. A leaf
+// hash is the output of a sponge that absorbs the leaf and a parent hash is
+// the output of a sponge that absorbs the left and the right child. The
+// parents of a level are hashed together by |PoseidonBatchPermutation|.
+template <typename F>
+class PoseidonBinaryMerkleHasher final : public BinaryMerkleHasher<F, F> {
+ public:
+  explicit PoseidonBinaryMerkleHasher(const PoseidonConfig<F>& config)
+      : config_(config) {
+    CHECK_GE(config_.rate, size_t{2});
+  }
+  explicit PoseidonBinaryMerkleHasher(PoseidonConfig<F>&& config)
+      : config_(std::move(config)) {
+    CHECK_GE(config_.rate, size_t{2});
+  }
+
+  const PoseidonConfig<F>& config() const { return config_; }
+
+  // BinaryMerkleHasher<F, F> methods
+  F ComputeLeafHash(const F& leaf) const override {
+    F inputs[] = {leaf};
+    return Hash(inputs);
+  }
+
+  F ComputeParentHash(const F& left, const F& right) const override {
+    F inputs[] = {left, right};
+    return Hash(inputs);
+  }
+
+  void ComputeParentHashes(absl::Span<const F> children,
+                           absl::Span<F> parents) const override {
+    CHECK_EQ(children.size(), 2 * parents.size());
+    size_t num_states = parents.size();
+    if (num_states == 0) return;
+
+    PoseidonBatchPermutation<F> permutation(config_);
+    std::vector<F> states(permutation.width() * num_states, F::Zero());
+    absl::Span<F> lefts = absl::MakeSpan(states).subspan(
+        config_.capacity * num_states, num_states);
+    absl::Span<F> rights = absl::MakeSpan(states).subspan(
+        (config_.capacity + 1) * num_states, num_states);
+    for (size_t i = 0; i < num_states; ++i) {
+      lefts[i] = children[2 * i];
+      rights[i] = children[2 * i + 1];
+    }
+    permutation.Permute(num_states, absl::MakeSpan(states));
+    for (size_t i = 0; i < num_states; ++i) {
+      parents[i] = std::move(lefts[i]);
+    }
+  }
+
+ private:
+  F Hash(absl::Span<const F> inputs) const {
+    PoseidonBatchPermutation<F> permutation(config_);
+    std::vector<F> state(permutation.width(), F::Zero());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      state[config_.capacity + i] = inputs[i];
+    }
+    permutation.Permute(1, absl::MakeSpan(state));
+    return std::move(state[config_.capacity]);
+  }
+
+  PoseidonConfig<F> config_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON_BINARY_MERKLE_HASHER_H_
@@ -0,0 +1,63 @@
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/poseidon_binary_merkle_hasher.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+class PoseidonBinaryMerkleHasherTest : public testing::Test {
+ public:
+  using F = math::bn254::Fr;
+
+  static void SetUpTestSuite() { F::Init(); }
+
+  void SetUp() override {
+    config_ = PoseidonConfig<F>::CreateDefault(2, false);
+  }
+
+ protected:
+  PoseidonConfig<F> config_;
+};
+
+}  // namespace
+
+TEST_F(PoseidonBinaryMerkleHasherTest, ComputeHash) {
+  PoseidonBinaryMerkleHasher<F> hasher(config_);
+
+  F leaf = F::Random();
+  PoseidonSponge<F> sponge(config_);
+  ASSERT_TRUE(sponge.Absorb(leaf));
+  EXPECT_EQ(hasher.ComputeLeafHash(leaf),
+            sponge.SqueezeNativeFieldElements(1)[0]);
+
+  F left = F::Random();
+  F right = F::Random();
+  sponge = PoseidonSponge<F>(config_);
+  ASSERT_TRUE(sponge.Absorb(std::vector<F>{left, right}));
+  EXPECT_EQ(hasher.ComputeParentHash(left, right),
+            sponge.SqueezeNativeFieldElements(1)[0]);
+}
+
+TEST_F(PoseidonBinaryMerkleHasherTest, ComputeParentHashes) {
+  PoseidonBinaryMerkleHasher<F> hasher(config_);
+
+  size_t num_parents = 7;
+  std::vector<F> children =
+      base::CreateVector(2 * num_parents, []() { return F::Random(); });
+  std::vector<F> parents(num_parents);
+  hasher.ComputeParentHashes(children, absl::MakeSpan(parents));
+
+  for (size_t i = 0; i < num_parents; ++i) {
+    EXPECT_EQ(parents[i],
+              hasher.ComputeParentHash(children[2 * i], children[2 * i + 1]));
+  }
+}
+
+}  // namespace tachyon::crypto
@@ -3,6 +3,8 @@
 
 #include <stddef.h>
 
+#include <vector>
+
 #include "tachyon/crypto/commitments/vector_commitment_scheme.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -64,6 +66,20 @@ class UnivariatePolynomialCommitmentScheme
     return derived->DoCommitLagrange(evals, derived->batch_commitment_state(),
                                      index);
   }
+
+  // Commit to every evaluations in |evals_list| and stores the commitments in
+  // |batch_commitments_| starting at |start_index| if |batch_mode| is true.
+  // Return false if the degree of any of |evals_list| exceeds |kMaxDegree|.
+  // It terminates when |batch_mode| is false.
+  template <typename T = Derived, std::enable_if_t<VectorCommitmentSchemeTraits<
+                                      T>::kSupportsBatchMode>* = nullptr>
+  [[nodiscard]] bool BatchCommitLagrange(const std::vector<Evals>& evals_list,
+                                         size_t start_index) {
+    Derived* derived = static_cast<Derived*>(this);
+    CHECK(derived->GetBatchMode());
+    return derived->DoBatchCommitLagrange(
+        evals_list, derived->batch_commitment_state(), start_index);
+  }
 };
 
 }  // namespace tachyon::crypto
@@ -23,6 +23,8 @@ namespace tachyon::crypto {
 //   1. Apply ARK (addition of round constants) to |state|.
 //   2. Apply S-Box (xᵅ) to |state|.
 //   3. Apply MDS matrix to |state|.
+//   If |config.optimized_constants| is available, the partial rounds are
+//   computed with sparse matrices instead.
 // Squeeze: Squeeze elements out of the sponge.
 // This implementation of Poseidon is entirely Fractal's implementation in
 // [COS20][cos] with small syntax changes. See https://eprint.iacr.org/2019/1076
@@ -68,16 +70,33 @@ struct PoseidonSponge
   PoseidonSponge(const PoseidonConfig<F>& config, State&& state)
       : config(config), state(std::move(state)) {}
 
+  // Returns xᵅ. The S-Boxes commonly used are computed with fixed addition
+  // chains.
+  static F SBox(uint64_t alpha, const F& x) {
+    switch (alpha) {
+      case 3:
+        return x.Square() * x;
+      case 5:
+        return x.Square().Square() * x;
+      case 7: {
+        F x3 = x.Square() * x;
+        return x3.Square() * x;
+      }
+      default:
+        return x.Pow(alpha);
+    }
+  }
+
   void ApplySBox(bool is_full_round) {
     if (is_full_round) {
       // Full rounds apply the S-Box (xᵅ) to every element of |state|.
       for (F& elem : state.elements) {
-        elem = elem.Pow(config.alpha);
+        elem = SBox(config.alpha, elem);
       }
     } else {
       // Partial rounds apply the S-Box (xᵅ) to just the first element of
       // |state|.
-      state[0] = state[0].Pow(config.alpha);
+      state[0] = SBox(config.alpha, state[0]);
     }
   }
 
@@ -94,11 +113,15 @@ struct PoseidonSponge
       ApplySBox(true);
       ApplyMDS();
     }
-    for (size_t i = full_rounds_over_2;
-         i < full_rounds_over_2 + config.partial_rounds; ++i) {
-      ApplyARK(i);
-      ApplySBox(false);
-      ApplyMDS();
+    if (config.optimized_constants.IsEmpty()) {
+      for (size_t i = full_rounds_over_2;
+           i < full_rounds_over_2 + config.partial_rounds; ++i) {
+        ApplyARK(i);
+        ApplySBox(false);
+        ApplyMDS();
+      }
+    } else {
+      ApplyOptimizedPartialRounds();
     }
     for (size_t i = full_rounds_over_2 + config.partial_rounds;
          i < config.partial_rounds + config.full_rounds; ++i) {
@@ -108,6 +131,21 @@ struct PoseidonSponge
     }
   }
 
+  // Computes the partial rounds using |config.optimized_constants|. See
+  // poseidon_optimized_constants.h.
+  void ApplyOptimizedPartialRounds() {
+    const PoseidonOptimizedConstants<F>& constants = config.optimized_constants;
+    state.elements += constants.first_partial_round_constants;
+    state.elements = constants.pre_sparse_mds * state.elements;
+    for (size_t i = 0; i < config.partial_rounds; ++i) {
+      state[0] = SBox(config.alpha, state[0]);
+      if (i < config.partial_rounds - 1) {
+        state[0] += constants.partial_round_constants[i];
+      }
+      constants.sparse_mds[i].Apply(state.elements);
+    }
+  }
+
   // Absorbs everything in |elements|, this does not end in an absorbing.
   void AbsorbInternal(size_t rate_start_index, const std::vector<F>& elements) {
     size_t elements_idx = 0;
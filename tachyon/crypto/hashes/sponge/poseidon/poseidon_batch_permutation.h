@@ -0,0 +1,157 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_BATCH_PERMUTATION_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_BATCH_PERMUTATION_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config.h"
+
+namespace tachyon::crypto {
+
+// |PoseidonBatchPermutation| applies the Poseidon permutation to many
+// independent states at once. The states are stored in structure-of-arrays
+// layout: |states[i * num_states + j]| is the i-th element of the j-th state.
+// Every step of a round is then a loop over the states without dependencies
+// between iterations, which the compiler can interleave and vectorize.
+template <typename F>
+class PoseidonBatchPermutation {
+ public:
+  explicit PoseidonBatchPermutation(const PoseidonConfig<F>& config)
+      : config_(config), width_(config.rate + config.capacity) {}
+
+  size_t width() const { return width_; }
+
+  // Permutes the |num_states| states in |states|.
+  void Permute(size_t num_states, absl::Span<F> states) {
+    CHECK_EQ(states.size(), width_ * num_states);
+    if (num_states == 0) return;
+    num_states_ = num_states;
+    states_ = states;
+    scratch_.resize(width_ * num_states_);
+
+    size_t full_rounds_over_2 = config_.full_rounds / 2;
+    for (size_t i = 0; i < full_rounds_over_2; ++i) {
+      ApplyFullRound(i);
+    }
+    if (config_.optimized_constants.IsEmpty()) {
+      for (size_t i = full_rounds_over_2;
+           i < full_rounds_over_2 + config_.partial_rounds; ++i) {
+        ApplyARK(i);
+        ApplySBox(Row(0));
+        ApplyMDS(config_.mds);
+      }
+    } else {
+      ApplyOptimizedPartialRounds();
+    }
+    for (size_t i = full_rounds_over_2 + config_.partial_rounds;
+         i < config_.partial_rounds + config_.full_rounds; ++i) {
+      ApplyFullRound(i);
+    }
+  }
+
+ private:
+  // Returns the |i|-th elements of all the states.
+  absl::Span<F> Row(size_t i) {
+    return states_.subspan(i * num_states_, num_states_);
+  }
+
+  void ApplyFullRound(size_t round) {
+    ApplyARK(round);
+    for (size_t i = 0; i < width_; ++i) {
+      ApplySBox(Row(i));
+    }
+    ApplyMDS(config_.mds);
+  }
+
+  void ApplyARK(size_t round) {
+    for (size_t i = 0; i < width_; ++i) {
+      const F& constant = config_.ark(round, i);
+      for (F& elem : Row(i)) {
+        elem += constant;
+      }
+    }
+  }
+
+  void ApplySBox(absl::Span<F> row) {
+    uint64_t alpha = config_.alpha;
+    for (F& elem : row) {
+      elem = PoseidonSponge<F>::SBox(alpha, elem);
+    }
+  }
+
+  void ApplyMDS(const math::Matrix<F>& matrix) {
+    for (size_t i = 0; i < width_; ++i) {
+      absl::Span<F> out =
+          absl::MakeSpan(scratch_).subspan(i * num_states_, num_states_);
+      const F& m_i0 = matrix(i, 0);
+      absl::Span<F> row = Row(0);
+      for (size_t k = 0; k < num_states_; ++k) {
+        out[k] = m_i0 * row[k];
+      }
+      for (size_t j = 1; j < width_; ++j) {
+        const F& m_ij = matrix(i, j);
+        row = Row(j);
+        for (size_t k = 0; k < num_states_; ++k) {
+          out[k] += m_ij * row[k];
+        }
+      }
+    }
+    std::copy(scratch_.begin(), scratch_.end(), states_.begin());
+  }
+
+  void ApplyOptimizedPartialRounds() {
+    const PoseidonOptimizedConstants<F>& constants =
+        config_.optimized_constants;
+    for (size_t i = 0; i < width_; ++i) {
+      const F& constant = constants.first_partial_round_constants[i];
+      for (F& elem : Row(i)) {
+        elem += constant;
+      }
+    }
+    ApplyMDS(constants.pre_sparse_mds);
+
+    absl::Span<F> first = Row(0);
+    absl::Span<F> new_first =
+        absl::MakeSpan(scratch_).subspan(0, num_states_);
+    for (size_t r = 0; r < config_.partial_rounds; ++r) {
+      ApplySBox(first);
+      if (r < config_.partial_rounds - 1) {
+        const F& constant = constants.partial_round_constants[r];
+        for (F& elem : first) {
+          elem += constant;
+        }
+      }
+
+      const PoseidonSparseMDSMatrix<F>& sparse = constants.sparse_mds[r];
+      for (size_t k = 0; k < num_states_; ++k) {
+        new_first[k] = sparse.m00 * first[k];
+      }
+      for (size_t j = 1; j < width_; ++j) {
+        const F& r_j = sparse.row[j - 1];
+        const F& c_j = sparse.col[j - 1];
+        absl::Span<F> row = Row(j);
+        for (size_t k = 0; k < num_states_; ++k) {
+          new_first[k] += r_j * row[k];
+          row[k] += c_j * first[k];
+        }
+      }
+      std::copy(new_first.begin(), new_first.end(), first.begin());
+    }
+  }
+
+  const PoseidonConfig<F>& config_;
+  size_t width_;
+  size_t num_states_ = 0;
+  absl::Span<F> states_;
+  std::vector<F> scratch_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_BATCH_PERMUTATION_H_
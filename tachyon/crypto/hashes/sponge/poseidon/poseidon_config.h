@@ -11,6 +11,7 @@
 #include "tachyon/base/logging.h"
 #include "tachyon/base/ranges/algorithm.h"
 #include "tachyon/crypto/hashes/sponge/poseidon/grain_lfsr.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_optimized_constants.h"
 
 namespace tachyon::crypto {
 
@@ -149,6 +150,10 @@ struct PoseidonConfig {
   // The capacity (in terms of number of field elements).
   size_t capacity = 0;
 
+  // Constants to compute the partial rounds with sparse matrices. If this is
+  // empty, |PoseidonSponge| applies |ark| and |mds| as they are.
+  PoseidonOptimizedConstants<PrimeField> optimized_constants;
+
   static PoseidonConfig CreateDefault(size_t rate, bool optimized_for_weights) {
     absl::Span<const PoseidonConfigEntry> param_set =
         optimized_for_weights
@@ -164,6 +169,7 @@ struct PoseidonConfig {
     FindPoseidonArkAndMds<PrimeField>(
         it->template ToPoseidonGrainLFSRConfig<PrimeField>(), it->skip_matrices,
         &ret.ark, &ret.mds);
+    ret.PrecomputeOptimizedConstants();
     return ret;
   }
 
@@ -177,9 +183,22 @@ struct PoseidonConfig {
     FindPoseidonArkAndMds<PrimeField>(
         config_entry.ToPoseidonGrainLFSRConfig<PrimeField>(), skip_matrices,
         &ret.ark, &ret.mds);
+    ret.PrecomputeOptimizedConstants();
     return ret;
   }
 
+  // Computes |optimized_constants| from |ark| and |mds|. This must be called
+  // again whenever |ark| or |mds| is changed. Returns false if the optimized
+  // form is not available, in which case |optimized_constants| is cleared.
+  bool PrecomputeOptimizedConstants() {
+    if (!PoseidonOptimizedConstants<PrimeField>::Create(
+            ark, mds, full_rounds, partial_rounds, &optimized_constants)) {
+      optimized_constants = PoseidonOptimizedConstants<PrimeField>();
+      return false;
+    }
+    return true;
+  }
+
   bool IsValid() const {
     return static_cast<size_t>(ark.rows()) == full_rounds + partial_rounds &&
            static_cast<size_t>(ark.cols()) == rate + capacity &&
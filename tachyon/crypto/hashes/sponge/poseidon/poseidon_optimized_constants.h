@@ -0,0 +1,198 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_OPTIMIZED_CONSTANTS_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_OPTIMIZED_CONSTANTS_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/matrix/matrix_types.h"
+#include "tachyon/math/matrix/prime_field_num_traits.h"
+
+namespace tachyon::crypto {
+namespace internal {
+
+// Computes the inverse of |matrix| using Gauss-Jordan elimination.
+// Returns false if |matrix| is not invertible.
+template <typename F>
+[[nodiscard]] bool InvertMatrix(const math::Matrix<F>& matrix,
+                                math::Matrix<F>* inverse) {
+  CHECK_EQ(matrix.rows(), matrix.cols());
+  Eigen::Index n = matrix.rows();
+  math::Matrix<F> a = matrix;
+  math::Matrix<F> ret(n, n);
+  for (Eigen::Index i = 0; i < n; ++i) {
+    for (Eigen::Index j = 0; j < n; ++j) {
+      ret(i, j) = i == j ? F::One() : F::Zero();
+    }
+  }
+
+  for (Eigen::Index col = 0; col < n; ++col) {
+    Eigen::Index pivot = col;
+    while (pivot < n && a(pivot, col).IsZero()) {
+      ++pivot;
+    }
+    if (pivot == n) return false;
+    if (pivot != col) {
+      a.row(pivot).swap(a.row(col));
+      ret.row(pivot).swap(ret.row(col));
+    }
+
+    F pivot_inv = a(col, col).Inverse();
+    for (Eigen::Index j = 0; j < n; ++j) {
+      a(col, j) *= pivot_inv;
+      ret(col, j) *= pivot_inv;
+    }
+
+    for (Eigen::Index row = 0; row < n; ++row) {
+      if (row == col) continue;
+      F factor = a(row, col);
+      if (factor.IsZero()) continue;
+      for (Eigen::Index j = 0; j < n; ++j) {
+        a(row, j) -= factor * a(col, j);
+        ret(row, j) -= factor * ret(col, j);
+      }
+    }
+  }
+  *inverse = std::move(ret);
+  return true;
+}
+
+}  // namespace internal
+
+// |PoseidonSparseMDSMatrix| is a t x t matrix of the following form:
+//
+//   | m₀₀  r₁  r₂  ... rₜ₋₁ |
+//   | c₁   1   0   ... 0    |
+//   | c₂   0   1   ... 0    |
+//   | ...                   |
+//   | cₜ₋₁ 0   0   ... 1    |
+//
+// Multiplying it by the state takes 2t - 1 multiplications instead of t².
+template <typename F>
+struct PoseidonSparseMDSMatrix {
+  F m00;
+  // (r₁, ..., rₜ₋₁)
+  math::RowVector<F> row;
+  // (c₁, ..., cₜ₋₁)
+  math::Vector<F> col;
+
+  // |state| = M * |state|
+  void Apply(math::Vector<F>& state) const {
+    F first = m00 * state[0];
+    for (Eigen::Index i = 0; i < row.size(); ++i) {
+      first += row[i] * state[i + 1];
+    }
+    for (Eigen::Index i = 0; i < col.size(); ++i) {
+      state[i + 1] += col[i] * state[0];
+    }
+    state[0] = std::move(first);
+  }
+};
+
+// |PoseidonOptimizedConstants| holds the constants used to compute the partial
+// rounds of Poseidon in the optimized form described in the appendix B of the
+// Poseidon paper. See https://eprint.iacr.org/2019/458.pdf
+//
+// In a partial round, the S-Box is applied to the first element of the state
+// only, so the two rewrites below are possible without changing the output.
+//
+// 1. The round constants of the partial rounds except the first one are
+//    moved up through the inverse of the MDS matrix, so that only a single
+//    constant has to be added to the first element of the state per round.
+// 2. The MDS matrix M of each partial round is factored into M' * M'', where
+//    M'' is sparse and M' = diag(1, M̂) is moved to the previous round. The
+//    M' of the first partial round is applied once before the partial
+//    rounds.
+template <typename F>
+struct PoseidonOptimizedConstants {
+  // Constants added to the whole state before the first partial round.
+  math::Vector<F> first_partial_round_constants;
+  // |partial_round_constants[i]| is added to the first element of the state
+  // right after the S-Box of the i-th partial round. The last partial round
+  // doesn't have one.
+  std::vector<F> partial_round_constants;
+  // The dense matrix applied before the first partial round.
+  math::Matrix<F> pre_sparse_mds;
+  // |sparse_mds[i]| is used instead of the MDS matrix in the i-th partial
+  // round.
+  std::vector<PoseidonSparseMDSMatrix<F>> sparse_mds;
+
+  bool IsEmpty() const { return sparse_mds.empty(); }
+
+  // Returns false if the constants can't be computed from |ark| and |mds|.
+  [[nodiscard]] static bool Create(const math::Matrix<F>& ark,
+                                   const math::Matrix<F>& mds,
+                                   size_t full_rounds, size_t partial_rounds,
+                                   PoseidonOptimizedConstants* out) {
+    if (partial_rounds == 0) return false;
+    Eigen::Index width = mds.rows();
+    if (width < 2) return false;
+    size_t full_rounds_over_2 = full_rounds / 2;
+
+    math::Matrix<F> mds_inv;
+    if (!internal::InvertMatrix(mds, &mds_inv)) {
+      LOG(ERROR) << "MDS matrix is not invertible";
+      return false;
+    }
+
+    PoseidonOptimizedConstants ret;
+
+    // Given the constants cᵢ₊₁ of the (i + 1)-th partial round,
+    // M⁻¹ * cᵢ₊₁ = (d₀, d₁, ..., dₜ₋₁) is added before the MDS matrix of the
+    // i-th round instead. Since the S-Box of the i-th round only touches the
+    // first element, (0, d₁, ..., dₜ₋₁) is added to cᵢ and only d₀ is left
+    // to be added after the S-Box.
+    ret.partial_round_constants.resize(partial_rounds - 1);
+    math::Vector<F> constants =
+        ark.row(full_rounds_over_2 + partial_rounds - 1).transpose();
+    for (size_t i = partial_rounds - 1; i > 0; --i) {
+      math::Vector<F> moved = mds_inv * constants;
+      ret.partial_round_constants[i - 1] = moved[0];
+      constants = ark.row(full_rounds_over_2 + i - 1).transpose();
+      constants.tail(width - 1) += moved.tail(width - 1);
+    }
+    ret.first_partial_round_constants = std::move(constants);
+
+    // The matrix A applied at the end of the i-th partial round is factored
+    // into A = M'' * M', where
+    //
+    //   A = | a₀₀ b |, M'' = | a₀₀ b * D⁻¹ |, M' = | 1 0 |
+    //       | c   D |        | c   I       |       | 0 D |
+    //
+    // M' commutes with the S-Box of the i-th round, so it is moved to the end
+    // of the (i - 1)-th round, where A becomes M' * M.
+    ret.sparse_mds.resize(partial_rounds);
+    math::Matrix<F> acc = mds;
+    math::Matrix<F> pre(width, width);
+    for (size_t i = partial_rounds - 1; i != static_cast<size_t>(-1); --i) {
+      math::Matrix<F> sub = acc.bottomRightCorner(width - 1, width - 1);
+      math::Matrix<F> sub_inv;
+      if (!internal::InvertMatrix(sub, &sub_inv)) {
+        LOG(ERROR) << "MDS matrix doesn't have a sparse form";
+        return false;
+      }
+
+      PoseidonSparseMDSMatrix<F>& sparse = ret.sparse_mds[i];
+      sparse.m00 = acc(0, 0);
+      sparse.row = acc.row(0).tail(width - 1) * sub_inv;
+      sparse.col = acc.col(0).tail(width - 1);
+
+      for (Eigen::Index j = 0; j < width; ++j) {
+        pre(0, j) = j == 0 ? F::One() : F::Zero();
+        pre(j, 0) = pre(0, j);
+      }
+      pre.bottomRightCorner(width - 1, width - 1) = sub;
+      acc = pre * mds;
+    }
+    ret.pre_sparse_mds = std::move(pre);
+
+    *out = std::move(ret);
+    return true;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_OPTIMIZED_CONSTANTS_H_
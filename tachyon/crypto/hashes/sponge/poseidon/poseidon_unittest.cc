@@ -9,6 +9,8 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_batch_permutation.h"
+
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
 
 namespace tachyon::crypto {
@@ -41,4 +43,70 @@ TEST_F(PoseidonTest, AbsorbSqueeze) {
   EXPECT_EQ(result, expected);
 }
 
+TEST_F(PoseidonTest, SBox) {
+  using Fr = math::bls12_381::Fr;
+
+  Fr x = Fr::Random();
+  for (uint64_t alpha : {3, 5, 7, 17}) {
+    EXPECT_EQ(PoseidonSponge<Fr>::SBox(alpha, x), x.Pow(alpha));
+  }
+}
+
+TEST_F(PoseidonTest, OptimizedPermute) {
+  using Fr = math::bls12_381::Fr;
+
+  for (size_t rate : {2, 3, 8}) {
+    PoseidonConfig<Fr> config = PoseidonConfig<Fr>::CreateDefault(rate, false);
+    ASSERT_FALSE(config.optimized_constants.IsEmpty());
+    PoseidonConfig<Fr> dense_config = config;
+    dense_config.optimized_constants = PoseidonOptimizedConstants<Fr>();
+
+    PoseidonSponge<Fr> sponge(config);
+    for (size_t i = 0; i < sponge.state.size(); ++i) {
+      sponge.state[i] = Fr::Random();
+    }
+    PoseidonSponge<Fr> dense_sponge(dense_config, sponge.state);
+
+    sponge.Permute();
+    dense_sponge.Permute();
+    for (size_t i = 0; i < sponge.state.size(); ++i) {
+      EXPECT_EQ(sponge.state[i], dense_sponge.state[i]);
+    }
+  }
+}
+
+TEST_F(PoseidonTest, BatchPermute) {
+  using Fr = math::bls12_381::Fr;
+
+  constexpr size_t kNumStates = 5;
+
+  for (bool optimized : {false, true}) {
+    PoseidonConfig<Fr> config = PoseidonConfig<Fr>::CreateDefault(3, false);
+    if (!optimized) {
+      config.optimized_constants = PoseidonOptimizedConstants<Fr>();
+    }
+    size_t width = config.rate + config.capacity;
+
+    std::vector<PoseidonSponge<Fr>> sponges;
+    std::vector<Fr> states(width * kNumStates);
+    for (size_t i = 0; i < kNumStates; ++i) {
+      PoseidonSponge<Fr> sponge(config);
+      for (size_t j = 0; j < width; ++j) {
+        sponge.state[j] = Fr::Random();
+        states[j * kNumStates + i] = sponge.state[j];
+      }
+      sponge.Permute();
+      sponges.push_back(std::move(sponge));
+    }
+
+    PoseidonBatchPermutation<Fr> permutation(config);
+    permutation.Permute(kNumStates, absl::MakeSpan(states));
+    for (size_t i = 0; i < kNumStates; ++i) {
+      for (size_t j = 0; j < width; ++j) {
+        EXPECT_EQ(states[j * kNumStates + i], sponges[i].state[j]);
+      }
+    }
+  }
+}
+
 }  // namespace tachyon::crypto
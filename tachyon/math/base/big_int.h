@@ -909,6 +909,14 @@ struct ALIGNAS(internal::LimbsAlignment(N)) BigInt {
   }
 };
 
+template <typename H, size_t N>
+H AbslHashValue(H h, const BigInt<N>& big_int) {
+  for (uint64_t limb : big_int.limbs) {
+    h = H::combine(std::move(h), limb);
+  }
+  return h;
+}
+
 template <size_t N>
 class BitTraits<BigInt<N>> {
  public:
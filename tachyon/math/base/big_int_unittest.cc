@@ -1,9 +1,11 @@
 #include "tachyon/math/base/big_int.h"
 
 #include <algorithm>
+#include <tuple>
 #include <vector>
 
 #include "absl/container/inlined_vector.h"
+#include "absl/hash/hash_testing.h"
 #include "absl/types/span.h"
 #include "gtest/gtest.h"
 
@@ -171,6 +173,11 @@ TEST(BigIntTest, Comparison) {
   EXPECT_TRUE(big_int2 >= big_int);
 }
 
+TEST(BigIntTest, Hash) {
+  EXPECT_TRUE(absl::VerifyTypeImplementsAbslHashCorrectly(
+      std::make_tuple(BigInt<2>::Random(), BigInt<2>::Random())));
+}
+
 TEST(BigIntTest, ExtractBits) {
   BigInt<2> big_int = BigInt<2>::Random();
   size_t bit_count = 4;
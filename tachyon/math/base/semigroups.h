@@ -68,6 +68,21 @@ template <typename T>
 struct SupportsSize<T, decltype(void(std::size(std::declval<T>())))>
     : std::true_type {};
 
+// |SupportsFixedBaseMultiScalarMul<G, ScalarContainer, OutputContainer>::value|
+// is true if |G| provides |FixedBaseMultiScalarMul()|, which computes
+// [s₀G, s₁G, ..., sₙ₋₁G] for a single base G faster than multiplying G by
+// each scalar.
+template <typename G, typename ScalarContainer, typename OutputContainer,
+          typename = void>
+struct SupportsFixedBaseMultiScalarMul : std::false_type {};
+
+template <typename G, typename ScalarContainer, typename OutputContainer>
+struct SupportsFixedBaseMultiScalarMul<
+    G, ScalarContainer, OutputContainer,
+    decltype(void(G::FixedBaseMultiScalarMul(
+        std::declval<const ScalarContainer&>(), std::declval<const G&>(),
+        std::declval<OutputContainer*>())))> : std::true_type {};
+
 template <typename G>
 struct MultiplicativeSemigroupTraits {
   using ReturnTy = G;
@@ -455,14 +470,19 @@ class AdditiveSemigroup {
       LOG(ERROR) << "scalars are empty";
       return false;
     }
-    size_t num_elems_per_thread =
-        base::GetNumElementsPerThread(scalars, kDefaultParallelThreshold);
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; i += num_elems_per_thread) {
-      for (size_t j = i; j < i + num_elems_per_thread && j < size; ++j) {
-        (*outputs)[j] = base.ScalarMul(scalars[j]);
+    if constexpr (internal::SupportsFixedBaseMultiScalarMul<
+                      G, ScalarContainer, OutputContainer>::value) {
+      return G::FixedBaseMultiScalarMul(scalars, base, outputs);
+    } else {
+      size_t num_elems_per_thread =
+          base::GetNumElementsPerThread(scalars, kDefaultParallelThreshold);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < size; i += num_elems_per_thread) {
+        for (size_t j = i; j < i + num_elems_per_thread && j < size; ++j) {
+          (*outputs)[j] = base.ScalarMul(scalars[j]);
+        }
       }
+      return true;
     }
-    return true;
   }
 
   // Single Scalar Multi Base
@@ -0,0 +1,229 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_BUCKETS_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_BUCKETS_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/affine_point.h"
+#include "tachyon/math/elliptic_curves/curve_type.h"
+#include "tachyon/math/elliptic_curves/point_xyzz.h"
+
+namespace tachyon::math {
+
+template <typename Point>
+struct IsBatchAffineAccumulatable {
+  constexpr static bool value = false;
+};
+
+template <typename Curve>
+struct IsBatchAffineAccumulatable<AffinePoint<Curve>> {
+  constexpr static bool value = Curve::kType == CurveType::kShortWeierstrass;
+};
+
+// |BatchAffineBuckets| keeps Pippenger buckets in affine form. Additions into
+// the buckets are queued and applied in batches, so that the slope
+// denominators of a whole batch share a single field inversion through
+// Montgomery's trick. An affine addition costs ~6 field multiplications once
+// the inversion is amortized, while a mixed addition into a |PointXYZZ| bucket
+// costs ~8 field multiplications and 2 squarings.
+//
+// A bucket can be updated at most once per batch, because the result of the
+// first update is needed as the input of the next one. Colliding additions are
+// deferred to the next batch and if too many of them are deferred, they are
+// added into a |PointXYZZ| overflow bucket instead. This is the same approach
+// gnark-crypto takes in its batch affine MSM.
+template <typename Point>
+class BatchAffineBuckets {
+ public:
+  static_assert(IsBatchAffineAccumulatable<Point>::value,
+                "BatchAffineBuckets only supports short weierstrass affine "
+                "points");
+
+  using Curve = typename Point::Curve;
+  using BaseField = typename Point::BaseField;
+  using Bucket = PointXYZZ<Curve>;
+
+  // A larger batch amortizes the inversion better, but increases the chance
+  // of collisions when the number of buckets is small.
+  constexpr static size_t kDefaultBatchSize = 256;
+
+  explicit BatchAffineBuckets(size_t bucket_size,
+                              size_t batch_size = kDefaultBatchSize)
+      : buckets_(bucket_size, Point::Zero()),
+        scheduled_(bucket_size, false),
+        batch_size_(batch_size) {
+    CHECK_GT(batch_size_, size_t{0});
+    batch_.reserve(batch_size_);
+    pending_.reserve(batch_size_);
+    denominators_.reserve(batch_size_);
+  }
+  BatchAffineBuckets(const BatchAffineBuckets& other) = delete;
+  BatchAffineBuckets& operator=(const BatchAffineBuckets& other) = delete;
+
+  size_t size() const { return buckets_.size(); }
+
+  // buckets[|idx|] += |point|
+  void Add(size_t idx, const Point& point) {
+    if (point.IsZero()) return;
+    if (!Schedule(idx, point)) {
+      if (pending_.size() < batch_size_) {
+        pending_.push_back({idx, point});
+      } else {
+        AddToOverflowBucket(idx, point);
+      }
+    }
+    if (batch_.size() >= batch_size_) ApplyBatch();
+  }
+
+  // buckets[|idx|] -= |point|
+  void Sub(size_t idx, const Point& point) { Add(idx, -point); }
+
+  // Applies every queued addition.
+  void Flush() {
+    while (!batch_.empty() || !pending_.empty()) {
+      ApplyBatch();
+    }
+  }
+
+  // Flushes the queued additions and returns
+  // |initial_value| + 1 * buckets[0] + 2 * buckets[1] + ... +
+  // n * buckets[n - 1].
+  Bucket Accumulate(const Bucket& initial_value = Bucket::Zero()) {
+    Flush();
+
+    Bucket running_sum = Bucket::Zero();
+    Bucket window_sum = initial_value;
+    for (size_t i = buckets_.size() - 1; i != static_cast<size_t>(-1); --i) {
+      running_sum += buckets_[i];
+      if (!overflow_buckets_.empty()) {
+        running_sum += overflow_buckets_[i];
+      }
+      window_sum += running_sum;
+    }
+    return window_sum;
+  }
+
+ private:
+  struct Addition {
+    size_t idx;
+    Point point;
+  };
+
+  // Returns false if buckets[|idx|] is already updated in the current batch.
+  bool Schedule(size_t idx, const Point& point) {
+    if (scheduled_[idx]) return false;
+    Point& bucket = buckets_[idx];
+    if (bucket.IsZero()) {
+      // No inversion is needed to add to an empty bucket.
+      bucket = point;
+      return true;
+    }
+    scheduled_[idx] = true;
+    batch_.push_back({idx, point});
+    return true;
+  }
+
+  void AddToOverflowBucket(size_t idx, const Point& point) {
+    if (overflow_buckets_.empty()) {
+      overflow_buckets_.resize(buckets_.size(), Bucket::Zero());
+    }
+    overflow_buckets_[idx] += point;
+  }
+
+  void ApplyBatch() {
+    DoApplyBatch();
+
+    // Every bucket is free again, so the deferred additions are moved into
+    // the next batch.
+    std::vector<Addition> pending;
+    pending.reserve(batch_size_);
+    std::swap(pending, pending_);
+    for (const Addition& addition : pending) {
+      if (!Schedule(addition.idx, addition.point)) {
+        pending_.push_back(addition);
+      }
+    }
+  }
+
+  void DoApplyBatch() {
+    if (batch_.empty()) return;
+
+    // First pass: collect the slope denominators.
+    // P + Q : λ = (Q.y - P.y) / (Q.x - P.x)
+    // 2P    : λ = (3 * P.x² + a) / (2 * P.y)
+    // P - P : the denominator is left as zero.
+    denominators_.clear();
+    for (const Addition& addition : batch_) {
+      const Point& bucket = buckets_[addition.idx];
+      const Point& point = addition.point;
+      if (bucket.x() == point.x()) {
+        if (bucket.y() == point.y()) {
+          denominators_.push_back(point.y().Double());
+        } else {
+          denominators_.push_back(BaseField::Zero());
+        }
+      } else {
+        denominators_.push_back(point.x() - bucket.x());
+      }
+    }
+
+    // NOTE: |BatchInverseInPlaceSerial()| leaves zeros untouched.
+    CHECK(BaseField::BatchInverseInPlaceSerial(denominators_));
+
+    // Second pass: compute the sums.
+    // X3 = λ² - P.x - Q.x
+    // Y3 = λ * (P.x - X3) - P.y
+    for (size_t i = 0; i < batch_.size(); ++i) {
+      const Addition& addition = batch_[i];
+      Point& bucket = buckets_[addition.idx];
+      const Point& point = addition.point;
+      scheduled_[addition.idx] = false;
+
+      const BaseField& denominator_inv = denominators_[i];
+      if (denominator_inv.IsZero()) {
+        bucket = Point::Zero();
+        continue;
+      }
+
+      BaseField lambda;
+      if (bucket.x() == point.x()) {
+        lambda = point.x().Square();
+        lambda += lambda.Double();
+        if constexpr (!Curve::Config::kAIsZero) {
+          lambda += Curve::Config::kA;
+        }
+      } else {
+        lambda = point.y() - bucket.y();
+      }
+      lambda *= denominator_inv;
+
+      BaseField x = lambda.Square();
+      x -= bucket.x();
+      x -= point.x();
+
+      BaseField y = bucket.x() - x;
+      y *= lambda;
+      y -= bucket.y();
+
+      bucket = Point(std::move(x), std::move(y));
+    }
+    batch_.clear();
+  }
+
+  std::vector<Point> buckets_;
+  // |scheduled_[i]| is true if |buckets_[i]| is updated in |batch_|.
+  std::vector<bool> scheduled_;
+  // Lazily allocated when deferred additions overflow |pending_|.
+  std::vector<Bucket> overflow_buckets_;
+  std::vector<Addition> batch_;
+  std::vector<Addition> pending_;
+  std::vector<BaseField> denominators_;
+  size_t batch_size_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_BUCKETS_H_
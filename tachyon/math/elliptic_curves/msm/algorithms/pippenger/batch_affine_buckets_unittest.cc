@@ -0,0 +1,85 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_buckets.h"
+
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/random.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/test/random.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class BatchAffineBucketsTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+};
+
+}  // namespace
+
+TEST_F(BatchAffineBucketsTest, Accumulate) {
+  const size_t kNumPoints = 100;
+
+  std::vector<bn254::G1AffinePoint> points =
+      CreatePseudoRandomPoints<bn254::G1AffinePoint>(kNumPoints);
+
+  struct {
+    size_t bucket_size;
+    size_t batch_size;
+  } tests[] = {
+      // Many collisions per batch, which exercises the overflow buckets.
+      {1, 4},
+      {3, 8},
+      {16, 16},
+      {64, BatchAffineBuckets<bn254::G1AffinePoint>::kDefaultBatchSize},
+  };
+
+  for (const auto& test : tests) {
+    SCOPED_TRACE(absl::Substitute("bucket_size: $0, batch_size: $1",
+                                  test.bucket_size, test.batch_size));
+    BatchAffineBuckets<bn254::G1AffinePoint> buckets(test.bucket_size,
+                                                     test.batch_size);
+    std::vector<bn254::G1PointXYZZ> expected_buckets(
+        test.bucket_size, bn254::G1PointXYZZ::Zero());
+    for (size_t i = 0; i < kNumPoints; ++i) {
+      size_t idx = base::Uniform(base::Range<size_t>::Until(test.bucket_size));
+      if (base::Bernoulli(0.5)) {
+        buckets.Add(idx, points[i]);
+        expected_buckets[idx] += points[i];
+      } else {
+        buckets.Sub(idx, points[i]);
+        expected_buckets[idx] -= points[i];
+      }
+    }
+
+    bn254::G1PointXYZZ expected = bn254::G1PointXYZZ::Zero();
+    for (size_t i = 0; i < test.bucket_size; ++i) {
+      expected += expected_buckets[i] * bn254::Fr(i + 1);
+    }
+    EXPECT_EQ(buckets.Accumulate(), expected);
+  }
+}
+
+TEST_F(BatchAffineBucketsTest, AccumulateDoublingAndNegation) {
+  std::vector<bn254::G1AffinePoint> points =
+      CreatePseudoRandomPoints<bn254::G1AffinePoint>(2);
+
+  BatchAffineBuckets<bn254::G1AffinePoint> buckets(2);
+  // The first addition to an empty bucket stores the point, so the second
+  // addition of the same point to buckets[0] is a doubling, and the addition
+  // of the negation to buckets[1] makes the bucket vanish.
+  buckets.Add(0, points[0]);
+  buckets.Add(0, points[0]);
+  buckets.Add(1, points[1]);
+  buckets.Sub(1, points[1]);
+
+  bn254::G1PointXYZZ expected = bn254::G1PointXYZZ::Zero();
+  expected += points[0];
+  expected += points[0];
+  EXPECT_EQ(buckets.Accumulate(), expected);
+}
+
+}  // namespace tachyon::math
@@ -12,11 +12,16 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
-#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/threading/parallel_for.h"
+#include "tachyon/base/threading/thread_pool.h"
 #include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_buckets.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/glv.h"
 #include "tachyon/math/elliptic_curves/msm/msm_util.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
 
@@ -26,12 +31,12 @@ namespace tachyon::math {
 // https://github.com/arkworks-rs/gemini/blob/main/src/kzg/msm/variable_base.rs#L20
 template <size_t N>
 void FillDigits(const BigInt<N>& scalar, size_t window_bits,
-                std::vector<int64_t>* digits) {
+                absl::Span<int64_t> digits) {
   uint64_t radix = 1 << window_bits;
 
   uint64_t carry = 0;
   size_t bit_offset = 0;
-  for (size_t i = 0; i < digits->size(); ++i) {
+  for (size_t i = 0; i < digits.size(); ++i) {
     // Construct a buffer of bits of the |scalar|, starting at
     // `bit_offset`.
     uint64_t bits = scalar.ExtractBits64(bit_offset, window_bits);
@@ -42,12 +47,18 @@ void FillDigits(const BigInt<N>& scalar, size_t window_bits,
     // Recenter coefficients from [0,2^|window_bits|) to
     // [-2^|window_bits|/2, 2^|window_bits|/2)
     carry = (coeff + radix / 2) >> window_bits;
-    (*digits)[i] = static_cast<int64_t>(coeff) -
-                   static_cast<int64_t>(carry << window_bits);
+    digits[i] = static_cast<int64_t>(coeff) -
+                static_cast<int64_t>(carry << window_bits);
     bit_offset += window_bits;
   }
 
-  digits->back() += static_cast<int64_t>(carry << window_bits);
+  digits.back() += static_cast<int64_t>(carry << window_bits);
+}
+
+template <size_t N>
+void FillDigits(const BigInt<N>& scalar, size_t window_bits,
+                std::vector<int64_t>* digits) {
+  FillDigits(scalar, window_bits, absl::MakeSpan(*digits));
 }
 
 template <typename Point>
@@ -58,17 +69,40 @@ class Pippenger : public PippengerBase<Point> {
 
   constexpr static size_t N = ScalarField::N;
 
-  Pippenger() : use_msm_window_naf_(Point::kNegationIsCheap) {
-#if defined(TACHYON_HAS_OPENMP)
-    parallel_windows_ = true;
-#endif  // defined(TACHYON_HAS_OPENMP)
-  }
+  // The upper bound of the memory of the buckets that a single task of
+  // |RunBatch()| allocates.
+  constexpr static size_t kMaxBatchBucketsMemory = size_t{64} << 20;
+
+  Pippenger() : use_msm_window_naf_(Point::kNegationIsCheap) {}
 
   void SetParallelWindows(bool parallel_windows) {
     parallel_windows_ = parallel_windows;
-#if !defined(TACHYON_HAS_OPENMP)
-    LOG_IF(WARNING, parallel_windows) << "Set parallel windows without openmp";
-#endif  // !defined(TACHYON_HAS_OPENMP)
+  }
+
+  // If |use_batch_affine| is true, buckets are kept in affine form and
+  // additions into them are applied in batches. See |BatchAffineBuckets|.
+  // This is only supported when |Point| is a short weierstrass affine point.
+  void SetUseBatchAffine(bool use_batch_affine) {
+    if constexpr (IsBatchAffineAccumulatable<Point>::value) {
+      use_batch_affine_ = use_batch_affine;
+    } else {
+      LOG_IF(WARNING, use_batch_affine)
+          << "Batch affine accumulation is not supported for this point type";
+    }
+  }
+
+  // If |use_glv| is true, each scalar k is decomposed into k1 + λ * k2 and
+  // the MSM is run over the bases {P, φ(P)} with the half-sized scalars
+  // {k1, k2}, which halves the number of windows. See |GLV|. This is only
+  // supported when the curve of |Point| has an efficient endomorphism.
+  // NOTE(chokobole): This is disabled by default, because it copies 2 * |size|
+  // bases on every run and it hasn't been shown to be faster yet.
+  void SetUseGLV(bool use_glv) {
+    if constexpr (SupportsGLV<Point>::value) {
+      use_glv_ = use_glv;
+    } else {
+      LOG_IF(WARNING, use_glv) << "GLV is not supported for this point type";
+    }
   }
 
   void SetUseMSMWindowNAForTesting(bool use_msm_window_naf) {
@@ -87,6 +121,13 @@ class Pippenger : public PippengerBase<Point> {
       LOG(ERROR) << "bases_size and scalars_size don't match";
       return false;
     }
+    if constexpr (SupportsGLV<Point>::value) {
+      if (use_glv_) {
+        RunWithGLV(std::move(bases_first), std::move(scalars_first),
+                   scalars_size, ret);
+        return true;
+      }
+    }
     ctx_ = PippengerCtx::CreateDefault<ScalarField>(scalars_size);
 
     std::vector<BigInt<N>> scalars;
@@ -96,6 +137,144 @@ class Pippenger : public PippengerBase<Point> {
       scalars[i] = scalars_it->ToBigInt();
     }
 
+    AccumulateAllWindowSums(std::move(bases_first), scalars, ret);
+    return true;
+  }
+
+  // Computes k MSMs sharing the same bases at once:
+  //
+  //   retᵢ = sᵢ₀ * g₀ + sᵢ₁ * g₁ + ... + sᵢₙ₋₁ * gₙ₋₁ for i in [0, k)
+  //
+  // A task is a pair of a window and a group of MSMs. Each task streams the
+  // bases once and updates the buckets of every MSM in its group, so the bases
+  // are read far fewer times than when running the k MSMs one by one. The
+  // groups are made just small enough to keep every thread busy and to keep
+  // the buckets of a task within |kMaxBatchBucketsMemory|. Like |Run()|, the
+  // scalars are decomposed into signed digits if the negation is cheap, which
+  // halves the number of buckets.
+  template <typename BaseInputIterator, typename ScalarContainer>
+  bool RunBatch(BaseInputIterator bases_first, BaseInputIterator bases_last,
+                absl::Span<const ScalarContainer> scalars_list,
+                std::vector<Bucket>* rets) {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    for (const ScalarContainer& scalars : scalars_list) {
+      if (std::size(scalars) != bases_size) {
+        LOG(ERROR) << "bases_size and scalars_size don't match";
+        return false;
+      }
+    }
+    size_t batch_size = scalars_list.size();
+    rets->resize(batch_size);
+    if (batch_size == 0) return true;
+    ctx_ = PippengerCtx::CreateDefault<ScalarField>(bases_size);
+
+    // |window_sums[i * window_count + j]| is the j-th window sum of the i-th
+    // MSM.
+    std::vector<Bucket> window_sums =
+        base::CreateVector(batch_size * ctx_.window_count, Bucket::Zero());
+    if (use_msm_window_naf_) {
+      // |scalar_digits[i][j * window_count + k]| is the k-th signed digit of
+      // the j-th scalar of the i-th MSM.
+      std::vector<std::vector<int64_t>> scalar_digits(batch_size);
+      for (size_t i = 0; i < batch_size; ++i) {
+        const ScalarContainer& scalars_i = scalars_list[i];
+        std::vector<int64_t>& digits = scalar_digits[i];
+        digits.resize(bases_size * ctx_.window_count);
+        base::ParallelFor(
+            0, bases_size, [this, &scalars_i, &digits](size_t j) {
+              FillDigits(scalars_i[j].ToBigInt(), ctx_.window_bits,
+                         absl::MakeSpan(&digits[j * ctx_.window_count],
+                                        ctx_.window_count));
+            });
+      }
+      // The last window has 2^{window_bits} buckets. See |FillDigits()|.
+      size_t group_size = ComputeBatchGroupSize(
+          batch_size, size_t{1} << ctx_.window_bits);
+      RunBatchTasks(batch_size, group_size, [&](size_t group_idx,
+                                                size_t window_idx) {
+        AccumulateBatchSingleWindowNAFSums(bases_first, bases_size,
+                                           scalar_digits, group_idx,
+                                           group_size, window_idx,
+                                           &window_sums);
+      });
+    } else {
+      std::vector<std::vector<BigInt<N>>> scalars(batch_size);
+      for (size_t i = 0; i < batch_size; ++i) {
+        const ScalarContainer& scalars_i = scalars_list[i];
+        scalars[i].resize(bases_size);
+        std::vector<BigInt<N>>& scalars_bigint = scalars[i];
+        base::ParallelFor(0, bases_size,
+                          [&scalars_i, &scalars_bigint](size_t j) {
+                            scalars_bigint[j] = scalars_i[j].ToBigInt();
+                          });
+      }
+      size_t group_size = ComputeBatchGroupSize(
+          batch_size, (size_t{1} << ctx_.window_bits) - 1);
+      RunBatchTasks(batch_size, group_size, [&](size_t group_idx,
+                                                size_t window_idx) {
+        AccumulateBatchSingleWindowSums(bases_first, bases_size, scalars,
+                                        group_idx, group_size, window_idx,
+                                        &window_sums);
+      });
+    }
+
+    base::ParallelFor(0, batch_size, [this, &window_sums, rets](size_t i) {
+      (*rets)[i] = PippengerBase<Point>::AccumulateWindowSums(
+          absl::MakeConstSpan(&window_sums[i * ctx_.window_count],
+                              ctx_.window_count),
+          ctx_.window_bits);
+    });
+    return true;
+  }
+
+ private:
+  // Runs the MSM over 2 * |size| bases and scalars, where the i-th base and
+  // scalar are split into ±Pᵢ, ±φ(Pᵢ) and |k1ᵢ|, |k2ᵢ|. Since |k1ᵢ| and |k2ᵢ|
+  // are about half of the size of the scalar field, the number of windows is
+  // computed from the longest of them instead of the modulus bits.
+  template <typename BaseInputIterator, typename ScalarInputIterator>
+  void RunWithGLV(BaseInputIterator bases_first,
+                  ScalarInputIterator scalars_first, size_t size,
+                  Bucket* ret) {
+    std::vector<Point> bases(2 * size);
+    std::vector<ScalarField> field_scalars(size);
+    auto bases_it = bases_first;
+    auto scalars_it = scalars_first;
+    for (size_t i = 0; i < size; ++i, ++bases_it, ++scalars_it) {
+      bases[2 * i] = *bases_it;
+      field_scalars[i] = *scalars_it;
+    }
+
+    std::vector<BigInt<N>> scalars(2 * size);
+    base::ParallelFor(0, size, [&bases, &field_scalars, &scalars](size_t i) {
+      auto result = GLV<Point>::Decompose(field_scalars[i]);
+      Point& base = bases[2 * i];
+      Point& endomorphism = bases[2 * i + 1];
+      endomorphism = GLV<Point>::Endomorphism(base);
+      if (result.k1_is_negative) base.NegInPlace();
+      if (result.k2_is_negative) endomorphism.NegInPlace();
+      scalars[2 * i] = result.k1;
+      scalars[2 * i + 1] = result.k2;
+    });
+
+    BigInt<N> all_bits = BigInt<N>::Zero();
+    for (const BigInt<N>& scalar : scalars) {
+      for (size_t i = 0; i < N; ++i) {
+        all_bits[i] |= scalar[i];
+      }
+    }
+    size_t max_bits = std::max(GLV<Point>::GetNumBits(all_bits), size_t{1});
+
+    ctx_ = PippengerCtx::CreateDefault<ScalarField>(2 * size);
+    ctx_.window_count = (max_bits + ctx_.window_bits - 1) / ctx_.window_bits;
+
+    AccumulateAllWindowSums(bases.begin(), scalars, ret);
+  }
+
+  template <typename BaseInputIterator>
+  void AccumulateAllWindowSums(BaseInputIterator bases_first,
+                               absl::Span<const BigInt<N>> scalars,
+                               Bucket* ret) {
     std::vector<Bucket> window_sums =
         base::CreateVector(ctx_.window_count, Bucket::Zero());
 
@@ -107,10 +286,117 @@ class Pippenger : public PippengerBase<Point> {
 
     *ret = PippengerBase<Point>::AccumulateWindowSums(
         absl::MakeConstSpan(window_sums), ctx_.window_bits);
-    return true;
   }
 
- private:
+  // Returns the number of MSMs that a single task of |RunBatch()| handles,
+  // where each MSM needs at most |bucket_size| buckets per window.
+  size_t ComputeBatchGroupSize(size_t batch_size, size_t bucket_size) const {
+    size_t group_count = 1;
+    if (parallel_windows_) {
+      size_t thread_nums = base::ThreadPool::Current()->num_threads();
+      group_count = (thread_nums + ctx_.window_count - 1) / ctx_.window_count;
+    }
+    group_count = std::min(group_count, batch_size);
+    size_t group_size = (batch_size + group_count - 1) / group_count;
+    size_t max_group_size = std::max(
+        kMaxBatchBucketsMemory / (bucket_size * sizeof(Bucket)), size_t{1});
+    return std::min(group_size, max_group_size);
+  }
+
+  // Runs |task(group_idx, window_idx)| for every pair of a group of
+  // |group_size| MSMs and a window.
+  template <typename Task>
+  void RunBatchTasks(size_t batch_size, size_t group_size, Task task) {
+    size_t group_count = (batch_size + group_size - 1) / group_size;
+    size_t task_count = group_count * ctx_.window_count;
+    if (parallel_windows_) {
+      base::ParallelFor(0, task_count, [this, &task](size_t i) {
+        task(i / ctx_.window_count, i % ctx_.window_count);
+      });
+    } else {
+      for (size_t i = 0; i < task_count; ++i) {
+        task(i / ctx_.window_count, i % ctx_.window_count);
+      }
+    }
+  }
+
+  template <typename BaseInputIterator>
+  void AccumulateBatchSingleWindowSums(
+      BaseInputIterator bases_it, size_t bases_size,
+      const std::vector<std::vector<BigInt<N>>>& scalars, size_t group_idx,
+      size_t group_size, size_t window_idx, std::vector<Bucket>* window_sums) {
+    size_t begin = group_idx * group_size;
+    size_t end = std::min(begin + group_size, scalars.size());
+    size_t window_offset = ctx_.window_bits * window_idx;
+    // We don't need the "zero" bucket, so we only have 2^{window_bits} - 1
+    // buckets per MSM.
+    size_t bucket_size = (size_t{1} << ctx_.window_bits) - 1;
+    std::vector<Bucket> buckets =
+        base::CreateVector((end - begin) * bucket_size, Bucket::Zero());
+    std::vector<Bucket> unit_sums =
+        base::CreateVector(end - begin, Bucket::Zero());
+    for (size_t j = 0; j < bases_size; ++j, ++bases_it) {
+      const Point& base = *bases_it;
+      for (size_t i = begin; i < end; ++i) {
+        const BigInt<N>& scalar = scalars[i][j];
+        if (scalar.IsZero()) continue;
+
+        if (scalar.IsOne()) {
+          // We only process unit scalars once in the first window.
+          if (window_idx == 0) {
+            unit_sums[i - begin] += base;
+          }
+        } else {
+          uint64_t idx = scalar.ExtractBits64(window_offset, ctx_.window_bits);
+          if (idx != 0) {
+            buckets[(i - begin) * bucket_size + idx - 1] += base;
+          }
+        }
+      }
+    }
+    for (size_t i = begin; i < end; ++i) {
+      (*window_sums)[i * ctx_.window_count + window_idx] =
+          PippengerBase<Point>::AccumulateBuckets(
+              absl::MakeConstSpan(&buckets[(i - begin) * bucket_size],
+                                  bucket_size),
+              unit_sums[i - begin]);
+    }
+  }
+
+  template <typename BaseInputIterator>
+  void AccumulateBatchSingleWindowNAFSums(
+      BaseInputIterator bases_it, size_t bases_size,
+      const std::vector<std::vector<int64_t>>& scalar_digits, size_t group_idx,
+      size_t group_size, size_t window_idx, std::vector<Bucket>* window_sums) {
+    size_t begin = group_idx * group_size;
+    size_t end = std::min(begin + group_size, scalar_digits.size());
+    size_t bucket_size;
+    if (window_idx == ctx_.window_count - 1) {
+      bucket_size = size_t{1} << ctx_.window_bits;
+    } else {
+      bucket_size = size_t{1} << (ctx_.window_bits - 1);
+    }
+    std::vector<Bucket> buckets =
+        base::CreateVector((end - begin) * bucket_size, Bucket::Zero());
+    for (size_t j = 0; j < bases_size; ++j, ++bases_it) {
+      const Point& base = *bases_it;
+      for (size_t i = begin; i < end; ++i) {
+        int64_t digit = scalar_digits[i][j * ctx_.window_count + window_idx];
+        Bucket* msm_buckets = &buckets[(i - begin) * bucket_size];
+        if (0 < digit) {
+          msm_buckets[static_cast<uint64_t>(digit - 1)] += base;
+        } else if (0 > digit) {
+          msm_buckets[static_cast<uint64_t>(-digit - 1)] -= base;
+        }
+      }
+    }
+    for (size_t i = begin; i < end; ++i) {
+      (*window_sums)[i * ctx_.window_count + window_idx] =
+          PippengerBase<Point>::AccumulateBuckets(absl::MakeConstSpan(
+              &buckets[(i - begin) * bucket_size], bucket_size));
+    }
+  }
+
   template <typename BaseInputIterator>
   void AccumulateSingleWindowNAFSum(
       BaseInputIterator bases_it,
@@ -122,6 +408,21 @@ class Pippenger : public PippengerBase<Point> {
     } else {
       bucket_size = 1 << (ctx_.window_bits - 1);
     }
+    if constexpr (IsBatchAffineAccumulatable<Point>::value) {
+      if (use_batch_affine_) {
+        BatchAffineBuckets<Point> buckets(bucket_size);
+        for (size_t j = 0; j < scalar_digits.size(); ++j, ++bases_it) {
+          int64_t scalar = scalar_digits[j][i];
+          if (0 < scalar) {
+            buckets.Add(static_cast<uint64_t>(scalar - 1), *bases_it);
+          } else if (0 > scalar) {
+            buckets.Sub(static_cast<uint64_t>(-scalar - 1), *bases_it);
+          }
+        }
+        *window_sum = buckets.Accumulate();
+        return;
+      }
+    }
     std::vector<Bucket> buckets =
         base::CreateVector(bucket_size, Bucket::Zero());
     for (size_t j = 0; j < scalar_digits.size(); ++j, ++bases_it) {
@@ -150,11 +451,11 @@ class Pippenger : public PippengerBase<Point> {
       FillDigits(scalars[i], ctx_.window_bits, &scalar_digits[i]);
     }
     if (parallel_windows_) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
+      base::ParallelFor(0, ctx_.window_count, [&](size_t i) {
         AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
                                      &(*window_sums)[i],
                                      i == ctx_.window_count - 1);
-      }
+      });
     } else {
       for (size_t i = 0; i < ctx_.window_count; ++i) {
         AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
@@ -168,6 +469,13 @@ class Pippenger : public PippengerBase<Point> {
   void AccumulateSingleWindowSum(BaseInputIterator bases_first,
                                  absl::Span<const BigInt<N>> scalars,
                                  size_t window_offset, Bucket* out) {
+    if constexpr (IsBatchAffineAccumulatable<Point>::value) {
+      if (use_batch_affine_) {
+        AccumulateSingleWindowSumBatchAffine(std::move(bases_first), scalars,
+                                             window_offset, out);
+        return;
+      }
+    }
     Bucket window_sum = Bucket::Zero();
     // We don't need the "zero" bucket, so we only have 2^{window_bits} - 1
     // buckets.
@@ -206,15 +514,43 @@ class Pippenger : public PippengerBase<Point> {
                                                    window_sum);
   }
 
+  template <typename BaseInputIterator>
+  void AccumulateSingleWindowSumBatchAffine(BaseInputIterator bases_first,
+                                            absl::Span<const BigInt<N>> scalars,
+                                            size_t window_offset, Bucket* out) {
+    Bucket window_sum = Bucket::Zero();
+    BatchAffineBuckets<Point> buckets((1 << ctx_.window_bits) - 1);
+    auto bases_it = bases_first;
+    for (size_t j = 0; j < scalars.size(); ++j, ++bases_it) {
+      const BigInt<N>& scalar = scalars[j];
+      if (scalar.IsZero()) continue;
+
+      if (scalar.IsOne()) {
+        // We only process unit scalars once in the first window.
+        if (window_offset == 0) {
+          window_sum += *bases_it;
+        }
+      } else {
+        BigInt<N> scalar_tmp = scalar;
+        scalar_tmp.DivBy2ExpInPlace(window_offset);
+        uint64_t idx = scalar_tmp[0] % (1 << ctx_.window_bits);
+        if (idx != 0) {
+          buckets.Add(idx - 1, *bases_it);
+        }
+      }
+    }
+    *out = buckets.Accumulate(window_sum);
+  }
+
   template <typename BaseInputIterator>
   void AccumulateWindowSums(BaseInputIterator bases_first,
                             absl::Span<const BigInt<N>> scalars,
                             std::vector<Bucket>* window_sums) {
     if (parallel_windows_) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
+      base::ParallelFor(0, ctx_.window_count, [&](size_t i) {
         AccumulateSingleWindowSum(bases_first, scalars, ctx_.window_bits * i,
                                   &(*window_sums)[i]);
-      }
+      });
     } else {
       for (size_t i = 0; i < ctx_.window_count; ++i) {
         AccumulateSingleWindowSum(bases_first, scalars, ctx_.window_bits * i,
@@ -224,7 +560,9 @@ class Pippenger : public PippengerBase<Point> {
   }
 
   bool use_msm_window_naf_ = false;
-  bool parallel_windows_ = false;
+  bool use_glv_ = false;
+  bool use_batch_affine_ = false;
+  bool parallel_windows_ = true;
   PippengerCtx ctx_;
 };
 
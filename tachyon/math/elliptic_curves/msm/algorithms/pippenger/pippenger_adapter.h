@@ -1,10 +1,14 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_ADAPTER_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_ADAPTER_H_
 
+#include <stddef.h>
+
 #include <algorithm>
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/threading/parallel_for.h"
+#include "tachyon/base/threading/thread_pool.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
 
 namespace tachyon::math {
@@ -14,6 +18,9 @@ enum class PippengerParallelStrategy {
   kParallelWindow,
   kParallelTerm,
   kParallelWindowAndTerm,
+  // Same as |kParallelWindow|, but buckets are accumulated in affine form with
+  // batched inversions. See |BatchAffineBuckets|.
+  kParallelWindowBatchAffine,
 };
 
 template <typename Point>
@@ -38,10 +45,13 @@ class PippengerAdapter {
                        ScalarInputIterator scalars_last,
                        PippengerParallelStrategy strategy, Bucket* ret) {
     if (strategy == PippengerParallelStrategy::kNone ||
-        strategy == PippengerParallelStrategy::kParallelWindow) {
+        strategy == PippengerParallelStrategy::kParallelWindow ||
+        strategy == PippengerParallelStrategy::kParallelWindowBatchAffine) {
       Pippenger<Point> pippenger;
-      pippenger.SetParallelWindows(strategy ==
-                                   PippengerParallelStrategy::kParallelWindow);
+      pippenger.SetParallelWindows(strategy !=
+                                   PippengerParallelStrategy::kNone);
+      pippenger.SetUseBatchAffine(
+          strategy == PippengerParallelStrategy::kParallelWindowBatchAffine);
       return pippenger.Run(std::move(bases_first), std::move(bases_last),
                            std::move(scalars_first), std::move(scalars_last),
                            ret);
@@ -53,17 +63,17 @@ class PippengerAdapter {
         return false;
       }
 
-#if defined(TACHYON_HAS_OPENMP)
-      int thread_nums = omp_get_max_threads();
+      // NOTE(chokobole): The terms are split into |thread_nums| parts. The
+      // windows of each part run in parallel as well for
+      // |kParallelWindowAndTerm|, which nests in the loop over the parts and
+      // shares the threads of |ThreadPool::Current()|.
+      size_t thread_nums = base::ThreadPool::Current()->num_threads();
       if (strategy == PippengerParallelStrategy::kParallelWindowAndTerm) {
         size_t window_bits = PippengerCtx::ComputeWindowsBits(scalars_size);
         size_t window_size =
             PippengerCtx::ComputeWindowsCount<ScalarField>(window_bits);
-        thread_nums = std::max(thread_nums / static_cast<int>(window_size), 2);
+        thread_nums = std::max(thread_nums / window_size, size_t{2});
       }
-#else
-      int thread_nums = 1;
-#endif  // defined(TACHYON_HAS_OPENMP)
       struct Result {
         Bucket value;
         bool valid;
@@ -72,10 +82,7 @@ class PippengerAdapter {
       std::vector<Result> results;
       results.resize(thread_nums);
       size_t size = (scalars_size + thread_nums - 1) / thread_nums;
-#if defined(TACHYON_HAS_OPENMP)
-      omp_set_num_threads(thread_nums);
-#endif
-      OPENMP_PARALLEL_FOR(int i = 0; i < thread_nums; ++i) {
+      base::ParallelFor(0, thread_nums, [&](size_t i) {
         Pippenger<Point> pippenger;
         pippenger.SetParallelWindows(
             strategy == PippengerParallelStrategy::kParallelWindowAndTerm);
@@ -88,7 +95,7 @@ class PippengerAdapter {
                                : scalars_first + size * (i + 1);
         results[i].valid = pippenger.Run(bases_start, bases_end, scalars_start,
                                          scalars_end, &results[i].value);
-      }
+      });
 
       bool all_good =
           std::all_of(results.begin(), results.end(),
@@ -39,6 +39,22 @@ void BM_PippengerAdapterNonUniformWithParallelWindow(benchmark::State& state) {
       state);
 }
 
+template <typename Point>
+void BM_PippengerAdapterRandomWithParallelWindowBatchAffine(
+    benchmark::State& state) {
+  BM_PippengerAdapter<Point, true,
+                      PippengerParallelStrategy::kParallelWindowBatchAffine>(
+      state);
+}
+
+template <typename Point>
+void BM_PippengerAdapterNonUniformWithParallelWindowBatchAffine(
+    benchmark::State& state) {
+  BM_PippengerAdapter<Point, false,
+                      PippengerParallelStrategy::kParallelWindowBatchAffine>(
+      state);
+}
+
 template <typename Point>
 void BM_PippengerAdapterRandomWithParallelTerm(benchmark::State& state) {
   BM_PippengerAdapter<Point, true, PippengerParallelStrategy::kParallelTerm>(
@@ -73,6 +89,14 @@ BENCHMARK_TEMPLATE(BM_PippengerAdapterNonUniformWithParallelWindow,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
     ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelWindowBatchAffine,
+                   bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterNonUniformWithParallelWindowBatchAffine,
+                   bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
 BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelTerm,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
@@ -35,7 +35,8 @@ TEST_F(PippengerAdapterTest, RunWithStrategy) {
        {PippengerParallelStrategy::kNone,
         PippengerParallelStrategy::kParallelWindow,
         PippengerParallelStrategy::kParallelTerm,
-        PippengerParallelStrategy::kParallelWindowAndTerm}) {
+        PippengerParallelStrategy::kParallelWindowAndTerm,
+        PippengerParallelStrategy::kParallelWindowBatchAffine}) {
     PippengerAdapter<bn254::G1AffinePoint> pippenger;
     SCOPED_TRACE(absl::Substitute("strategy: $0", static_cast<int>(strategy)));
     bn254::G1PointXYZZ ret;
@@ -1,7 +1,12 @@
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
 
+#include <vector>
+
+#include "absl/strings/substitute.h"
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
+
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/g1.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 #include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
@@ -68,4 +73,122 @@ TYPED_TEST(PippengerTest, Run) {
   }
 }
 
+TYPED_TEST(PippengerTest, RunBatch) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  const MSMTestSet<Point>& test_set = this->test_set_;
+  std::vector<std::vector<ScalarField>> scalars_list = {
+      test_set.scalars,
+      base::CreateVector(kSize, []() { return ScalarField::Random(); }),
+      base::CreateVector(kSize, ScalarField::One()),
+  };
+
+  for (bool use_window_naf : {false, true}) {
+    for (bool parallel_windows : {false, true}) {
+      Pippenger<Point> pippenger;
+      SCOPED_TRACE(absl::Substitute("use_window_naf: $0 parallel_windows: $1",
+                                    use_window_naf, parallel_windows));
+      pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+      pippenger.SetParallelWindows(parallel_windows);
+      std::vector<Bucket> rets;
+      ASSERT_TRUE(pippenger.RunBatch(test_set.bases.begin(),
+                                     test_set.bases.end(),
+                                     absl::MakeConstSpan(scalars_list), &rets));
+      ASSERT_EQ(rets.size(), scalars_list.size());
+      EXPECT_EQ(rets[0], test_set.answer);
+      for (size_t i = 1; i < scalars_list.size(); ++i) {
+        Bucket expected;
+        ASSERT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                  scalars_list[i].begin(),
+                                  scalars_list[i].end(), &expected));
+        EXPECT_EQ(rets[i], expected);
+      }
+    }
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithGLV) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  if constexpr (SupportsGLV<Point>::value) {
+    const MSMTestSet<Point>& test_set = this->test_set_;
+
+    for (bool use_glv : {false, true}) {
+      for (bool use_window_naf : {false, true}) {
+        Pippenger<Point> pippenger;
+        SCOPED_TRACE(absl::Substitute("use_glv: $0 use_window_naf: $1",
+                                      use_glv, use_window_naf));
+        pippenger.SetUseGLV(use_glv);
+        pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+        Bucket ret;
+        EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                  test_set.scalars.begin(),
+                                  test_set.scalars.end(), &ret));
+        EXPECT_EQ(ret, test_set.answer);
+      }
+    }
+  } else {
+    GTEST_SKIP() << "GLV is only for curves with an efficient endomorphism";
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithGLVAndZeroBases) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+  using AddResult = typename internal::AdditiveSemigroupTraits<Point>::ReturnTy;
+
+  if constexpr (SupportsGLV<Point>::value) {
+    std::vector<Point> bases = this->test_set_.bases;
+    const std::vector<typename Point::ScalarField>& scalars =
+        this->test_set_.scalars;
+    for (size_t i = 0; i < bases.size(); i += 3) {
+      bases[i] = Point::Zero();
+    }
+    AddResult sum = AddResult::Zero();
+    for (size_t i = 0; i < bases.size(); ++i) {
+      sum += bases[i] * scalars[i];
+    }
+    Bucket expected = ConvertPoint<Bucket>(sum);
+
+    for (bool use_window_naf : {false, true}) {
+      Pippenger<Point> pippenger;
+      SCOPED_TRACE(absl::Substitute("use_window_naf: $0", use_window_naf));
+      pippenger.SetUseGLV(true);
+      pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+      Bucket ret;
+      EXPECT_TRUE(pippenger.Run(bases.begin(), bases.end(), scalars.begin(),
+                                scalars.end(), &ret));
+      EXPECT_EQ(ret, expected);
+    }
+  } else {
+    GTEST_SKIP() << "GLV is only for curves with an efficient endomorphism";
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithBatchAffine) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  if constexpr (IsBatchAffineAccumulatable<Point>::value) {
+    const MSMTestSet<Point>& test_set = this->test_set_;
+
+    for (bool use_window_naf : {false, true}) {
+      Pippenger<Point> pippenger;
+      SCOPED_TRACE(absl::Substitute("use_window_naf: $0", use_window_naf));
+      pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+      pippenger.SetUseBatchAffine(true);
+      Bucket ret;
+      EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                test_set.scalars.begin(),
+                                test_set.scalars.end(), &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  } else {
+    GTEST_SKIP() << "Batch affine accumulation is only for affine points";
+  }
+}
+
 }  // namespace tachyon::math
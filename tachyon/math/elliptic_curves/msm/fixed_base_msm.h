@@ -0,0 +1,159 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_FIXED_BASE_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_FIXED_BASE_MSM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/parallel_for.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::math {
+
+// |FixedBaseMSM| computes s₀ * g, s₁ * g, ..., sₙ₋₁ * g for a single fixed
+// base g, for example, the generator of a KZG SRS. When it is created, it
+// stores every multiple of g for each window in affine form:
+//
+//   table[j][k] = k * 2^{c * j} * g for k in [1, 2^c), where c =
+//   |window_bits_|.
+//
+// Then sᵢ * g is the sum of table[j][dᵢⱼ] over the windows, where dᵢⱼ is the
+// j-th c-bit digit of sᵢ. Thus, there's no doubling at all and each scalar
+// costs at most |window_count_| mixed additions.
+template <typename Point>
+class FixedBaseMSM {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename Pippenger<Point>::Bucket;
+  using Curve = typename Point::Curve;
+
+  // The table holds |window_count_| * (2^c - 1) points, so the window is
+  // bounded to keep the table small enough for large SRS.
+  constexpr static size_t kMaxWindowBits = 16;
+
+  FixedBaseMSM() = default;
+  FixedBaseMSM(const Point& base, size_t window_bits)
+      : window_bits_(window_bits),
+        window_count_(
+            PippengerCtx::ComputeWindowsCount<ScalarField>(window_bits)) {
+    CHECK_GT(window_bits_, size_t{0});
+    CHECK_LE(window_bits_, kMaxWindowBits);
+    Precompute(base);
+  }
+
+  // Returns the window bits that minimize the cost of building the table and
+  // multiplying |num_scalars| scalars with it, which is approximately
+  // ⌈b / c⌉ * (2^c + |num_scalars|) additions, where b is the number of bits
+  // of the scalar field.
+  constexpr static size_t ComputeWindowBits(size_t num_scalars) {
+    size_t best_window_bits = 1;
+    size_t best_cost = std::numeric_limits<size_t>::max();
+    for (size_t c = 1; c <= kMaxWindowBits; ++c) {
+      size_t cost = PippengerCtx::ComputeWindowsCount<ScalarField>(c) *
+                    ((size_t{1} << c) + num_scalars);
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_window_bits = c;
+      }
+    }
+    return best_window_bits;
+  }
+
+  size_t window_bits() const { return window_bits_; }
+  size_t window_count() const { return window_count_; }
+
+  // Returns |scalar| * g.
+  Bucket ScalarMul(const ScalarField& scalar) const {
+    auto scalar_bigint = scalar.ToBigInt();
+    size_t row_size = (size_t{1} << window_bits_) - 1;
+    Bucket ret = Bucket::Zero();
+    for (size_t j = 0; j < window_count_; ++j) {
+      uint64_t digit = scalar_bigint.ExtractBits64(j * window_bits_,
+                                                   window_bits_);
+      if (digit != 0) {
+        ret += table_[j * row_size + digit - 1];
+      }
+    }
+    return ret;
+  }
+
+  // Computes [s₀ * g, s₁ * g, ..., sₙ₋₁ * g] into |outputs|. If the points of
+  // |outputs| are affine, they are normalized at once.
+  // Returns false if the sizes of |scalars| and |outputs| don't match.
+  template <typename ScalarContainer, typename OutputContainer>
+  [[nodiscard]] bool Run(const ScalarContainer& scalars,
+                         OutputContainer* outputs) const {
+    using Output = std::decay_t<decltype(*std::begin(*outputs))>;
+
+    size_t size = std::size(scalars);
+    if (size != std::size(*outputs)) {
+      LOG(ERROR) << "Size of |scalars| and |outputs| do not match";
+      return false;
+    }
+    if constexpr (std::is_same_v<Output, Bucket>) {
+      base::ParallelFor(0, size, [this, &scalars, outputs](size_t i) {
+        (*outputs)[i] = ScalarMul(scalars[i]);
+      });
+      return true;
+    } else {
+      std::vector<Bucket> buckets(size);
+      base::ParallelFor(0, size, [this, &scalars, &buckets](size_t i) {
+        buckets[i] = ScalarMul(scalars[i]);
+      });
+      if constexpr (std::is_same_v<Output, AffinePoint<Curve>>) {
+        return Bucket::BatchNormalize(buckets, outputs);
+      } else {
+        base::ParallelFor(0, size, [&buckets, outputs](size_t i) {
+          (*outputs)[i] = ConvertPoint<Output>(buckets[i]);
+        });
+        return true;
+      }
+    }
+  }
+
+ private:
+  void Precompute(const Point& base) {
+    size_t row_size = (size_t{1} << window_bits_) - 1;
+
+    // |row_bases[j]| = 2^{c * j} * g
+    std::vector<AffinePoint<Curve>> row_bases(window_count_);
+    std::vector<Bucket> row_bases_buckets(window_count_);
+    row_bases_buckets[0] = ConvertPoint<Bucket>(base);
+    for (size_t j = 1; j < window_count_; ++j) {
+      Bucket bucket = row_bases_buckets[j - 1];
+      for (size_t k = 0; k < window_bits_; ++k) {
+        bucket.DoubleInPlace();
+      }
+      row_bases_buckets[j] = std::move(bucket);
+    }
+    CHECK(Bucket::BatchNormalize(row_bases_buckets, &row_bases));
+
+    std::vector<Bucket> table(window_count_ * row_size);
+    base::ParallelFor(0, window_count_, [&table, &row_bases,
+                                         row_size](size_t j) {
+      Bucket* row = &table[j * row_size];
+      row[0] = ConvertPoint<Bucket>(row_bases[j]);
+      for (size_t k = 1; k < row_size; ++k) {
+        row[k] = row[k - 1] + row_bases[j];
+      }
+    });
+    table_.resize(table.size());
+    CHECK(Bucket::BatchNormalize(table, &table_));
+  }
+
+  size_t window_bits_ = 0;
+  size_t window_count_ = 0;
+  // |table_[j * (2^c - 1) + k - 1]| = k * 2^{c * j} * g
+  std::vector<AffinePoint<Curve>> table_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_FIXED_BASE_MSM_H_
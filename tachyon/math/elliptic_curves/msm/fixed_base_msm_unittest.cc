@@ -0,0 +1,119 @@
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
+
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+template <typename Point>
+class FixedBaseMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+
+  FixedBaseMSMTest() {
+    base_ = Point::Random();
+    scalars_ = {ScalarField::Zero(), ScalarField::One(), -ScalarField::One()};
+    for (size_t i = scalars_.size(); i < kSize; ++i) {
+      scalars_.push_back(ScalarField::Random());
+    }
+    answers_ = base::Map(scalars_, [this](const ScalarField& scalar) {
+      return ConvertPoint<Bucket>(base_ * scalar);
+    });
+  }
+  FixedBaseMSMTest(const FixedBaseMSMTest&) = delete;
+  FixedBaseMSMTest& operator=(const FixedBaseMSMTest&) = delete;
+  ~FixedBaseMSMTest() override = default;
+
+ protected:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename FixedBaseMSM<Point>::Bucket;
+
+  Point base_;
+  std::vector<ScalarField> scalars_;
+  std::vector<Bucket> answers_;
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1ProjectivePoint,
+                   bn254::G1JacobianPoint, bn254::G1PointXYZZ>;
+TYPED_TEST_SUITE(FixedBaseMSMTest, PointTypes);
+
+TYPED_TEST(FixedBaseMSMTest, ComputeWindowBits) {
+  using Point = TypeParam;
+
+  size_t prev = 0;
+  for (size_t size : {1, 32, 1024, 1 << 16, 1 << 24}) {
+    size_t window_bits = FixedBaseMSM<Point>::ComputeWindowBits(size);
+    EXPECT_GE(window_bits, prev);
+    EXPECT_LE(window_bits, FixedBaseMSM<Point>::kMaxWindowBits);
+    prev = window_bits;
+  }
+}
+
+TYPED_TEST(FixedBaseMSMTest, Run) {
+  using Point = TypeParam;
+  using Bucket = typename FixedBaseMSM<Point>::Bucket;
+
+  for (size_t window_bits : {1, 3, 8}) {
+    SCOPED_TRACE(absl::Substitute("window_bits: $0", window_bits));
+    FixedBaseMSM<Point> msm(this->base_, window_bits);
+    std::vector<Bucket> rets(kSize);
+    ASSERT_TRUE(msm.Run(this->scalars_, &rets));
+    EXPECT_EQ(rets, this->answers_);
+  }
+}
+
+TYPED_TEST(FixedBaseMSMTest, RunWithAffineOutputs) {
+  using Point = TypeParam;
+  using Curve = typename Point::Curve;
+
+  FixedBaseMSM<Point> msm(this->base_,
+                          FixedBaseMSM<Point>::ComputeWindowBits(kSize));
+  std::vector<AffinePoint<Curve>> rets(kSize);
+  ASSERT_TRUE(msm.Run(this->scalars_, &rets));
+  for (size_t i = 0; i < kSize; ++i) {
+    EXPECT_EQ(rets[i], ConvertPoint<AffinePoint<Curve>>(this->answers_[i]));
+  }
+
+  std::vector<AffinePoint<Curve>> wrong_size_rets(kSize - 1);
+  EXPECT_FALSE(msm.Run(this->scalars_, &wrong_size_rets));
+}
+
+// |MultiScalarMul()| with a single base and |BatchMapScalarFieldToPoint()|
+// are computed with |FixedBaseMSM|.
+TYPED_TEST(FixedBaseMSMTest, MultiScalarMulSingleBase) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename FixedBaseMSM<Point>::Bucket;
+  using Curve = typename Point::Curve;
+
+  static_assert(
+      internal::SupportsFixedBaseMultiScalarMul<
+          Point, std::vector<ScalarField>, std::vector<Bucket>>::value);
+  std::vector<Bucket> rets(kSize);
+  ASSERT_TRUE(Point::MultiScalarMul(this->scalars_, this->base_, &rets));
+  EXPECT_EQ(rets, this->answers_);
+
+  if constexpr (std::is_same_v<Point, AffinePoint<Curve>>) {
+    std::vector<AffinePoint<Curve>> affine_rets(kSize);
+    ASSERT_TRUE(Point::BatchMapScalarFieldToPoint(this->base_, this->scalars_,
+                                                  &affine_rets));
+    for (size_t i = 0; i < kSize; ++i) {
+      EXPECT_EQ(affine_rets[i],
+                ConvertPoint<AffinePoint<Curve>>(this->answers_[i]));
+    }
+  }
+}
+
+}  // namespace tachyon::math
@@ -6,18 +6,34 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_H_
 
-#include "tachyon/math/base/bit_iterator.h"
-#include "tachyon/math/base/gmp/bit_traits.h"
-#include "tachyon/math/base/gmp/signed_value.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/base/gmp/gmp_util.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/jacobian_point.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/projective_point.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
-#include "tachyon/math/matrix/gmp_num_traits.h"
 
 namespace tachyon::math {
 
+// |SupportsGLV<Point>::value| is true if the curve of |Point| has an efficient
+// endomorphism φ(P) = λ * P and its GLV lattice basis.
+template <typename Point, typename SFINAE = void>
+struct SupportsGLV : std::false_type {};
+
+template <typename Point>
+struct SupportsGLV<
+    Point, std::void_t<decltype(Point::Curve::Config::kGLVCoeffs)>>
+    : std::true_type {};
+
 template <typename Point>
 class GLV {
  public:
@@ -25,52 +41,59 @@ class GLV {
   using ScalarField = typename Point::ScalarField;
   using RetPoint = typename internal::AdditiveSemigroupTraits<Point>::ReturnTy;
 
+  constexpr static size_t N = ScalarField::kLimbNums;
+
+  // NOTE(chokobole): The values are computed modulo 2^{64 * N} in two's
+  // complement, which is exact because |k1| and |k2| are about half of the
+  // size of the scalar field. This needs a spare limb for the sign.
+  static_assert(N >= 2, "GLV needs at least 2 limbs for the scalar field");
+
+  // k = k1 + λ * k2, where k1 and k2 are negated if |k1_is_negative| and
+  // |k2_is_negative| are true respectively.
   struct CoefficientDecompositionResult {
-    SignedValue<mpz_class> k1;
-    SignedValue<mpz_class> k2;
+    BigInt<N> k1;
+    BigInt<N> k2;
+    bool k1_is_negative = false;
+    bool k2_is_negative = false;
   };
 
   static Point Endomorphism(const Point& point) {
     return Point::Endomorphism(point);
   }
+
   // Decomposes a scalar |k| into k1, k2, s.t. k = k1 + lambda k2,
+  //
+  // Let the lattice basis be [[n₁₁, n₁₂], [n₂₁, n₂₂]] and r be the modulus of
+  // the scalar field. Then β₁ = ⌊k * n₂₂ / r⌋ and β₂ = ⌊-k * n₁₂ / r⌋ and
+  //
+  //   k1 = k - β₁ * n₁₁ - β₂ * n₂₁
+  //   k2 = -β₁ * n₁₂ - β₂ * n₂₂
+  //
+  // The divisions are replaced with the multiplications by the precomputed
+  // gᵢ = round(2^{64 * N} * |nᵢ| / r) followed by taking the upper N limbs.
+  // β₁ and β₂ may be off by a small amount, but k1 and k2 are still about
+  // half of the size of the scalar field. See
+  // https://eprint.iacr.org/2013/158.pdf
   static CoefficientDecompositionResult Decompose(const ScalarField& k) {
-    using Config = typename Point::Curve::Config;
-
-    Eigen::Matrix<mpz_class, 2, 2> coefficients(
-        {{Config::kGLVCoeffs[0], Config::kGLVCoeffs[1]},
-         {Config::kGLVCoeffs[2], Config::kGLVCoeffs[3]}});
-
-    decltype(auto) scalar = k.ToMpzClass();
-    const mpz_class& n12 = coefficients(0, 1);
-    const mpz_class& n22 = coefficients(1, 1);
-    mpz_class r;
-    gmp::WriteLimbs(ScalarField::Config::kModulus.limbs, ScalarField::kLimbNums,
-                    &r);
-
-    // clang-format off
-    // NOTE(chokobole): We can't calculate using below directly.
-    //
-    // Eigen::Matrix<mpz_class, 1, 2>(scalar, mpz_class(0)) * coefficients.inverse()
-    //
-    // Eigen matrix emits an error like below:
-    //
-    // external/eigen_archive/Eigen/src/LU/InverseImpl.h:352:3: error: static assertion failed: THIS_FUNCTION_IS_NOT_FOR_INTEGER_NUMERIC_TYPES
-    // 352 |   EIGEN_STATIC_ASSERT(!NumTraits<Scalar>::IsInteger,THIS_FUNCTION_IS_NOT_FOR_INTEGER_NUMERIC_TYPES)
-    // clang-format on
-    mpz_class beta_1 = scalar * n22 / r;
-    mpz_class beta_2 = scalar * (-n12) / r;
-
-    Eigen::Matrix<mpz_class, 1, 2> b =
-        Eigen::Matrix<mpz_class, 1, 2>{beta_1, beta_2} * coefficients;
-
-    // k1
-    mpz_class k1 = scalar - b[0];
-
-    // k2
-    mpz_class k2 = -b[1];
-
-    return {SignedValue<mpz_class>(k1), SignedValue<mpz_class>(k2)};
+    const Constants& constants = GetConstants();
+    BigInt<N> scalar = k.ToBigInt();
+
+    BigInt<N> beta1 = MulHigh(scalar, constants.g1);
+    BigInt<N> beta2 = MulHigh(scalar, constants.g2);
+    if (constants.g1_is_negative) beta1 = Negate(beta1);
+    if (constants.g2_is_negative) beta2 = Negate(beta2);
+
+    // NOTE(chokobole): |BigInt| wraps around on overflow, so these are the
+    // values modulo 2^{64 * N}.
+    BigInt<N> k1 = scalar - constants.n[0] * beta1 - constants.n[2] * beta2;
+    BigInt<N> k2 = Negate(constants.n[1] * beta1) - constants.n[3] * beta2;
+
+    CoefficientDecompositionResult ret;
+    ret.k1_is_negative = IsNegative(k1);
+    ret.k2_is_negative = IsNegative(k2);
+    ret.k1 = ret.k1_is_negative ? Negate(k1) : k1;
+    ret.k2 = ret.k2_is_negative ? Negate(k2) : k2;
+    return ret;
   }
 
   static RetPoint Mul(const Point& p, const ScalarField& k) {
@@ -79,48 +102,109 @@ class GLV {
     Point b1 = p;
     Point b2 = Endomorphism(p);
 
-    if (result.k1.sign == Sign::kNegative) {
+    if (result.k1_is_negative) {
       b1.NegInPlace();
     }
-    if (result.k2.sign == Sign::kNegative) {
+    if (result.k2_is_negative) {
       b2.NegInPlace();
     }
 
     RetPoint b1b2 = b1 + b2;
 
-    auto k1_begin = BitIteratorBE<mpz_class>::begin(&result.k1.abs_value);
-    auto k1_end = BitIteratorBE<mpz_class>::end(&result.k1.abs_value);
-    auto k2_begin = BitIteratorBE<mpz_class>::begin(&result.k2.abs_value);
-
     RetPoint ret = RetPoint::Zero();
-    bool skip_zeros = true;
-    auto k1_it = k1_begin;
-    auto k2_it = k2_begin;
-    while (k1_it != k1_end) {
-      if (skip_zeros && !(*k1_it) && !(*k2_it)) {
-        skip_zeros = false;
-        ++k1_it;
-        ++k2_it;
-        continue;
-      }
-      skip_zeros = false;
+    size_t bits = std::max(GetNumBits(result.k1), GetNumBits(result.k2));
+    for (size_t i = bits - 1; i != static_cast<size_t>(-1); --i) {
       ret.DoubleInPlace();
-      if ((*k1_it)) {
-        if (*(k2_it)) {
+      bool k1_bit = BitTraits<BigInt<N>>::TestBit(result.k1, i);
+      bool k2_bit = BitTraits<BigInt<N>>::TestBit(result.k2, i);
+      if (k1_bit) {
+        if (k2_bit) {
           ret += b1b2;
         } else {
           ret += b1;
         }
-      } else {
-        if (*(k2_it)) {
-          ret += b2;
-        }
+      } else if (k2_bit) {
+        ret += b2;
+      }
+    }
+    return ret;
+  }
+
+  // Returns the number of bits of |value|.
+  static size_t GetNumBits(const BigInt<N>& value) {
+    for (size_t i = N; i > 0; --i) {
+      if (value[i - 1] != 0) {
+        return 64 * (i - 1) + base::bits::Log2Floor(value[i - 1]) + 1;
       }
-      ++k1_it;
-      ++k2_it;
     }
+    return 0;
+  }
+
+ private:
+  struct Constants {
+    // The lattice basis n₁₁, n₁₂, n₂₁ and n₂₂ in two's complement.
+    BigInt<N> n[4];
+    // g₁ = round(2^{64 * N} * |n₂₂| / r), g₂ = round(2^{64 * N} * |n₁₂| / r)
+    BigInt<N> g1;
+    BigInt<N> g2;
+    // Whether β₁ and β₂ have to be negated, which are the signs of n₂₂ and
+    // -n₁₂.
+    bool g1_is_negative;
+    bool g2_is_negative;
+  };
+
+  // NOTE(chokobole): The lattice basis is set by |Point::Curve::Init()|, so
+  // the constants are computed on the first use.
+  static const Constants& GetConstants() {
+    static const Constants constants = ComputeConstants();
+    return constants;
+  }
+
+  static Constants ComputeConstants() {
+    using Config = typename Point::Curve::Config;
+
+    mpz_class r;
+    gmp::WriteLimbs(ScalarField::Config::kModulus.limbs, N, &r);
+    mpz_class two_pow = mpz_class(1) << (64 * N);
+
+    Constants ret;
+    for (size_t i = 0; i < 4; ++i) {
+      const mpz_class& coeff = Config::kGLVCoeffs[i];
+      ret.n[i] = ToBigInt(gmp::GetAbs(coeff));
+      if (gmp::IsNegative(coeff)) ret.n[i] = Negate(ret.n[i]);
+    }
+    const mpz_class& n12 = Config::kGLVCoeffs[1];
+    const mpz_class& n22 = Config::kGLVCoeffs[3];
+    ret.g1 = ToBigInt((two_pow * gmp::GetAbs(n22) + r / 2) / r);
+    ret.g2 = ToBigInt((two_pow * gmp::GetAbs(n12) + r / 2) / r);
+    ret.g1_is_negative = gmp::IsNegative(n22);
+    ret.g2_is_negative = gmp::IsPositive(n12);
     return ret;
   }
+
+  static BigInt<N> ToBigInt(const mpz_class& value) {
+    CHECK_LE(gmp::GetLimbSize(value), N);
+    BigInt<N> ret;
+    gmp::CopyLimbs(value, ret.limbs);
+    return ret;
+  }
+
+  // Returns ⌊|a| * |b| / 2^{64 * N}⌋.
+  static BigInt<N> MulHigh(const BigInt<N>& a, const BigInt<N>& b) {
+    BigInt<N> hi;
+    BigInt<N> lo = a;
+    lo.MulInPlace(b, hi);
+    return hi;
+  }
+
+  // Returns -|value| mod 2^{64 * N}.
+  static BigInt<N> Negate(const BigInt<N>& value) {
+    return BigInt<N>::Zero() - value;
+  }
+
+  static bool IsNegative(const BigInt<N>& value) {
+    return (value[N - 1] >> 63) != 0;
+  }
 };
 
 }  // namespace tachyon::math
@@ -1,5 +1,7 @@
 #include "tachyon/math/elliptic_curves/msm/glv.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/g1.h"
@@ -37,23 +39,36 @@ TYPED_TEST(GLVTest, Endomorphism) {
   Point base = Point::Random();
   EXPECT_EQ(base * Point::Curve::Config::kLambda,
             ConvertPoint<RetPoint>(Point::Endomorphism(base)));
+  EXPECT_TRUE(Point::Endomorphism(Point::Zero()).IsZero());
 }
 
 TYPED_TEST(GLVTest, Decompose) {
   using Point = TypeParam;
   using ScalarField = typename Point::ScalarField;
 
-  ScalarField scalar = ScalarField::Random();
-  auto result = GLV<Point>::Decompose(scalar);
-  ScalarField k1 = ScalarField::FromMpzClass(result.k1.abs_value);
-  ScalarField k2 = ScalarField::FromMpzClass(result.k2.abs_value);
-  if (result.k1.sign == Sign::kNegative) {
-    k1.NegInPlace();
+  std::vector<ScalarField> scalars = {ScalarField::Zero(), ScalarField::One(),
+                                      -ScalarField::One(),
+                                      Point::Curve::Config::kLambda};
+  for (size_t i = 0; i < 100; ++i) {
+    scalars.push_back(ScalarField::Random());
   }
-  if (result.k2.sign == Sign::kNegative) {
-    k2.NegInPlace();
+  for (const ScalarField& scalar : scalars) {
+    auto result = GLV<Point>::Decompose(scalar);
+    // Both k1 and k2 should be about half of the size of the scalar field.
+    EXPECT_LE(GLV<Point>::GetNumBits(result.k1),
+              ScalarField::kModulusBits / 2 + 2);
+    EXPECT_LE(GLV<Point>::GetNumBits(result.k2),
+              ScalarField::kModulusBits / 2 + 2);
+    ScalarField k1 = ScalarField::FromBigInt(result.k1);
+    ScalarField k2 = ScalarField::FromBigInt(result.k2);
+    if (result.k1_is_negative) {
+      k1.NegInPlace();
+    }
+    if (result.k2_is_negative) {
+      k2.NegInPlace();
+    }
+    EXPECT_EQ(scalar, k1 + Point::Curve::Config::kLambda * k2);
   }
-  EXPECT_EQ(scalar, k1 + Point::Curve::Config::kLambda * k2);
 }
 
 TYPED_TEST(GLVTest, Mul) {
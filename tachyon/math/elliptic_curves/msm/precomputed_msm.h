@@ -0,0 +1,182 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_MSM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/base/threading/parallel_for.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_buckets.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::math {
+
+// |PrecomputedMSM| is a MSM over a fixed set of bases, for example, the
+// powers of tau of a KZG SRS. When it is created, it stores the per-window
+// multiples of each base:
+//
+//   table[j][i] = 2^{c * j} * gᵢ, where c = |window_bits_|.
+//
+// With the table, s₀ * g₀ + s₁ * g₁ + ... + sₙ₋₁ * gₙ₋₁ is computed as a
+// single pass of bucket additions, because every window digit dᵢⱼ of sᵢ can
+// be added to one shared set of buckets as dᵢⱼ * table[j][i]. Thus, there's no
+// doubling chain between the windows.
+//
+// The table holds |window_count_| * n points, so this trades memory for
+// speed. A larger |window_bits| makes the table smaller.
+template <typename Point>
+class PrecomputedMSM {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  constexpr static size_t kDefaultParallelThreshold = 1024;
+
+  PrecomputedMSM() = default;
+  template <typename BaseContainer>
+  explicit PrecomputedMSM(const BaseContainer& bases)
+      : PrecomputedMSM(bases,
+                       PippengerCtx::ComputeWindowsBits(std::size(bases))) {}
+  template <typename BaseContainer>
+  PrecomputedMSM(const BaseContainer& bases, size_t window_bits)
+      : size_(std::size(bases)),
+        window_bits_(window_bits),
+        window_count_(
+            PippengerCtx::ComputeWindowsCount<ScalarField>(window_bits)) {
+    CHECK_GT(window_bits_, size_t{0});
+    CHECK_LT(window_bits_, size_t{64});
+    Precompute(bases);
+  }
+
+  size_t size() const { return size_; }
+  size_t window_bits() const { return window_bits_; }
+  size_t window_count() const { return window_count_; }
+
+  // Returns 2^{c * |window|} * g_|idx|.
+  const Point& GetBase(size_t window, size_t idx) const {
+    return table_[window * size_ + idx];
+  }
+
+  // Computes s₀ * g₀ + s₁ * g₁ + ... + sₘ₋₁ * gₘ₋₁ with the first m
+  // precomputed bases, where m is the size of |scalars|.
+  // Returns false if m is greater than |size()|.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool Run(const ScalarContainer& scalars, Bucket* ret) const {
+    size_t scalars_size = std::size(scalars);
+    if (scalars_size > size_) {
+      LOG(ERROR) << "Too many scalars: " << scalars_size << " vs " << size_;
+      return false;
+    }
+    if (scalars_size == 0) {
+      *ret = Bucket::Zero();
+      return true;
+    }
+
+    // NOTE(chokobole): |scalars_span| has to be const, otherwise the chunks
+    // are deduced as |absl::Span<ScalarField>|.
+    const absl::Span<const ScalarField> scalars_span =
+        absl::MakeConstSpan(scalars);
+    std::vector<Bucket> results = base::ParallelizeMap(
+        scalars_span,
+        [this](absl::Span<const ScalarField> chunk, size_t chunk_idx,
+               size_t chunk_size) {
+          return AccumulateChunk(chunk, chunk_idx * chunk_size);
+        },
+        kDefaultParallelThreshold);
+    *ret = std::accumulate(results.begin(), results.end(), Bucket::Zero(),
+                           [](Bucket& total, const Bucket& result) {
+                             return total += result;
+                           });
+    return true;
+  }
+
+ private:
+  template <typename BaseContainer>
+  void Precompute(const BaseContainer& bases) {
+    table_.resize(window_count_ * size_);
+    auto bases_it = std::begin(bases);
+    for (size_t i = 0; i < size_; ++i, ++bases_it) {
+      table_[i] = *bases_it;
+    }
+
+    std::vector<Bucket> doubled(size_);
+    for (size_t j = 1; j < window_count_; ++j) {
+      const Point* prev = &table_[(j - 1) * size_];
+      base::ParallelFor(0, size_, [this, prev, &doubled](size_t i) {
+        Bucket bucket = ConvertPoint<Bucket>(prev[i]);
+        for (size_t k = 0; k < window_bits_; ++k) {
+          bucket.DoubleInPlace();
+        }
+        doubled[i] = std::move(bucket);
+      });
+      absl::Span<Point> cur(&table_[j * size_], size_);
+      if constexpr (std::is_same_v<Point, AffinePoint<typename Point::Curve>>) {
+        CHECK(Bucket::BatchNormalize(doubled, &cur));
+      } else {
+        base::ParallelFor(0, size_, [&cur, &doubled](size_t i) {
+          cur[i] = ConvertPoint<Point>(doubled[i]);
+        });
+      }
+    }
+  }
+
+  Bucket AccumulateChunk(absl::Span<const ScalarField> scalars,
+                         size_t offset) const {
+    // The signed digits are in [-2^{c - 1}, 2^{c - 1}) except the last one,
+    // which can be up to 2^c. See |FillDigits()|.
+    size_t bucket_size = size_t{1} << window_bits_;
+    std::vector<int64_t> digits(window_count_);
+    if constexpr (IsBatchAffineAccumulatable<Point>::value) {
+      BatchAffineBuckets<Point> buckets(bucket_size);
+      for (size_t i = 0; i < scalars.size(); ++i) {
+        FillDigits(scalars[i].ToBigInt(), window_bits_, &digits);
+        for (size_t j = 0; j < window_count_; ++j) {
+          int64_t digit = digits[j];
+          if (0 < digit) {
+            buckets.Add(static_cast<uint64_t>(digit - 1),
+                        GetBase(j, offset + i));
+          } else if (0 > digit) {
+            buckets.Sub(static_cast<uint64_t>(-digit - 1),
+                        GetBase(j, offset + i));
+          }
+        }
+      }
+      return buckets.Accumulate();
+    } else {
+      std::vector<Bucket> buckets(bucket_size, Bucket::Zero());
+      for (size_t i = 0; i < scalars.size(); ++i) {
+        FillDigits(scalars[i].ToBigInt(), window_bits_, &digits);
+        for (size_t j = 0; j < window_count_; ++j) {
+          int64_t digit = digits[j];
+          if (0 < digit) {
+            buckets[static_cast<uint64_t>(digit - 1)] += GetBase(j, offset + i);
+          } else if (0 > digit) {
+            buckets[static_cast<uint64_t>(-digit - 1)] -=
+                GetBase(j, offset + i);
+          }
+        }
+      }
+      return PippengerBase<Point>::AccumulateBuckets(
+          absl::MakeConstSpan(buckets));
+    }
+  }
+
+  size_t size_ = 0;
+  size_t window_bits_ = 0;
+  size_t window_count_ = 0;
+  // |table_[j * size_ + i]| = 2^{c * j} * gᵢ
+  std::vector<Point> table_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_MSM_H_
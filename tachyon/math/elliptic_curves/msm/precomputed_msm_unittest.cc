@@ -0,0 +1,75 @@
+#include "tachyon/math/elliptic_curves/msm/precomputed_msm.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+template <typename Point>
+class PrecomputedMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+
+  PrecomputedMSMTest()
+      : test_set_(MSMTestSet<Point>::Random(kSize, MSMMethod::kNaive)) {}
+  PrecomputedMSMTest(const PrecomputedMSMTest&) = delete;
+  PrecomputedMSMTest& operator=(const PrecomputedMSMTest&) = delete;
+  ~PrecomputedMSMTest() override = default;
+
+ protected:
+  MSMTestSet<Point> test_set_;
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1ProjectivePoint,
+                   bn254::G1JacobianPoint, bn254::G1PointXYZZ>;
+TYPED_TEST_SUITE(PrecomputedMSMTest, PointTypes);
+
+TYPED_TEST(PrecomputedMSMTest, Run) {
+  using Point = TypeParam;
+  using Bucket = typename PrecomputedMSM<Point>::Bucket;
+
+  const MSMTestSet<Point>& test_set = this->test_set_;
+
+  for (size_t window_bits : {3, 8, 16}) {
+    SCOPED_TRACE(absl::Substitute("window_bits: $0", window_bits));
+    PrecomputedMSM<Point> msm(test_set.bases, window_bits);
+    Bucket ret;
+    ASSERT_TRUE(msm.Run(test_set.scalars, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(PrecomputedMSMTest, RunWithFewerScalars) {
+  using Point = TypeParam;
+  using Bucket = typename PrecomputedMSM<Point>::Bucket;
+  using ScalarField = typename Point::ScalarField;
+
+  const MSMTestSet<Point>& test_set = this->test_set_;
+  PrecomputedMSM<Point> msm(test_set.bases);
+
+  std::vector<ScalarField> scalars(test_set.scalars.begin(),
+                                   test_set.scalars.begin() + kSize / 2);
+  Bucket expected;
+  VariableBaseMSM<Point> variable_base_msm;
+  ASSERT_TRUE(variable_base_msm.Run(
+      absl::MakeConstSpan(test_set.bases).subspan(0, kSize / 2), scalars,
+      &expected));
+
+  Bucket ret;
+  ASSERT_TRUE(msm.Run(scalars, &ret));
+  EXPECT_EQ(ret, expected);
+
+  std::vector<ScalarField> too_many_scalars(kSize + 1, ScalarField::One());
+  EXPECT_FALSE(msm.Run(too_many_scalars, &ret));
+}
+
+}  // namespace tachyon::math
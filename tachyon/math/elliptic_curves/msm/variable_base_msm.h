@@ -2,7 +2,11 @@
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 
 #include <utility>
+#include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
 
 namespace tachyon::math {
@@ -33,6 +37,19 @@ class VariableBaseMSM {
     return Run(std::begin(bases), std::end(bases), std::begin(scalars),
                std::end(scalars), ret);
   }
+
+  // Runs an MSM with |bases| for each container in |scalars_list| and
+  // stores the results in |rets|. This is faster than calling |Run()| for
+  // each of them, because every base is read once per window for the whole
+  // batch. See |Pippenger::RunBatch()|.
+  template <typename BaseContainer, typename ScalarContainer>
+  bool RunBatch(const BaseContainer& bases,
+                absl::Span<const ScalarContainer> scalars_list,
+                std::vector<Bucket>* rets) {
+    Pippenger<Point> pippenger;
+    return pippenger.RunBatch(std::begin(bases), std::end(bases),
+                              scalars_list, rets);
+  }
 };
 
 }  // namespace tachyon::math
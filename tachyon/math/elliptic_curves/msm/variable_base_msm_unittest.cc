@@ -1,5 +1,8 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 #include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
 
@@ -43,4 +46,34 @@ TYPED_TEST(VariableBaseMSMTest, DoMSM) {
   EXPECT_EQ(ret, test_set.answer);
 }
 
+TYPED_TEST(VariableBaseMSMTest, RunBatch) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename VariableBaseMSM<Point>::Bucket;
+
+  const MSMTestSet<Point>& test_set = this->test_set_;
+
+  std::vector<std::vector<ScalarField>> scalars_list = {
+      test_set.scalars,
+      base::CreateVector(kSize, []() { return ScalarField::Random(); }),
+      base::CreateVector(kSize, ScalarField::Zero()),
+      base::CreateVector(kSize, ScalarField::One()),
+  };
+
+  VariableBaseMSM<Point> msm;
+  std::vector<Bucket> rets;
+  ASSERT_TRUE(msm.RunBatch(test_set.bases, absl::MakeConstSpan(scalars_list),
+                           &rets));
+  ASSERT_EQ(rets.size(), scalars_list.size());
+  for (size_t i = 0; i < scalars_list.size(); ++i) {
+    Bucket expected;
+    ASSERT_TRUE(msm.Run(test_set.bases, scalars_list[i], &expected));
+    EXPECT_EQ(rets[i], expected);
+  }
+
+  scalars_list.push_back(base::CreateVector(kSize - 1, ScalarField::One()));
+  EXPECT_FALSE(msm.RunBatch(test_set.bases, absl::MakeConstSpan(scalars_list),
+                            &rets));
+}
+
 }  // namespace tachyon::math
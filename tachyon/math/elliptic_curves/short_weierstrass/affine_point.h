@@ -16,6 +16,7 @@
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/curve_type.h"
 #include "tachyon/math/elliptic_curves/jacobian_point.h"
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/projective_point.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
@@ -101,10 +102,26 @@ class AffinePoint<
   }
 
   constexpr static AffinePoint Endomorphism(const AffinePoint& point) {
+    if (point.IsZero()) return point;
     return AffinePoint(point.x_ * Curve::Config::kEndomorphismCoefficient,
                        point.y_);
   }
 
+  // Computes [s₀ * |base|, s₁ * |base|, ..., sₙ₋₁ * |base|] into |outputs|
+  // with |FixedBaseMSM|. See |AdditiveSemigroup::MultiScalarMul()|.
+  template <typename ScalarContainer, typename OutputContainer,
+            std::enable_if_t<std::is_same_v<
+                base::container_value_t<ScalarContainer>, ScalarField>>* =
+                nullptr>
+  [[nodiscard]] static bool FixedBaseMultiScalarMul(
+      const ScalarContainer& scalars, const AffinePoint& base,
+      OutputContainer* outputs) {
+    size_t window_bits =
+        FixedBaseMSM<AffinePoint>::ComputeWindowBits(std::size(scalars));
+    FixedBaseMSM<AffinePoint> msm(base, window_bits);
+    return msm.Run(scalars, outputs);
+  }
+
   template <typename ScalarFieldContainer, typename AffineContainer>
   [[nodiscard]] constexpr static bool BatchMapScalarFieldToPoint(
       const AffinePoint& point, const ScalarFieldContainer& scalar_fields,
@@ -114,10 +131,8 @@ class AffinePoint<
       LOG(ERROR) << "Size of |scalar_fields| and |affine_points| do not match";
       return false;
     }
-    std::vector<JacobianPoint<Curve>> jacobian_points = base::Map(
-        scalar_fields,
-        [&point](const ScalarField& scalar) { return scalar * point; });
-    return JacobianPoint<Curve>::BatchNormalize(jacobian_points, affine_points);
+    if (size == 0) return true;
+    return FixedBaseMultiScalarMul(scalar_fields, point, affine_points);
   }
 
   constexpr const BaseField& x() const { return x_; }
@@ -0,0 +1,80 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_BATCH_NORMALIZE_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_BATCH_NORMALIZE_H_
+
+#include <stddef.h>
+
+#include <limits>
+#include <utility>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/elliptic_curves/affine_point.h"
+
+namespace tachyon::math::internal {
+
+// NOTE(chokobole): A chunk smaller than this spends more time on its own
+// inversion than on the batch.
+constexpr size_t kBatchNormalizeParallelThreshold = 1024;
+
+// Converts |points| into |affine_points| with Montgomery's trick. The points
+// are split into chunks that run in parallel, and each chunk inverts the
+// denominators with a single field inversion. The x coordinates of
+// |affine_points| hold the prefix products of the denominators while the
+// chunk is processed, so no temporary vector is allocated.
+//
+// |get_denominator(point)| returns the value to be inverted, which is zero iff
+// the point is at infinity. |to_affine(point, inverse)| returns the affine
+// point, where |inverse| is the inverse of |get_denominator(point)|.
+template <typename Point, typename GetDenominator, typename ToAffine>
+[[nodiscard]] bool BatchNormalize(
+    absl::Span<const Point> points,
+    absl::Span<AffinePoint<typename Point::Curve>> affine_points,
+    GetDenominator get_denominator, ToAffine to_affine) {
+  using Curve = typename Point::Curve;
+  using BaseField = typename Point::BaseField;
+
+  if (points.size() != affine_points.size()) {
+    LOG(ERROR) << "Size of |points| and |affine_points| do not match";
+    return false;
+  }
+  base::Parallelize(
+      affine_points,
+      [&points, &get_denominator, &to_affine](
+          absl::Span<AffinePoint<Curve>> chunk, size_t chunk_idx,
+          size_t chunk_size) {
+        absl::Span<const Point> points_chunk =
+            points.subspan(chunk_idx * chunk_size, chunk.size());
+
+        // First pass: chunk[i].x = d₀ * d₁ * ... * dᵢ₋₁, skipping the zeros.
+        BaseField product = BaseField::One();
+        for (size_t i = 0; i < chunk.size(); ++i) {
+          const BaseField& denominator = get_denominator(points_chunk[i]);
+          chunk[i] = {product, BaseField::Zero()};
+          if (!denominator.IsZero()) {
+            product *= denominator;
+          }
+        }
+
+        // Second pass: dᵢ⁻¹ = (d₀ * d₁ * ... * dᵢ)⁻¹ * (d₀ * d₁ * ... * dᵢ₋₁)
+        BaseField product_inv = product.Inverse();
+        for (size_t i = chunk.size() - 1;
+             i != std::numeric_limits<size_t>::max(); --i) {
+          const BaseField& denominator = get_denominator(points_chunk[i]);
+          if (denominator.IsZero()) {
+            chunk[i] = AffinePoint<Curve>::Zero();
+          } else {
+            BaseField inverse = product_inv * chunk[i].x();
+            product_inv *= denominator;
+            chunk[i] = to_affine(points_chunk[i], inverse);
+          }
+        }
+      },
+      kBatchNormalizeParallelThreshold);
+  return true;
+}
+
+}  // namespace tachyon::math::internal
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_BATCH_NORMALIZE_H_
@@ -17,8 +17,10 @@
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/curve_type.h"
 #include "tachyon/math/elliptic_curves/jacobian_point.h"
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/projective_point.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/batch_normalize.h"
 #include "tachyon/math/geometry/point3.h"
 
 namespace tachyon {
@@ -106,34 +108,38 @@ class JacobianPoint<
                          point.y_, point.z_);
   }
 
-  // TODO(chokobole): Implement parallel versioned |BatchNormalize| when doing
-  // chunking and zipping gets easier.
+  // Computes [s₀ * |base|, s₁ * |base|, ..., sₙ₋₁ * |base|] into |outputs|
+  // with |FixedBaseMSM|. See |AdditiveSemigroup::MultiScalarMul()|.
+  template <typename ScalarContainer, typename OutputContainer,
+            std::enable_if_t<std::is_same_v<
+                base::container_value_t<ScalarContainer>, ScalarField>>* =
+                nullptr>
+  [[nodiscard]] static bool FixedBaseMultiScalarMul(
+      const ScalarContainer& scalars, const JacobianPoint& base,
+      OutputContainer* outputs) {
+    size_t window_bits =
+        FixedBaseMSM<JacobianPoint>::ComputeWindowBits(std::size(scalars));
+    FixedBaseMSM<JacobianPoint> msm(base, window_bits);
+    return msm.Run(scalars, outputs);
+  }
+
+  // Converts |jacobian_points| into |affine_points| in parallel chunks,
+  // writing straight into |affine_points|. See |internal::BatchNormalize()|.
   template <typename JacobianContainer, typename AffineContainer>
   [[nodiscard]] constexpr static bool BatchNormalize(
       const JacobianContainer& jacobian_points,
       AffineContainer* affine_points) {
-    size_t size = std::size(jacobian_points);
-    if (size != std::size(*affine_points)) {
-      LOG(ERROR)
-          << "Size of |jacobian_points| and |affine_points| do not match";
-      return false;
-    }
-    std::vector<BaseField> z_inverses = base::Map(
-        jacobian_points, [](const JacobianPoint& point) { return point.z_; });
-    if (!BaseField::BatchInverseInPlaceSerial(z_inverses)) return false;
-    for (size_t i = 0; i < size; ++i) {
-      const BaseField& z_inv = z_inverses[i];
-      if (z_inv.IsZero()) {
-        (*affine_points)[i] = AffinePoint<Curve>::Zero();
-      } else if (z_inv.IsOne()) {
-        (*affine_points)[i] = {jacobian_points[i].x_, jacobian_points[i].y_};
-      } else {
-        BaseField z_inv_square = z_inv.Square();
-        (*affine_points)[i] = {jacobian_points[i].x_ * z_inv_square,
-                               jacobian_points[i].y_ * z_inv_square * z_inv};
-      }
-    }
-    return true;
+    return internal::BatchNormalize(
+        absl::MakeConstSpan(jacobian_points), absl::MakeSpan(*affine_points),
+        [](const JacobianPoint& point) -> const BaseField& {
+          return point.z_;
+        },
+        [](const JacobianPoint& point, const BaseField& z_inv) {
+          if (z_inv.IsOne()) return AffinePoint<Curve>(point.x_, point.y_);
+          BaseField z_inv_square = z_inv.Square();
+          return AffinePoint<Curve>(point.x_ * z_inv_square,
+                                    point.y_ * z_inv_square * z_inv);
+        });
   }
 
   constexpr const BaseField& x() const { return x_; }
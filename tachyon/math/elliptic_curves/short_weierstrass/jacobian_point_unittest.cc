@@ -186,6 +186,24 @@ TEST_F(JacobianPointTest, BatchNormalize) {
   EXPECT_EQ(affine_points, expected_affine_points);
 }
 
+TEST_F(JacobianPointTest, BatchNormalizeInChunks) {
+  // Large enough to be split into chunks.
+  std::vector<test::JacobianPoint> jacobian_points =
+      base::CreateVector(5000, [](size_t i) {
+        if (i % 7 == 0) return test::JacobianPoint::Zero();
+        return test::JacobianPoint::Random();
+      });
+
+  std::vector<test::AffinePoint> affine_points(jacobian_points.size());
+  ASSERT_TRUE(
+      test::JacobianPoint::BatchNormalize(jacobian_points, &affine_points));
+
+  std::vector<test::AffinePoint> expected_affine_points = base::Map(
+      jacobian_points,
+      [](const test::JacobianPoint& point) { return point.ToAffine(); });
+  EXPECT_EQ(affine_points, expected_affine_points);
+}
+
 TEST_F(JacobianPointTest, IsOnCurve) {
   test::JacobianPoint invalid_point(GF7(1), GF7(2), GF7(1));
   EXPECT_FALSE(invalid_point.IsOnCurve());
@@ -15,8 +15,10 @@
 #include "tachyon/math/base/groups.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/curve_type.h"
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/projective_point.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/batch_normalize.h"
 #include "tachyon/math/geometry/point4.h"
 
 namespace tachyon {
@@ -110,33 +112,40 @@ class PointXYZZ<_Curve,
                      point.y_, point.zz_, point.zzz_);
   }
 
-  // TODO(chokobole): Implement parallel versioned |BatchNormalize| when doing
-  // chunking and zipping gets easier.
+  // Computes [s₀ * |base|, s₁ * |base|, ..., sₙ₋₁ * |base|] into |outputs|
+  // with |FixedBaseMSM|. See |AdditiveSemigroup::MultiScalarMul()|.
+  template <typename ScalarContainer, typename OutputContainer,
+            std::enable_if_t<std::is_same_v<
+                base::container_value_t<ScalarContainer>, ScalarField>>* =
+                nullptr>
+  [[nodiscard]] static bool FixedBaseMultiScalarMul(
+      const ScalarContainer& scalars, const PointXYZZ& base,
+      OutputContainer* outputs) {
+    size_t window_bits =
+        FixedBaseMSM<PointXYZZ>::ComputeWindowBits(std::size(scalars));
+    FixedBaseMSM<PointXYZZ> msm(base, window_bits);
+    return msm.Run(scalars, outputs);
+  }
+
+  // Converts |point_xyzzs| into |affine_points| in parallel chunks, writing
+  // straight into |affine_points|. See |internal::BatchNormalize()|.
   template <typename PointXYZZContainer, typename AffineContainer>
   [[nodiscard]] constexpr static bool BatchNormalize(
       const PointXYZZContainer& point_xyzzs, AffineContainer* affine_points) {
-    size_t size = std::size(point_xyzzs);
-    if (size != std::size(*affine_points)) {
-      LOG(ERROR) << "Size of |point_xyzzs| and |affine_points| do not match";
-      return false;
-    }
-    std::vector<BaseField> zzz_inverses = base::Map(
-        point_xyzzs, [](const PointXYZZ& point) { return point.zzz_; });
-    if (!BaseField::BatchInverseInPlaceSerial(zzz_inverses)) return false;
-    for (size_t i = 0; i < size; ++i) {
-      const BaseField& z_inv_cubic = zzz_inverses[i];
-      if (z_inv_cubic.IsZero()) {
-        (*affine_points)[i] = AffinePoint<Curve>::Zero();
-      } else if (z_inv_cubic.IsOne()) {
-        (*affine_points)[i] = {point_xyzzs[i].x_, point_xyzzs[i].y_};
-      } else {
-        BaseField z_inv_square = z_inv_cubic * point_xyzzs[i].zz_;
-        z_inv_square.SquareInPlace();
-        (*affine_points)[i] = {point_xyzzs[i].x_ * z_inv_square,
-                               point_xyzzs[i].y_ * z_inv_cubic};
-      }
-    }
-    return true;
+    return internal::BatchNormalize(
+        absl::MakeConstSpan(point_xyzzs), absl::MakeSpan(*affine_points),
+        [](const PointXYZZ& point) -> const BaseField& { return point.zzz_; },
+        [](const PointXYZZ& point, const BaseField& z_inv_cubic) {
+          // NOTE(chokobole): ZZZ = 1 doesn't mean ZZ = 1, since ZZ can be a
+          // cube root of unity.
+          if (point.zz_.IsOne() && z_inv_cubic.IsOne()) {
+            return AffinePoint<Curve>(point.x_, point.y_);
+          }
+          BaseField z_inv_square = z_inv_cubic * point.zz_;
+          z_inv_square.SquareInPlace();
+          return AffinePoint<Curve>(point.x_ * z_inv_square,
+                                    point.y_ * z_inv_cubic);
+        });
   }
 
   constexpr const BaseField& x() const { return x_; }
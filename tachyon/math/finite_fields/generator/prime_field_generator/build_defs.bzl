@@ -87,6 +87,7 @@ def generate_prime_fields(
         name = name,
         hdrs = [":{}_gen_hdr".format(name)],
         deps = deps + [
+            "//tachyon/build:build_config",
             "//tachyon/math/finite_fields:prime_field",
         ],
         **kwargs
@@ -69,6 +69,85 @@ struct ModulusInfo {
   }
 };
 
+// NOTE(chokobole): The assembly is only emitted for 4 and 6 limbs, which
+// cover the 256 and 384-bit moduli. It implements the CIOS method without the
+// final carry, so it is only valid when the no carry optimization can be used.
+// See https://hackmd.io/@gnark/modular_multiplication.
+bool CanUseAsmMul(size_t n, const ModulusInfo& modulus_info) {
+  return (n == 4 || n == 6) && modulus_info.can_use_no_carry_mul_optimization;
+}
+
+// Generates the body of |AsmMulInPlace()| for |n| limbs. The intermediate
+// result t is kept in n + 1 registers from r8. Each iteration adds a * bᵢ
+// and m * modulus to t, where the carries of the low and high halves of the
+// products are chained separately with ADOX and ADCX. Since the lowest limb
+// of t becomes 0 at the end of each iteration, t is shifted by a limb by
+// renaming the registers instead of moving them.
+std::vector<std::string> GenerateAsmMul(size_t n, const mpz_class& m,
+                                        uint64_t inverse64) {
+  std::vector<uint64_t> limbs(n);
+  math::gmp::CopyLimbs(m, limbs.data());
+
+  std::vector<std::string> regs;
+  for (size_t i = 0; i <= n; ++i) {
+    regs.push_back(absl::Substitute("%%r$0", 8 + i));
+  }
+
+  std::vector<std::string> lines;
+  auto emit = [&lines](std::string_view instruction) {
+    lines.push_back(absl::Substitute("      \"$0\\n\\t\"", instruction));
+  };
+
+  for (size_t j = 0; j <= n; ++j) {
+    emit(absl::Substitute("xorq $0, $0", regs[j]));
+  }
+  for (size_t i = 0; i < n; ++i) {
+    auto t = [&regs, i, n](size_t j) { return regs[(i + j) % (n + 1)]; };
+
+    // t += a * bᵢ
+    emit("xorq %%rax, %%rax");
+    emit(absl::Substitute("movq $0(%[b]), %%rdx", 8 * i));
+    for (size_t j = 0; j < n; ++j) {
+      emit(absl::Substitute("mulxq $0(%[a]), %%rax, %%rcx", 8 * j));
+      emit(absl::Substitute("adoxq %%rax, $0", t(j)));
+      emit(absl::Substitute("adcxq %%rcx, $0", t(j + 1)));
+    }
+    emit("movq $0, %%rax");
+    emit(absl::Substitute("adoxq %%rax, $0", t(n)));
+
+    // m = t₀ * inverse64
+    // t += m * modulus
+    emit(absl::Substitute("movq $0, %%rdx", t(0)));
+    emit(absl::Substitute("movabsq $$$0, %%rcx", inverse64));
+    emit("imulq %%rcx, %%rdx");
+    emit("xorq %%rax, %%rax");
+    for (size_t j = 0; j < n; ++j) {
+      emit(absl::Substitute("movabsq $$$0, %%rcx", limbs[j]));
+      emit("mulxq %%rcx, %%rax, %%rcx");
+      emit(absl::Substitute("adoxq %%rax, $0", t(j)));
+      emit(absl::Substitute("adcxq %%rcx, $0", t(j + 1)));
+    }
+    emit("movq $0, %%rax");
+    emit(absl::Substitute("adoxq %%rax, $0", t(n)));
+  }
+  for (size_t j = 0; j < n; ++j) {
+    emit(absl::Substitute("movq $0, $1(%[a])", regs[(n + j) % (n + 1)], 8 * j));
+  }
+
+  std::vector<std::string> clobbers = {"\"rax\"", "\"rcx\"", "\"rdx\""};
+  for (size_t j = 0; j <= n; ++j) {
+    clobbers.push_back(absl::Substitute("\"r$0\"", 8 + j));
+  }
+  clobbers.push_back("\"cc\"");
+  clobbers.push_back("\"memory\"");
+
+  lines.push_back("      :");
+  lines.push_back("      : [a] \"r\"(a), [b] \"r\"(b)");
+  lines.push_back(
+      absl::StrCat("      : ", absl::StrJoin(clobbers, ", "), ");"));
+  return lines;
+}
+
 struct GenerationConfig : public build::CcWriter {
   std::string ns_name;
   std::string class_name;
@@ -80,13 +159,13 @@ struct GenerationConfig : public build::CcWriter {
   std::string special_prime_override;
 
   int GenerateConfigHdr() const;
-  int GenerateConfigCpp() const;
   int GenerateConfigGpuHdr() const;
 };
 
 int GenerationConfig::GenerateConfigHdr() const {
   // clang-format off
   std::vector<std::string> tpl = {
+      "#include \"tachyon/build/build_config.h\"",
       "#include \"tachyon/export.h\"",
       "#include \"tachyon/math/finite_fields/prime_field.h\"",
       "",
@@ -136,6 +215,8 @@ int GenerationConfig::GenerateConfigHdr() const {
       "  constexpr static bool kHasTwoAdicRootOfUnity = false;",
       "",
       "  constexpr static bool kHasLargeSubgroupRootOfUnity = false;",
+      "",
+      "  constexpr static bool kHasAsmMul = false;",
       "};",
       "",
       "using %{class} = PrimeField<%{class}Config>;",
@@ -269,6 +350,36 @@ int GenerationConfig::GenerateConfigHdr() const {
     CHECK(small_subgroup_adicity.empty());
   }
 
+  if (CanUseAsmMul(n, modulus_info)) {
+    std::vector<std::string> lines;
+    // clang-format off
+    lines.push_back("#if ARCH_CPU_X86_64");
+    lines.push_back("  constexpr static bool kHasAsmMul = true;");
+    lines.push_back("  // Computes |a| = |a| * |b| * R⁻¹ using MULX, ADCX and ADOX. The result is");
+    lines.push_back("  // in [0, 2 * |kModulus|). See |GenerateAsmMul()| in");
+    lines.push_back("  // //tachyon/math/finite_fields/generator/prime_field_generator.");
+    lines.push_back("  static void AsmMulInPlace(uint64_t* a, const uint64_t* b) {");
+    lines.push_back("    asm volatile(");
+    // clang-format on
+    std::vector<std::string> body =
+        GenerateAsmMul(n, m, modulus_info.inverse64);
+    lines.insert(lines.end(), body.begin(), body.end());
+    lines.push_back("  }");
+    lines.push_back("#else");
+    lines.push_back("  constexpr static bool kHasAsmMul = false;");
+    lines.push_back("#endif");
+
+    for (size_t i = 0; i < tpl.size(); ++i) {
+      size_t idx = tpl[i].find("constexpr static bool kHasAsmMul = false;");
+      if (idx != std::string::npos) {
+        auto it = tpl.begin() + i;
+        tpl.erase(it);
+        tpl.insert(it, lines.begin(), lines.end());
+        break;
+      }
+    }
+  }
+
   std::string tpl_content = absl::StrJoin(tpl, "\n");
 
   std::string content = absl::StrReplaceAll(
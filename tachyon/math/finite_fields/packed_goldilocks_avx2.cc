@@ -0,0 +1,83 @@
+#include "tachyon/math/finite_fields/packed_goldilocks_simd.h"
+
+#if ARCH_CPU_X86_64
+
+#include <immintrin.h>
+
+// NOTE(chokobole): The functions are compiled for AVX2 regardless of the
+// compiler flags, so that a single binary can choose the implementation at
+// runtime. They must not be called unless the CPU supports them.
+#define TACHYON_GOLDILOCKS_TARGET __attribute__((target("avx2")))
+
+#include "tachyon/math/finite_fields/packed_goldilocks_simd_impl.h"
+
+namespace tachyon::math::internal {
+
+namespace {
+
+struct Avx2Ops {
+  using V = __m256i;
+  using M = __m256i;
+
+  constexpr static size_t kLanes = 4;
+
+  TACHYON_GOLDILOCKS_TARGET static V Load(const uint64_t* ptr) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+  }
+  TACHYON_GOLDILOCKS_TARGET static void Store(uint64_t* ptr, V v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), v);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Set1(uint64_t v) {
+    return _mm256_set1_epi64x(static_cast<int64_t>(v));
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Add(V a, V b) {
+    return _mm256_add_epi64(a, b);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Sub(V a, V b) {
+    return _mm256_sub_epi64(a, b);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V And(V a, V b) {
+    return _mm256_and_si256(a, b);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Or(V a, V b) {
+    return _mm256_or_si256(a, b);
+  }
+  template <int kBits>
+  TACHYON_GOLDILOCKS_TARGET static V Shl(V a) {
+    return _mm256_slli_epi64(a, kBits);
+  }
+  template <int kBits>
+  TACHYON_GOLDILOCKS_TARGET static V Shr(V a) {
+    return _mm256_srli_epi64(a, kBits);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V ShlVar(V a, V bits) {
+    return _mm256_sllv_epi64(a, bits);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V ShrVar(V a, V bits) {
+    return _mm256_srlv_epi64(a, bits);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V MulLo32(V a, V b) {
+    return _mm256_mul_epu32(a, b);
+  }
+  // AVX2 only has the signed comparison, so the sign bits are flipped.
+  TACHYON_GOLDILOCKS_TARGET static M LessThan(V a, V b) {
+    V sign = _mm256_set1_epi64x(INT64_MIN);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign),
+                              _mm256_xor_si256(a, sign));
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Select(M mask, V a, V b) {
+    return _mm256_blendv_epi8(b, a, mask);
+  }
+};
+
+}  // namespace
+
+const GoldilocksSimdKernels& GetGoldilocksAvx2Kernels() {
+  static const GoldilocksSimdKernels kernels =
+      goldilocks::Kernels<Avx2Ops>::Get();
+  return kernels;
+}
+
+}  // namespace tachyon::math::internal
+
+#endif  // ARCH_CPU_X86_64
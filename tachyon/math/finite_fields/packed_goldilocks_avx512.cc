@@ -0,0 +1,80 @@
+#include "tachyon/math/finite_fields/packed_goldilocks_simd.h"
+
+#if ARCH_CPU_X86_64
+
+#include <immintrin.h>
+
+// NOTE(chokobole): The functions are compiled for AVX512F regardless of the
+// compiler flags, so that a single binary can choose the implementation at
+// runtime. They must not be called unless the CPU supports them.
+#define TACHYON_GOLDILOCKS_TARGET __attribute__((target("avx512f")))
+
+#include "tachyon/math/finite_fields/packed_goldilocks_simd_impl.h"
+
+namespace tachyon::math::internal {
+
+namespace {
+
+struct Avx512Ops {
+  using V = __m512i;
+  using M = __mmask8;
+
+  constexpr static size_t kLanes = 8;
+
+  TACHYON_GOLDILOCKS_TARGET static V Load(const uint64_t* ptr) {
+    return _mm512_loadu_si512(ptr);
+  }
+  TACHYON_GOLDILOCKS_TARGET static void Store(uint64_t* ptr, V v) {
+    _mm512_storeu_si512(ptr, v);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Set1(uint64_t v) {
+    return _mm512_set1_epi64(static_cast<int64_t>(v));
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Add(V a, V b) {
+    return _mm512_add_epi64(a, b);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Sub(V a, V b) {
+    return _mm512_sub_epi64(a, b);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V And(V a, V b) {
+    return _mm512_and_si512(a, b);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Or(V a, V b) {
+    return _mm512_or_si512(a, b);
+  }
+  template <int kBits>
+  TACHYON_GOLDILOCKS_TARGET static V Shl(V a) {
+    return _mm512_slli_epi64(a, kBits);
+  }
+  template <int kBits>
+  TACHYON_GOLDILOCKS_TARGET static V Shr(V a) {
+    return _mm512_srli_epi64(a, kBits);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V ShlVar(V a, V bits) {
+    return _mm512_sllv_epi64(a, bits);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V ShrVar(V a, V bits) {
+    return _mm512_srlv_epi64(a, bits);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V MulLo32(V a, V b) {
+    return _mm512_mul_epu32(a, b);
+  }
+  TACHYON_GOLDILOCKS_TARGET static M LessThan(V a, V b) {
+    return _mm512_cmplt_epu64_mask(a, b);
+  }
+  TACHYON_GOLDILOCKS_TARGET static V Select(M mask, V a, V b) {
+    return _mm512_mask_blend_epi64(mask, b, a);
+  }
+};
+
+}  // namespace
+
+const GoldilocksSimdKernels& GetGoldilocksAvx512Kernels() {
+  static const GoldilocksSimdKernels kernels =
+      goldilocks::Kernels<Avx512Ops>::Get();
+  return kernels;
+}
+
+}  // namespace tachyon::math::internal
+
+#endif  // ARCH_CPU_X86_64
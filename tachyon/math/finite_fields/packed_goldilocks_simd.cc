@@ -0,0 +1,21 @@
+#include "tachyon/math/finite_fields/packed_goldilocks_simd.h"
+
+#include "tachyon/base/cpu.h"
+
+namespace tachyon::math::internal {
+
+const GoldilocksSimdKernels* GetGoldilocksSimdKernels() {
+#if ARCH_CPU_X86_64
+  static const GoldilocksSimdKernels* kernels = []() {
+    const base::CPU& cpu = base::CPU::GetInstance();
+    if (cpu.has_avx512f()) return &GetGoldilocksAvx512Kernels();
+    if (cpu.has_avx2()) return &GetGoldilocksAvx2Kernels();
+    return static_cast<const GoldilocksSimdKernels*>(nullptr);
+  }();
+  return kernels;
+#else
+  return nullptr;
+#endif
+}
+
+}  // namespace tachyon::math::internal
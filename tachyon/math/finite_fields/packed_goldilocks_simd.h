@@ -0,0 +1,73 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_GOLDILOCKS_SIMD_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_GOLDILOCKS_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/build/build_config.h"
+#include "tachyon/export.h"
+
+namespace tachyon::math::internal {
+
+// The Goldilocks prime p = 2⁶⁴ - 2³² + 1.
+constexpr uint64_t kGoldilocksModulus = 0xffffffff00000001;
+
+// 2 is a 192-th root of unity of the Goldilocks prime field, since 2⁹⁶ = -1.
+// Thus, every root of unity whose order divides 64 is a power of 2.
+constexpr uint32_t kGoldilocksTwoOrder = 192;
+
+// The twiddle factors of a single stage of the NTT. The j-th twiddle factor
+// is |roots[j]| if |roots| is not null, otherwise 2^{j * |exponent|}, which is
+// multiplied with shifts instead of a multiplication.
+struct GoldilocksTwiddles {
+  const uint64_t* roots = nullptr;
+  uint32_t exponent = 0;
+};
+
+// |GoldilocksSimdKernels| is a set of functions on the Montgomery
+// representations of the Goldilocks prime field elements, which are computed
+// in |lanes| SIMD lanes at once. The inputs must be less than p.
+struct GoldilocksSimdKernels {
+  size_t lanes;
+
+  // |out[i]| = |a[i]| + |b[i]| for i in [0, |n|). |out| may alias |a| or |b|.
+  void (*add)(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n);
+  // |out[i]| = |a[i]| - |b[i]| for i in [0, |n|). |out| may alias |a| or |b|.
+  void (*sub)(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n);
+  // |out[i]| = |a[i]| * |b[i]| for i in [0, |n|). |out| may alias |a| or |b|.
+  void (*mul)(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n);
+
+  // Applies the butterflies of the stage whose gap is |gap| to the j-th
+  // positions for j in [|j_begin|, |j_end|) of the |num_chunks| chunks of
+  // 2 * |gap| elements starting from |values|. If |dif| is true, these are the
+  // decimation-in-frequency butterflies of |ButterflyFnInOut()|, otherwise the
+  // decimation-in-time butterflies of |ButterflyFnOutIn()|.
+  void (*radix2_stage)(uint64_t* values, size_t num_chunks, size_t gap,
+                       size_t j_begin, size_t j_end,
+                       const GoldilocksTwiddles& twiddles, bool dif);
+  // Applies the stages whose gaps are |gap| and 2 * |gap| at once to the
+  // chunks of 4 * |gap| elements, where |twiddles| and |twiddles2| are the
+  // twiddle factors of each stage. The stage of |gap| comes first if |dif| is
+  // false, otherwise the stage of 2 * |gap| comes first.
+  void (*radix4_stage)(uint64_t* values, size_t num_chunks, size_t gap,
+                       size_t j_begin, size_t j_end,
+                       const GoldilocksTwiddles& twiddles,
+                       const GoldilocksTwiddles& twiddles2, bool dif);
+};
+
+#if ARCH_CPU_X86_64
+// Returns the kernels compiled for AVX2. The caller must check
+// |base::CPU::has_avx2()| before calling them.
+TACHYON_EXPORT const GoldilocksSimdKernels& GetGoldilocksAvx2Kernels();
+
+// Returns the kernels compiled for AVX512F. The caller must check
+// |base::CPU::has_avx512f()| before calling them.
+TACHYON_EXPORT const GoldilocksSimdKernels& GetGoldilocksAvx512Kernels();
+#endif  // ARCH_CPU_X86_64
+
+// Returns the widest kernels supported by the CPU or null if there's none.
+TACHYON_EXPORT const GoldilocksSimdKernels* GetGoldilocksSimdKernels();
+
+}  // namespace tachyon::math::internal
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_GOLDILOCKS_SIMD_H_
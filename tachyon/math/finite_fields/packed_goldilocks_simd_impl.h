@@ -0,0 +1,394 @@
+// NOTE(chokobole): This header is included only by
+// packed_goldilocks_avx2.cc and packed_goldilocks_avx512.cc, each of which
+// defines |TACHYON_GOLDILOCKS_TARGET| for its instruction set before including
+// this. Every function here is compiled separately for each of them, so they
+// are in an unnamed namespace not to be merged by the linker.
+
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_GOLDILOCKS_SIMD_IMPL_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_GOLDILOCKS_SIMD_IMPL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/math/finite_fields/packed_goldilocks_simd.h"
+
+#if !defined(TACHYON_GOLDILOCKS_TARGET)
+#error "TACHYON_GOLDILOCKS_TARGET must be defined."
+#endif
+
+namespace tachyon::math::internal::goldilocks {
+namespace {
+
+// ε = 2⁶⁴ mod p = 2³² - 1
+constexpr uint64_t kEpsilon = 0xffffffff;
+
+// The operations of a single lane. This is used for the elements that don't
+// fill a vector.
+struct ScalarOps {
+  using V = uint64_t;
+  using M = bool;
+
+  constexpr static size_t kLanes = 1;
+
+  TACHYON_GOLDILOCKS_TARGET static V Load(const uint64_t* ptr) { return *ptr; }
+  TACHYON_GOLDILOCKS_TARGET static void Store(uint64_t* ptr, V v) { *ptr = v; }
+  TACHYON_GOLDILOCKS_TARGET static V Set1(uint64_t v) { return v; }
+  TACHYON_GOLDILOCKS_TARGET static V Add(V a, V b) { return a + b; }
+  TACHYON_GOLDILOCKS_TARGET static V Sub(V a, V b) { return a - b; }
+  TACHYON_GOLDILOCKS_TARGET static V And(V a, V b) { return a & b; }
+  TACHYON_GOLDILOCKS_TARGET static V Or(V a, V b) { return a | b; }
+  template <int kBits>
+  TACHYON_GOLDILOCKS_TARGET static V Shl(V a) {
+    return a << kBits;
+  }
+  template <int kBits>
+  TACHYON_GOLDILOCKS_TARGET static V Shr(V a) {
+    return a >> kBits;
+  }
+  // Unlike the built-in shifts, these return 0 if |bits| >= 64.
+  TACHYON_GOLDILOCKS_TARGET static V ShlVar(V a, V bits) {
+    return bits < 64 ? a << bits : 0;
+  }
+  TACHYON_GOLDILOCKS_TARGET static V ShrVar(V a, V bits) {
+    return bits < 64 ? a >> bits : 0;
+  }
+  // Multiplies the lower 32 bits of |a| and |b|.
+  TACHYON_GOLDILOCKS_TARGET static V MulLo32(V a, V b) {
+    return (a & kEpsilon) * (b & kEpsilon);
+  }
+  TACHYON_GOLDILOCKS_TARGET static M LessThan(V a, V b) { return a < b; }
+  // Returns |a| where |mask| is set, otherwise |b|.
+  TACHYON_GOLDILOCKS_TARGET static V Select(M mask, V a, V b) {
+    return mask ? a : b;
+  }
+};
+
+// Returns |a| if |a| < p, otherwise |a| - p.
+template <typename Ops>
+TACHYON_GOLDILOCKS_TARGET typename Ops::V Canonicalize(typename Ops::V a) {
+  typename Ops::V p = Ops::Set1(kGoldilocksModulus);
+  return Ops::Select(Ops::LessThan(a, p), a, Ops::Sub(a, p));
+}
+
+template <typename Ops>
+TACHYON_GOLDILOCKS_TARGET typename Ops::V Add(typename Ops::V a,
+                                              typename Ops::V b) {
+  typename Ops::V sum = Ops::Add(a, b);
+  // If it overflows, 2⁶⁴ is replaced with ε, which can't overflow again.
+  sum = Ops::Select(Ops::LessThan(sum, a), Ops::Add(sum, Ops::Set1(kEpsilon)),
+                    sum);
+  return Canonicalize<Ops>(sum);
+}
+
+template <typename Ops>
+TACHYON_GOLDILOCKS_TARGET typename Ops::V Sub(typename Ops::V a,
+                                              typename Ops::V b) {
+  typename Ops::V diff = Ops::Sub(a, b);
+  // If it underflows, p = 2⁶⁴ - ε is added.
+  return Ops::Select(Ops::LessThan(a, b),
+                     Ops::Sub(diff, Ops::Set1(kEpsilon)), diff);
+}
+
+// Reduces |hi| * 2⁶⁴ + |lo| modulo p. Since 2⁹⁶ = -1
+// and 2⁶⁴ = ε, this is |lo| - hi₁ + hi₀ * ε, where |hi| = hi₁ * 2³² + hi₀.
+// See https://github.com/0xPolygonZero/plonky2/blob/main/field/src/goldilocks_field.rs
+template <typename Ops>
+TACHYON_GOLDILOCKS_TARGET typename Ops::V Reduce128(typename Ops::V hi,
+                                                    typename Ops::V lo) {
+  typename Ops::V epsilon = Ops::Set1(kEpsilon);
+  typename Ops::V hi_hi = Ops::template Shr<32>(hi);
+  typename Ops::V hi_lo = Ops::And(hi, epsilon);
+
+  typename Ops::V t0 = Ops::Sub(lo, hi_hi);
+  t0 = Ops::Select(Ops::LessThan(lo, hi_hi), Ops::Sub(t0, epsilon), t0);
+  typename Ops::V t1 = Ops::Sub(Ops::template Shl<32>(hi_lo), hi_lo);
+  typename Ops::V t2 = Ops::Add(t0, t1);
+  t2 = Ops::Select(Ops::LessThan(t2, t1), Ops::Add(t2, epsilon), t2);
+  return Canonicalize<Ops>(t2);
+}
+
+// Computes |a| * |b| * 2⁻⁶⁴ mod p, which is the Montgomery multiplication.
+template <typename Ops>
+TACHYON_GOLDILOCKS_TARGET typename Ops::V Mul(typename Ops::V a,
+                                              typename Ops::V b) {
+  typename Ops::V mask = Ops::Set1(kEpsilon);
+  typename Ops::V a_hi = Ops::template Shr<32>(a);
+  typename Ops::V b_hi = Ops::template Shr<32>(b);
+
+  // Computes the 128-bit product |hi| * 2⁶⁴ + |lo| from 32-bit products.
+  typename Ops::V ll = Ops::MulLo32(a, b);
+  typename Ops::V lh = Ops::MulLo32(a, b_hi);
+  typename Ops::V hl = Ops::MulLo32(a_hi, b);
+  typename Ops::V hh = Ops::MulLo32(a_hi, b_hi);
+  typename Ops::V t = Ops::Add(hl, Ops::template Shr<32>(ll));
+  typename Ops::V mid = Ops::Add(lh, Ops::And(t, mask));
+  typename Ops::V lo =
+      Ops::Or(Ops::template Shl<32>(mid), Ops::And(ll, mask));
+  typename Ops::V hi =
+      Ops::Add(Ops::Add(hh, Ops::template Shr<32>(t)),
+               Ops::template Shr<32>(mid));
+
+  // m = |lo| * p⁻¹ mod 2⁶⁴ = |lo| * (2³² + 1) mod 2⁶⁴, so that the lower 64
+  // bits of m * p are |lo|. Since m * p = m * 2⁶⁴ - m * 2³² + m, the upper 64
+  // bits of m * p are computed with a shift and the carry of m, and they are
+  // subtracted from |hi|.
+  typename Ops::V m = Ops::Add(lo, Ops::template Shl<32>(lo));
+  typename Ops::V carry = Ops::Select(Ops::LessThan(m, lo), Ops::Set1(1),
+                                      Ops::Set1(0));
+  typename Ops::V sub =
+      Ops::Sub(Ops::Sub(m, Ops::template Shr<32>(m)), carry);
+  typename Ops::V ret = Ops::Sub(hi, sub);
+  return Ops::Select(Ops::LessThan(hi, sub), Ops::Sub(ret, mask), ret);
+}
+
+// Computes |a| * 2^|exponent| mod p, where each lane of |exponent| is less
+// than 96.
+template <typename Ops>
+TACHYON_GOLDILOCKS_TARGET typename Ops::V MulPow2Lt96(
+    typename Ops::V a, typename Ops::V exponent) {
+  // The shift is split into 2 shifts of at most 48 bits, so that each of the
+  // shifted values fits in 128 bits.
+  typename Ops::V first = Ops::template Shr<1>(exponent);
+  typename Ops::V second = Ops::Sub(exponent, first);
+  typename Ops::V bits = Ops::Set1(64);
+  a = Reduce128<Ops>(Ops::ShrVar(a, Ops::Sub(bits, first)),
+                     Ops::ShlVar(a, first));
+  return Reduce128<Ops>(Ops::ShrVar(a, Ops::Sub(bits, second)),
+                        Ops::ShlVar(a, second));
+}
+
+// Computes |a| * 2^|exponent| mod p, where each lane of |exponent| is less
+// than 192.
+template <typename Ops>
+TACHYON_GOLDILOCKS_TARGET typename Ops::V MulPow2(typename Ops::V a,
+                                                  typename Ops::V exponent) {
+  // 2⁹⁶ = -1
+  typename Ops::V half = Ops::Set1(kGoldilocksTwoOrder / 2);
+  typename Ops::M lt = Ops::LessThan(exponent, half);
+  typename Ops::V ret = MulPow2Lt96<Ops>(
+      a, Ops::Select(lt, exponent, Ops::Sub(exponent, half)));
+  return Ops::Select(lt, ret, Sub<Ops>(Ops::Set1(0), ret));
+}
+
+// Holds the twiddle factors of a stage for the lanes of |Ops|.
+template <typename Ops>
+class TwiddleMultiplier {
+ public:
+  TACHYON_GOLDILOCKS_TARGET explicit TwiddleMultiplier(
+      const GoldilocksTwiddles& twiddles)
+      : twiddles_(twiddles) {
+    uint64_t lane_exponents[Ops::kLanes];
+    for (size_t i = 0; i < Ops::kLanes; ++i) {
+      lane_exponents[i] = (i * twiddles.exponent) % kGoldilocksTwoOrder;
+    }
+    lane_exponents_ = Ops::Load(lane_exponents);
+  }
+
+  // Multiplies |a| by the j-th twiddle factors for j in [|j|, |j| + lanes).
+  TACHYON_GOLDILOCKS_TARGET typename Ops::V Mul(size_t j,
+                                                typename Ops::V a) const {
+    if (twiddles_.roots != nullptr) {
+      return goldilocks::Mul<Ops>(a, Ops::Load(twiddles_.roots + j));
+    }
+    typename Ops::V order = Ops::Set1(kGoldilocksTwoOrder);
+    typename Ops::V exponent =
+        Ops::Add(Ops::Set1((j * twiddles_.exponent) % kGoldilocksTwoOrder),
+                 lane_exponents_);
+    exponent = Ops::Select(Ops::LessThan(exponent, order), exponent,
+                           Ops::Sub(exponent, order));
+    return MulPow2<Ops>(a, exponent);
+  }
+
+ private:
+  const GoldilocksTwiddles& twiddles_;
+  typename Ops::V lane_exponents_;
+};
+
+template <typename Ops, bool kDif>
+TACHYON_GOLDILOCKS_TARGET void Radix2Butterfly(
+    uint64_t* lo, uint64_t* hi, size_t j, const TwiddleMultiplier<Ops>& w) {
+  typename Ops::V x0 = Ops::Load(lo + j);
+  typename Ops::V x1 = Ops::Load(hi + j);
+  if constexpr (kDif) {
+    Ops::Store(lo + j, Add<Ops>(x0, x1));
+    Ops::Store(hi + j, w.Mul(j, Sub<Ops>(x0, x1)));
+  } else {
+    x1 = w.Mul(j, x1);
+    Ops::Store(lo + j, Add<Ops>(x0, x1));
+    Ops::Store(hi + j, Sub<Ops>(x0, x1));
+  }
+}
+
+// The j-th radix-4 butterfly of a chunk consists of the radix-2 butterflies
+// (j, j + g) and (j + 2g, j + 3g) of the stage of g and (j, j + 2g) and
+// (j + g, j + 3g) of the stage of 2g, where g = |gap|.
+template <typename Ops, bool kDif>
+TACHYON_GOLDILOCKS_TARGET void Radix4Butterfly(
+    uint64_t* chunk, size_t gap, size_t j, const TwiddleMultiplier<Ops>& w,
+    const TwiddleMultiplier<Ops>& w2) {
+  uint64_t* p0 = chunk + j;
+  uint64_t* p1 = p0 + gap;
+  uint64_t* p2 = p1 + gap;
+  uint64_t* p3 = p2 + gap;
+  typename Ops::V x0 = Ops::Load(p0);
+  typename Ops::V x1 = Ops::Load(p1);
+  typename Ops::V x2 = Ops::Load(p2);
+  typename Ops::V x3 = Ops::Load(p3);
+  if constexpr (kDif) {
+    typename Ops::V a0 = Add<Ops>(x0, x2);
+    typename Ops::V a2 = w2.Mul(j, Sub<Ops>(x0, x2));
+    typename Ops::V a1 = Add<Ops>(x1, x3);
+    typename Ops::V a3 = w2.Mul(j + gap, Sub<Ops>(x1, x3));
+    Ops::Store(p0, Add<Ops>(a0, a1));
+    Ops::Store(p1, w.Mul(j, Sub<Ops>(a0, a1)));
+    Ops::Store(p2, Add<Ops>(a2, a3));
+    Ops::Store(p3, w.Mul(j, Sub<Ops>(a2, a3)));
+  } else {
+    x1 = w.Mul(j, x1);
+    x3 = w.Mul(j, x3);
+    typename Ops::V a0 = Add<Ops>(x0, x1);
+    typename Ops::V a1 = Sub<Ops>(x0, x1);
+    typename Ops::V a2 = w2.Mul(j, Add<Ops>(x2, x3));
+    typename Ops::V a3 = w2.Mul(j + gap, Sub<Ops>(x2, x3));
+    Ops::Store(p0, Add<Ops>(a0, a2));
+    Ops::Store(p1, Add<Ops>(a1, a3));
+    Ops::Store(p2, Sub<Ops>(a0, a2));
+    Ops::Store(p3, Sub<Ops>(a1, a3));
+  }
+}
+
+template <typename Ops, typename BinaryOp>
+TACHYON_GOLDILOCKS_TARGET void ApplyElementwise(const uint64_t* a,
+                                                const uint64_t* b,
+                                                uint64_t* out, size_t n,
+                                                BinaryOp op) {
+  size_t i = 0;
+  for (; i + Ops::kLanes <= n; i += Ops::kLanes) {
+    Ops::Store(out + i, op.template Apply<Ops>(Ops::Load(a + i),
+                                               Ops::Load(b + i)));
+  }
+  for (; i < n; ++i) {
+    out[i] = op.template Apply<ScalarOps>(a[i], b[i]);
+  }
+}
+
+struct AddOp {
+  template <typename Ops>
+  TACHYON_GOLDILOCKS_TARGET typename Ops::V Apply(typename Ops::V a,
+                                                  typename Ops::V b) const {
+    return goldilocks::Add<Ops>(a, b);
+  }
+};
+
+struct SubOp {
+  template <typename Ops>
+  TACHYON_GOLDILOCKS_TARGET typename Ops::V Apply(typename Ops::V a,
+                                                  typename Ops::V b) const {
+    return goldilocks::Sub<Ops>(a, b);
+  }
+};
+
+struct MulOp {
+  template <typename Ops>
+  TACHYON_GOLDILOCKS_TARGET typename Ops::V Apply(typename Ops::V a,
+                                                  typename Ops::V b) const {
+    return goldilocks::Mul<Ops>(a, b);
+  }
+};
+
+// |Ops| is the operations of the vector, which has the same interface as
+// |ScalarOps|.
+template <typename Ops>
+struct Kernels {
+  TACHYON_GOLDILOCKS_TARGET static void AddN(const uint64_t* a,
+                                             const uint64_t* b, uint64_t* out,
+                                             size_t n) {
+    ApplyElementwise<Ops>(a, b, out, n, AddOp());
+  }
+
+  TACHYON_GOLDILOCKS_TARGET static void SubN(const uint64_t* a,
+                                             const uint64_t* b, uint64_t* out,
+                                             size_t n) {
+    ApplyElementwise<Ops>(a, b, out, n, SubOp());
+  }
+
+  TACHYON_GOLDILOCKS_TARGET static void MulN(const uint64_t* a,
+                                             const uint64_t* b, uint64_t* out,
+                                             size_t n) {
+    ApplyElementwise<Ops>(a, b, out, n, MulOp());
+  }
+
+  template <bool kDif>
+  TACHYON_GOLDILOCKS_TARGET static void Radix2StageImpl(
+      uint64_t* values, size_t num_chunks, size_t gap, size_t j_begin,
+      size_t j_end, const GoldilocksTwiddles& twiddles) {
+    TwiddleMultiplier<Ops> w(twiddles);
+    TwiddleMultiplier<ScalarOps> scalar_w(twiddles);
+    for (size_t c = 0; c < num_chunks; ++c) {
+      uint64_t* lo = values + c * 2 * gap;
+      uint64_t* hi = lo + gap;
+      size_t j = j_begin;
+      for (; j + Ops::kLanes <= j_end; j += Ops::kLanes) {
+        Radix2Butterfly<Ops, kDif>(lo, hi, j, w);
+      }
+      for (; j < j_end; ++j) {
+        Radix2Butterfly<ScalarOps, kDif>(lo, hi, j, scalar_w);
+      }
+    }
+  }
+
+  TACHYON_GOLDILOCKS_TARGET static void Radix2Stage(
+      uint64_t* values, size_t num_chunks, size_t gap, size_t j_begin,
+      size_t j_end, const GoldilocksTwiddles& twiddles, bool dif) {
+    if (dif) {
+      Radix2StageImpl<true>(values, num_chunks, gap, j_begin, j_end,
+                            twiddles);
+    } else {
+      Radix2StageImpl<false>(values, num_chunks, gap, j_begin, j_end,
+                             twiddles);
+    }
+  }
+
+  template <bool kDif>
+  TACHYON_GOLDILOCKS_TARGET static void Radix4StageImpl(
+      uint64_t* values, size_t num_chunks, size_t gap, size_t j_begin,
+      size_t j_end, const GoldilocksTwiddles& twiddles,
+      const GoldilocksTwiddles& twiddles2) {
+    TwiddleMultiplier<Ops> w(twiddles);
+    TwiddleMultiplier<Ops> w2(twiddles2);
+    TwiddleMultiplier<ScalarOps> scalar_w(twiddles);
+    TwiddleMultiplier<ScalarOps> scalar_w2(twiddles2);
+    for (size_t c = 0; c < num_chunks; ++c) {
+      uint64_t* chunk = values + c * 4 * gap;
+      size_t j = j_begin;
+      for (; j + Ops::kLanes <= j_end; j += Ops::kLanes) {
+        Radix4Butterfly<Ops, kDif>(chunk, gap, j, w, w2);
+      }
+      for (; j < j_end; ++j) {
+        Radix4Butterfly<ScalarOps, kDif>(chunk, gap, j, scalar_w, scalar_w2);
+      }
+    }
+  }
+
+  TACHYON_GOLDILOCKS_TARGET static void Radix4Stage(
+      uint64_t* values, size_t num_chunks, size_t gap, size_t j_begin,
+      size_t j_end, const GoldilocksTwiddles& twiddles,
+      const GoldilocksTwiddles& twiddles2, bool dif) {
+    if (dif) {
+      Radix4StageImpl<true>(values, num_chunks, gap, j_begin, j_end, twiddles,
+                            twiddles2);
+    } else {
+      Radix4StageImpl<false>(values, num_chunks, gap, j_begin, j_end,
+                             twiddles, twiddles2);
+    }
+  }
+
+  static GoldilocksSimdKernels Get() {
+    return {Ops::kLanes, &AddN, &SubN, &MulN, &Radix2Stage, &Radix4Stage};
+  }
+};
+
+}  // namespace
+}  // namespace tachyon::math::internal::goldilocks
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_GOLDILOCKS_SIMD_IMPL_H_
@@ -0,0 +1,262 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+
+#include "tachyon/base/cpu.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/base/ring.h"
+#include "tachyon/math/finite_fields/packed_goldilocks_simd.h"
+#include "tachyon/math/finite_fields/packed_prime_field_avx512_ifma.h"
+#include "tachyon/math/finite_fields/prime_field.h"
+
+namespace tachyon::math {
+namespace internal {
+
+// |SupportsAvx512IfmaMul<F, Lanes>::value| is true if the multiplication of
+// |PackedPrimeField<F, Lanes>| can be done by
+// |MontgomeryMul8x4Avx512Ifma()|.
+template <typename F, size_t Lanes, typename SFINAE = void>
+struct SupportsAvx512IfmaMul : std::false_type {};
+
+#if ARCH_CPU_X86_64
+template <typename F, size_t Lanes>
+struct SupportsAvx512IfmaMul<
+    F, Lanes,
+    std::enable_if_t<Lanes == 8 &&
+                     std::is_same_v<F, PrimeField<typename F::Config>> &&
+                     !F::Config::kIsSpecialPrime && F::kLimbNums == 4>>
+    : std::true_type {};
+#endif  // ARCH_CPU_X86_64
+
+// |IsGoldilocksPrimeField<F>::value| is true if |F| is the Goldilocks prime
+// field in Montgomery form, whose operations can be done by
+// |GoldilocksSimdKernels|.
+template <typename F, typename SFINAE = void>
+struct IsGoldilocksPrimeField : std::false_type {};
+
+template <typename F>
+struct IsGoldilocksPrimeField<
+    F, std::enable_if_t<std::is_same_v<F, PrimeField<typename F::Config>> &&
+                        !F::Config::kIsSpecialPrime && F::kLimbNums == 1 &&
+                        F::Config::kModulus.limbs[0] == kGoldilocksModulus>>
+    : std::true_type {};
+
+// NOTE(chokobole): This is read on every packed multiplication, so it is
+// evaluated once at static initialization.
+inline const bool kIsAvx512IfmaSupported =
+    base::CPU::GetInstance().has_avx512ifma();
+
+}  // namespace internal
+
+// |PackedPrimeField| holds |Lanes| field elements and applies every operation
+// to all of them. It is meant to be used in the element-wise loops, where
+// |Lanes| elements are loaded, computed and stored at once.
+//
+// On x86-64 CPUs with AVX512IFMA, the multiplication of the 256-bit prime
+// fields is done on 8 lanes at once in radix 2⁵². The addition, subtraction
+// and multiplication of the Goldilocks prime field are done with AVX2 or
+// AVX512F. Otherwise, every operation falls back to a loop over the lanes, so
+// it works for any field.
+template <typename F, size_t Lanes = 8>
+class PackedPrimeField final : public Ring<PackedPrimeField<F, Lanes>> {
+ public:
+  constexpr static size_t kLanes = Lanes;
+
+  PackedPrimeField() = default;
+  explicit PackedPrimeField(const std::array<F, Lanes>& values)
+      : values_(values) {}
+
+  static PackedPrimeField Zero() { return Broadcast(F::Zero()); }
+
+  static PackedPrimeField One() { return Broadcast(F::One()); }
+
+  static PackedPrimeField Random() {
+    PackedPrimeField ret;
+    for (F& value : ret.values_) {
+      value = F::Random();
+    }
+    return ret;
+  }
+
+  // Returns a |PackedPrimeField| whose lanes are all |value|.
+  static PackedPrimeField Broadcast(const F& value) {
+    PackedPrimeField ret;
+    ret.values_.fill(value);
+    return ret;
+  }
+
+  // Loads |Lanes| elements starting from |ptr|.
+  static PackedPrimeField Load(const F* ptr) {
+    PackedPrimeField ret;
+    for (size_t i = 0; i < Lanes; ++i) {
+      ret.values_[i] = ptr[i];
+    }
+    return ret;
+  }
+
+  // Stores |Lanes| elements starting from |ptr|.
+  void Store(F* ptr) const {
+    for (size_t i = 0; i < Lanes; ++i) {
+      ptr[i] = values_[i];
+    }
+  }
+
+  // Returns true if |MulInPlace()| is done with SIMD instructions on this CPU.
+  // Otherwise, it is a loop over the lanes, so callers should keep their
+  // scalar loops rather than paying for |Load()| and |Store()|.
+  static bool IsSimdMulSupported() {
+#if ARCH_CPU_X86_64
+    if constexpr (internal::SupportsAvx512IfmaMul<F, Lanes>::value) {
+      return internal::kIsAvx512IfmaSupported;
+    }
+#endif
+    if constexpr (internal::IsGoldilocksPrimeField<F>::value) {
+      return internal::GetGoldilocksSimdKernels() != nullptr;
+    }
+    return false;
+  }
+
+  const std::array<F, Lanes>& values() const { return values_; }
+
+  F& operator[](size_t i) { return values_[i]; }
+  const F& operator[](size_t i) const { return values_[i]; }
+
+  bool IsZero() const {
+    for (const F& value : values_) {
+      if (!value.IsZero()) return false;
+    }
+    return true;
+  }
+
+  bool IsOne() const {
+    for (const F& value : values_) {
+      if (!value.IsOne()) return false;
+    }
+    return true;
+  }
+
+  bool operator==(const PackedPrimeField& other) const {
+    return values_ == other.values_;
+  }
+  bool operator!=(const PackedPrimeField& other) const {
+    return values_ != other.values_;
+  }
+
+  std::string ToString() const {
+    return absl::StrCat(
+        "[",
+        absl::StrJoin(values_, ", ",
+                      [](std::string* out, const F& value) {
+                        absl::StrAppend(out, value.ToString());
+                      }),
+        "]");
+  }
+
+  // AdditiveSemigroup methods
+  PackedPrimeField& AddInPlace(const PackedPrimeField& other) {
+    if constexpr (internal::IsGoldilocksPrimeField<F>::value) {
+      if (const internal::GoldilocksSimdKernels* kernels =
+              internal::GetGoldilocksSimdKernels()) {
+        kernels->add(raw_values(), other.raw_values(), raw_values(), Lanes);
+        return *this;
+      }
+    }
+    for (size_t i = 0; i < Lanes; ++i) {
+      values_[i] += other.values_[i];
+    }
+    return *this;
+  }
+
+  PackedPrimeField& DoubleInPlace() {
+    for (F& value : values_) {
+      value.DoubleInPlace();
+    }
+    return *this;
+  }
+
+  // AdditiveGroup methods
+  PackedPrimeField& SubInPlace(const PackedPrimeField& other) {
+    if constexpr (internal::IsGoldilocksPrimeField<F>::value) {
+      if (const internal::GoldilocksSimdKernels* kernels =
+              internal::GetGoldilocksSimdKernels()) {
+        kernels->sub(raw_values(), other.raw_values(), raw_values(), Lanes);
+        return *this;
+      }
+    }
+    for (size_t i = 0; i < Lanes; ++i) {
+      values_[i] -= other.values_[i];
+    }
+    return *this;
+  }
+
+  PackedPrimeField& NegInPlace() {
+    for (F& value : values_) {
+      value.NegInPlace();
+    }
+    return *this;
+  }
+
+  // MultiplicativeSemigroup methods
+  PackedPrimeField& MulInPlace(const PackedPrimeField& other) {
+#if ARCH_CPU_X86_64
+    if constexpr (internal::SupportsAvx512IfmaMul<F, Lanes>::value) {
+      static_assert(sizeof(F) == sizeof(uint64_t) * 4);
+      if (internal::kIsAvx512IfmaSupported) {
+        internal::MontgomeryMul8x4Avx512Ifma(
+            reinterpret_cast<const uint64_t*>(values_.data()),
+            reinterpret_cast<const uint64_t*>(other.values_.data()),
+            F::Config::kModulus.limbs, F::Config::kInverse64,
+            reinterpret_cast<uint64_t*>(values_.data()));
+        return *this;
+      }
+    }
+#endif
+    if constexpr (internal::IsGoldilocksPrimeField<F>::value) {
+      if (const internal::GoldilocksSimdKernels* kernels =
+              internal::GetGoldilocksSimdKernels()) {
+        kernels->mul(raw_values(), other.raw_values(), raw_values(), Lanes);
+        return *this;
+      }
+    }
+    for (size_t i = 0; i < Lanes; ++i) {
+      values_[i] *= other.values_[i];
+    }
+    return *this;
+  }
+
+  PackedPrimeField& MulInPlace(const F& scalar) {
+    return MulInPlace(Broadcast(scalar));
+  }
+
+  PackedPrimeField& SquareInPlace() { return MulInPlace(*this); }
+
+ private:
+  // NOTE(chokobole): These are only used for |IsGoldilocksPrimeField<F>|,
+  // whose elements are a single 64-bit limb.
+  uint64_t* raw_values() { return reinterpret_cast<uint64_t*>(values_.data()); }
+  const uint64_t* raw_values() const {
+    return reinterpret_cast<const uint64_t*>(values_.data());
+  }
+
+  std::array<F, Lanes> values_;
+};
+
+template <typename F, size_t Lanes>
+std::ostream& operator<<(std::ostream& os,
+                         const PackedPrimeField<F, Lanes>& packed) {
+  return os << packed.ToString();
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_H_
@@ -0,0 +1,190 @@
+#include "tachyon/math/finite_fields/packed_prime_field_avx512_ifma.h"
+
+#if ARCH_CPU_X86_64
+
+#include <immintrin.h>
+
+// NOTE(chokobole): The functions are compiled for AVX512F and AVX512IFMA
+// regardless of the compiler flags, so that a single binary can choose the
+// implementation at runtime. They must not be called unless the CPU supports
+// them.
+#define TACHYON_TARGET_AVX512_IFMA \
+  __attribute__((target("avx512f,avx512ifma")))
+
+namespace tachyon::math::internal {
+
+namespace {
+
+constexpr size_t kNumLimbs52 = 5;
+constexpr uint64_t kMask52 = (uint64_t{1} << 52) - 1;
+constexpr uint64_t kMask48 = (uint64_t{1} << 48) - 1;
+
+// Loads 8 elements of 4 64-bit limbs and converts them into 5 52-bit limbs.
+// |out[k]| holds the k-th 52-bit limb of the 8 elements.
+TACHYON_TARGET_AVX512_IFMA void Load(const uint64_t* ptr,
+                                     __m512i out[kNumLimbs52]) {
+  __m512i v0 = _mm512_loadu_si512(ptr);
+  __m512i v1 = _mm512_loadu_si512(ptr + 8);
+  __m512i v2 = _mm512_loadu_si512(ptr + 16);
+  __m512i v3 = _mm512_loadu_si512(ptr + 24);
+
+  // Transposes the 8 x 4 limbs into 4 x 8 limbs.
+  __m512i limbs[4];
+  for (int k = 0; k < 4; ++k) {
+    __m512i idx = _mm512_setr_epi64(k, k + 4, k + 8, k + 12, 0, 0, 0, 0);
+    __m512i lo = _mm512_permutex2var_epi64(v0, idx, v1);
+    __m512i hi = _mm512_permutex2var_epi64(v2, idx, v3);
+    limbs[k] = _mm512_shuffle_i64x2(lo, hi, _MM_SHUFFLE(1, 0, 1, 0));
+  }
+
+  __m512i mask = _mm512_set1_epi64(kMask52);
+  out[0] = _mm512_and_si512(limbs[0], mask);
+  out[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(limbs[0], 52),
+                                            _mm512_slli_epi64(limbs[1], 12)),
+                            mask);
+  out[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(limbs[1], 40),
+                                            _mm512_slli_epi64(limbs[2], 24)),
+                            mask);
+  out[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(limbs[2], 28),
+                                            _mm512_slli_epi64(limbs[3], 36)),
+                            mask);
+  out[4] = _mm512_srli_epi64(limbs[3], 16);
+}
+
+// The inverse of |Load()|. Each limb of |in| must be less than 2⁵² and the
+// elements must be less than 2²⁵⁶.
+TACHYON_TARGET_AVX512_IFMA void Store(const __m512i in[kNumLimbs52],
+                                      uint64_t* ptr) {
+  __m512i limbs[4];
+  limbs[0] = _mm512_or_si512(in[0], _mm512_slli_epi64(in[1], 52));
+  limbs[1] = _mm512_or_si512(_mm512_srli_epi64(in[1], 12),
+                             _mm512_slli_epi64(in[2], 40));
+  limbs[2] = _mm512_or_si512(_mm512_srli_epi64(in[2], 24),
+                             _mm512_slli_epi64(in[3], 28));
+  limbs[3] = _mm512_or_si512(_mm512_srli_epi64(in[3], 36),
+                             _mm512_slli_epi64(in[4], 16));
+
+  // Transposes the 4 x 8 limbs back into 8 x 4 limbs.
+  __m512i lo_idx = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+  __m512i hi_idx = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+  // The 0th and 1st limbs of the first and the last 4 elements.
+  __m512i l01_lo = _mm512_permutex2var_epi64(limbs[0], lo_idx, limbs[1]);
+  __m512i l01_hi = _mm512_permutex2var_epi64(limbs[0], hi_idx, limbs[1]);
+  // The 2nd and 3rd limbs of the first and the last 4 elements.
+  __m512i l23_lo = _mm512_permutex2var_epi64(limbs[2], lo_idx, limbs[3]);
+  __m512i l23_hi = _mm512_permutex2var_epi64(limbs[2], hi_idx, limbs[3]);
+
+  __m512i even_idx = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+  __m512i odd_idx = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+  _mm512_storeu_si512(ptr,
+                      _mm512_permutex2var_epi64(l01_lo, even_idx, l23_lo));
+  _mm512_storeu_si512(ptr + 8,
+                      _mm512_permutex2var_epi64(l01_lo, odd_idx, l23_lo));
+  _mm512_storeu_si512(ptr + 16,
+                      _mm512_permutex2var_epi64(l01_hi, even_idx, l23_hi));
+  _mm512_storeu_si512(ptr + 24,
+                      _mm512_permutex2var_epi64(l01_hi, odd_idx, l23_hi));
+}
+
+// Computes |r| = |a| * |b| * 2⁻²⁵⁶ mod |m| with the interleaved Montgomery
+// multiplication in radix 2⁵². 5 limbs of 52 bits hold 260 bits, so the first
+// 4 reductions remove 52 bits each and the last one removes 48 bits, which
+// keeps the result compatible with the Montgomery form of |PrimeField|, whose
+// R is 2²⁵⁶.
+//
+// The accumulator limbs are 64 bits, so the carries of the 52-bit limbs don't
+// have to be propagated until the end except for the lowest one.
+TACHYON_TARGET_AVX512_IFMA void MontgomeryMul(const __m512i a[kNumLimbs52],
+                                              const __m512i b[kNumLimbs52],
+                                              const __m512i m[kNumLimbs52],
+                                              __m512i inverse,
+                                              __m512i r[kNumLimbs52]) {
+  __m512i zero = _mm512_setzero_si512();
+  __m512i mask52 = _mm512_set1_epi64(kMask52);
+  __m512i t[kNumLimbs52 + 1] = {zero, zero, zero, zero, zero, zero};
+  for (size_t i = 0; i < kNumLimbs52; ++i) {
+    // t += a * bᵢ
+    for (size_t j = 0; j < kNumLimbs52; ++j) {
+      t[j] = _mm512_madd52lo_epu64(t[j], a[j], b[i]);
+      t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a[j], b[i]);
+    }
+
+    // k = t₀ * inverse mod 2⁵² (or 2⁴⁸ for the last one)
+    // t += k * m
+    __m512i k = _mm512_madd52lo_epu64(zero, t[0], inverse);
+    if (i == kNumLimbs52 - 1) {
+      k = _mm512_and_si512(k, _mm512_set1_epi64(kMask48));
+    } else {
+      k = _mm512_and_si512(k, mask52);
+    }
+    for (size_t j = 0; j < kNumLimbs52; ++j) {
+      t[j] = _mm512_madd52lo_epu64(t[j], k, m[j]);
+      t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], k, m[j]);
+    }
+
+    if (i != kNumLimbs52 - 1) {
+      // t /= 2⁵²
+      t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+      for (size_t j = 0; j < kNumLimbs52; ++j) {
+        t[j] = t[j + 1];
+      }
+      t[kNumLimbs52] = zero;
+    }
+  }
+
+  for (size_t j = 0; j < kNumLimbs52; ++j) {
+    t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], 52));
+    t[j] = _mm512_and_si512(t[j], mask52);
+  }
+  // t /= 2⁴⁸
+  for (size_t j = 0; j < kNumLimbs52; ++j) {
+    r[j] = _mm512_or_si512(
+        _mm512_srli_epi64(t[j], 48),
+        _mm512_and_si512(_mm512_slli_epi64(t[j + 1], 4), mask52));
+  }
+
+  // r is in [0, 2 * m). If r >= m, r -= m.
+  __m512i d[kNumLimbs52];
+  __m512i borrow = zero;
+  for (size_t j = 0; j < kNumLimbs52; ++j) {
+    d[j] = _mm512_sub_epi64(_mm512_sub_epi64(r[j], m[j]), borrow);
+    borrow = _mm512_srli_epi64(d[j], 63);
+    d[j] = _mm512_and_si512(d[j], mask52);
+  }
+  __mmask8 no_borrow = _mm512_cmpeq_epi64_mask(borrow, zero);
+  for (size_t j = 0; j < kNumLimbs52; ++j) {
+    r[j] = _mm512_mask_blend_epi64(no_borrow, r[j], d[j]);
+  }
+}
+
+}  // namespace
+
+TACHYON_TARGET_AVX512_IFMA void MontgomeryMul8x4Avx512Ifma(
+    const uint64_t* a, const uint64_t* b, const uint64_t* modulus,
+    uint64_t inverse64, uint64_t* out) {
+  __m512i m[kNumLimbs52];
+  m[0] = _mm512_set1_epi64(modulus[0] & kMask52);
+  m[1] = _mm512_set1_epi64(((modulus[0] >> 52) | (modulus[1] << 12)) &
+                           kMask52);
+  m[2] = _mm512_set1_epi64(((modulus[1] >> 40) | (modulus[2] << 24)) &
+                           kMask52);
+  m[3] = _mm512_set1_epi64(((modulus[2] >> 28) | (modulus[3] << 36)) &
+                           kMask52);
+  m[4] = _mm512_set1_epi64(modulus[3] >> 16);
+  // -|modulus|⁻¹ mod 2⁶⁴ is also -|modulus|⁻¹ mod 2⁵² when it is truncated.
+  __m512i inverse = _mm512_set1_epi64(inverse64 & kMask52);
+
+  __m512i x[kNumLimbs52];
+  __m512i y[kNumLimbs52];
+  __m512i r[kNumLimbs52];
+  Load(a, x);
+  Load(b, y);
+  MontgomeryMul(x, y, m, inverse, r);
+  Store(r, out);
+}
+
+}  // namespace tachyon::math::internal
+
+#undef TACHYON_TARGET_AVX512_IFMA
+
+#endif  // ARCH_CPU_X86_64
@@ -0,0 +1,26 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_IFMA_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_IFMA_H_
+
+#include <stdint.h>
+
+#include "tachyon/build/build_config.h"
+#include "tachyon/export.h"
+
+namespace tachyon::math::internal {
+
+#if ARCH_CPU_X86_64
+// Computes |out[i]| = |a[i]| * |b[i]| * 2⁻²⁵⁶ mod |modulus| for 8 elements of
+// 4 limbs stored back to back. The inputs must be less than |modulus| and
+// |inverse64| must be -|modulus|⁻¹ mod 2⁶⁴. |out| may alias |a| or |b|.
+//
+// The caller must check |base::CPU::has_avx512ifma()| before calling this.
+TACHYON_EXPORT void MontgomeryMul8x4Avx512Ifma(const uint64_t* a,
+                                               const uint64_t* b,
+                                               const uint64_t* modulus,
+                                               uint64_t inverse64,
+                                               uint64_t* out);
+#endif  // ARCH_CPU_X86_64
+
+}  // namespace tachyon::math::internal
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_IFMA_H_
@@ -0,0 +1,232 @@
+#include "tachyon/math/finite_fields/packed_prime_field.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/cpu.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename F>
+class PackedPrimeFieldTest : public testing::Test {
+ public:
+  using PackedF = PackedPrimeField<F>;
+
+  static void SetUpTestSuite() { F::Init(); }
+
+  // Returns a packed field element whose lanes contain the edge cases.
+  static PackedF Edges() {
+    PackedF ret = PackedF::Random();
+    ret[0] = F::Zero();
+    ret[1] = F::One();
+    ret[2] = -F::One();
+    return ret;
+  }
+};
+
+}  // namespace
+
+using PrimeFieldTypes = testing::Types<bn254::Fq, bn254::Fr, Goldilocks, GF7>;
+
+TYPED_TEST_SUITE(PackedPrimeFieldTest, PrimeFieldTypes);
+
+TYPED_TEST(PackedPrimeFieldTest, LoadAndStore) {
+  using F = TypeParam;
+  using PackedF = typename TestFixture::PackedF;
+
+  std::vector<F> values =
+      base::CreateVector(PackedF::kLanes, []() { return F::Random(); });
+  PackedF packed = PackedF::Load(values.data());
+  for (size_t i = 0; i < PackedF::kLanes; ++i) {
+    EXPECT_EQ(packed[i], values[i]);
+  }
+
+  std::vector<F> stored(PackedF::kLanes);
+  packed.Store(stored.data());
+  EXPECT_EQ(stored, values);
+
+  F value = F::Random();
+  PackedF broadcast = PackedF::Broadcast(value);
+  for (size_t i = 0; i < PackedF::kLanes; ++i) {
+    EXPECT_EQ(broadcast[i], value);
+  }
+  EXPECT_TRUE(PackedF::Zero().IsZero());
+  EXPECT_TRUE(PackedF::One().IsOne());
+}
+
+TYPED_TEST(PackedPrimeFieldTest, AdditiveOperators) {
+  using PackedF = typename TestFixture::PackedF;
+
+  for (size_t i = 0; i < 100; ++i) {
+    PackedF a = TestFixture::Edges();
+    PackedF b = PackedF::Random();
+
+    PackedF sum = a + b;
+    PackedF diff = a - b;
+    PackedF neg = -a;
+    PackedF dbl = a.Double();
+    for (size_t j = 0; j < PackedF::kLanes; ++j) {
+      EXPECT_EQ(sum[j], a[j] + b[j]);
+      EXPECT_EQ(diff[j], a[j] - b[j]);
+      EXPECT_EQ(neg[j], -a[j]);
+      EXPECT_EQ(dbl[j], a[j].Double());
+    }
+  }
+}
+
+TYPED_TEST(PackedPrimeFieldTest, MultiplicativeOperators) {
+  using F = TypeParam;
+  using PackedF = typename TestFixture::PackedF;
+
+  for (size_t i = 0; i < 100; ++i) {
+    PackedF a = TestFixture::Edges();
+    PackedF b = TestFixture::Edges();
+    F scalar = F::Random();
+
+    PackedF prod = a * b;
+    PackedF square = a.Square();
+    PackedF scaled = a * scalar;
+    for (size_t j = 0; j < PackedF::kLanes; ++j) {
+      EXPECT_EQ(prod[j], a[j] * b[j]);
+      EXPECT_EQ(square[j], a[j].Square());
+      EXPECT_EQ(scaled[j], a[j] * scalar);
+    }
+
+    PackedF prod_in_place = a;
+    prod_in_place *= b;
+    EXPECT_EQ(prod_in_place, prod);
+  }
+}
+
+TEST(PackedPrimeFieldSimdTest, IsSimdMulSupported) {
+  EXPECT_FALSE(PackedPrimeField<GF7>::IsSimdMulSupported());
+#if ARCH_CPU_X86_64
+  EXPECT_EQ(PackedPrimeField<bn254::Fq>::IsSimdMulSupported(),
+            base::CPU::GetInstance().has_avx512ifma());
+  EXPECT_EQ(PackedPrimeField<bn254::Fr>::IsSimdMulSupported(),
+            base::CPU::GetInstance().has_avx512ifma());
+  EXPECT_EQ(PackedPrimeField<Goldilocks>::IsSimdMulSupported(),
+            internal::GetGoldilocksSimdKernels() != nullptr);
+#else
+  EXPECT_FALSE(PackedPrimeField<bn254::Fq>::IsSimdMulSupported());
+#endif
+}
+
+#if ARCH_CPU_X86_64
+class PackedGoldilocksTest
+    : public testing::TestWithParam<const internal::GoldilocksSimdKernels*> {
+ public:
+  static void SetUpTestSuite() { Goldilocks::Init(); }
+
+  // Returns |n| elements, some of which are the edge cases.
+  static std::vector<Goldilocks> CreateValues(size_t n) {
+    std::vector<Goldilocks> ret =
+        base::CreateVector(n, []() { return Goldilocks::Random(); });
+    ret[0] = Goldilocks::Zero();
+    ret[1] = Goldilocks::One();
+    ret[2] = -Goldilocks::One();
+    return ret;
+  }
+
+  static uint64_t* Raw(std::vector<Goldilocks>& values) {
+    return reinterpret_cast<uint64_t*>(values.data());
+  }
+};
+
+TEST_P(PackedGoldilocksTest, ElementwiseOperators) {
+  const internal::GoldilocksSimdKernels* kernels = GetParam();
+  if (kernels == nullptr) {
+    GTEST_SKIP() << "The CPU doesn't support the kernels";
+  }
+
+  // The size isn't a multiple of the lanes, so that the rest is tested too.
+  size_t n = 4 * kernels->lanes + 3;
+  std::vector<Goldilocks> a = CreateValues(n);
+  std::vector<Goldilocks> b = CreateValues(n);
+  std::reverse(b.begin(), b.end());
+  std::vector<Goldilocks> sum(n);
+  std::vector<Goldilocks> diff(n);
+  std::vector<Goldilocks> prod(n);
+  kernels->add(Raw(a), Raw(b), Raw(sum), n);
+  kernels->sub(Raw(a), Raw(b), Raw(diff), n);
+  kernels->mul(Raw(a), Raw(b), Raw(prod), n);
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(sum[i], a[i] + b[i]);
+    EXPECT_EQ(diff[i], a[i] - b[i]);
+    EXPECT_EQ(prod[i], a[i] * b[i]);
+  }
+}
+
+TEST_P(PackedGoldilocksTest, Radix4Stage) {
+  const internal::GoldilocksSimdKernels* kernels = GetParam();
+  if (kernels == nullptr) {
+    GTEST_SKIP() << "The CPU doesn't support the kernels";
+  }
+
+  Goldilocks two(2);
+  for (size_t gap = 1; gap <= 32; gap *= 2) {
+    for (bool dif : {false, true}) {
+      // The twiddle factors of the stage of |gap| are given as the powers of
+      // 2 and the ones of the stage of 2 * |gap| are given as a table.
+      uint32_t exponent = 3 * (64 / gap);
+      std::vector<Goldilocks> roots2 = base::CreateVector(
+          2 * gap, []() { return Goldilocks::Random(); });
+      internal::GoldilocksTwiddles twiddles{nullptr, exponent};
+      internal::GoldilocksTwiddles twiddles2{
+          reinterpret_cast<const uint64_t*>(roots2.data()), 0};
+
+      std::vector<Goldilocks> values = CreateValues(3 * 4 * gap);
+      std::vector<Goldilocks> expected = values;
+      kernels->radix4_stage(Raw(values), 3, gap, 0, gap, twiddles, twiddles2,
+                            dif);
+
+      Goldilocks root = two.Pow(exponent);
+      for (size_t c = 0; c < 3; ++c) {
+        absl::Span<Goldilocks> chunk(&expected[c * 4 * gap], 4 * gap);
+        for (size_t i = 0; i < 2; ++i) {
+          bool is_gap_stage = (i == 0) != dif;
+          size_t stage_gap = is_gap_stage ? gap : 2 * gap;
+          for (size_t j = 0; j < 4 * gap; ++j) {
+            if ((j & stage_gap) != 0) continue;
+            size_t k = j % stage_gap;
+            Goldilocks& lo = chunk[j];
+            Goldilocks& hi = chunk[j + stage_gap];
+            Goldilocks twiddle = is_gap_stage ? root.Pow(k) : roots2[k];
+            if (dif) {
+              Goldilocks tmp = lo - hi;
+              lo += hi;
+              hi = tmp * twiddle;
+            } else {
+              Goldilocks tmp = hi * twiddle;
+              hi = lo - tmp;
+              lo += tmp;
+            }
+          }
+        }
+      }
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Kernels, PackedGoldilocksTest,
+    testing::Values(base::CPU::GetInstance().has_avx2()
+                        ? &internal::GetGoldilocksAvx2Kernels()
+                        : nullptr,
+                    base::CPU::GetInstance().has_avx512f()
+                        ? &internal::GetGoldilocksAvx512Kernels()
+                        : nullptr));
+#endif  // ARCH_CPU_X86_64
+
+}  // namespace tachyon::math
@@ -10,9 +10,12 @@
 #include <stdint.h>
 
 #include <string>
+#include <type_traits>
 
 #include "gtest/gtest_prod.h"
 
+#include "tachyon/base/cpu.h"
+#include "tachyon/base/cxx20_is_constant_evaluated.h"
 #include "tachyon/math/base/arithmetics.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
@@ -24,6 +27,26 @@ namespace tachyon::math {
 template <typename Config>
 class PrimeFieldGpu;
 
+namespace internal {
+
+// |HasAsmMul<Config>::value| is true if |Config| provides |AsmMulInPlace()|,
+// which is emitted by the prime field generator.
+template <typename Config, typename SFINAE = void>
+struct HasAsmMul : std::false_type {};
+
+template <typename Config>
+struct HasAsmMul<Config, std::enable_if_t<Config::kHasAsmMul>>
+    : std::true_type {};
+
+// NOTE(chokobole): This is read on every multiplication, so it is evaluated
+// once at static initialization instead of behind a function-local static.
+// A multiplication that runs before this is initialized reads false and falls
+// back to |FastMulInPlace()|, which yields the same result.
+inline const bool kIsAsmMulSupported = base::CPU::GetInstance().has_bmi2() &&
+                                       base::CPU::GetInstance().has_adx();
+
+}  // namespace internal
+
 // A prime field is finite field GF(p) where p is a prime number.
 template <typename _Config>
 class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
@@ -193,6 +216,11 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
   // MultiplicativeSemigroup methods
   constexpr PrimeField& MulInPlace(const PrimeField& other) {
     if constexpr (Config::kCanUseNoCarryMulOptimization) {
+      if constexpr (internal::HasAsmMul<Config>::value) {
+        if (!base::is_constant_evaluated() && internal::kIsAsmMulSupported) {
+          return AsmMulInPlace(other);
+        }
+      }
       return FastMulInPlace(other);
     } else {
       return SlowMulInPlace(other);
@@ -203,6 +231,13 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
     if (N == 1) {
       return MulInPlace(*this);
     }
+    if constexpr (internal::HasAsmMul<Config>::value) {
+      // NOTE(chokobole): The assembly multiplication is faster than the
+      // squaring below, which doesn't use MULX and ADX.
+      if (!base::is_constant_evaluated() && internal::kIsAsmMulSupported) {
+        return AsmMulInPlace(*this);
+      }
+    }
 
     BigInt<N * 2> r;
     MulResult<uint64_t> mul_result;
@@ -246,10 +281,10 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
         Config::kModulus, Config::kMontgomeryR2, &value_);
   }
 
- private:
-  template <typename PrimeField>
-  FRIEND_TEST(PrimeFieldCorrectnessTest, MultiplicativeOperators);
-
+  // NOTE(chokobole): The two multiplications below are what |MulInPlace()|
+  // dispatches to. They are exposed to be compared in the tests and the
+  // benchmarks. |AsmMulInPlace()| must only be called when
+  // |internal::kIsAsmMulSupported| is true.
   constexpr PrimeField& FastMulInPlace(const PrimeField& other) {
     BigInt<N> r;
     for (size_t i = 0; i < N; ++i) {
@@ -277,6 +312,17 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
     return *this;
   }
 
+  PrimeField& AsmMulInPlace(const PrimeField& other) {
+    Config::AsmMulInPlace(value_.limbs, other.value_.limbs);
+    BigInt<N>::template Clamp<Config::kModulusHasSpareBit>(Config::kModulus,
+                                                           &value_, 0);
+    return *this;
+  }
+
+ private:
+  template <typename PrimeField>
+  FRIEND_TEST(PrimeFieldCorrectnessTest, MultiplicativeOperators);
+
   constexpr PrimeField& SlowMulInPlace(const PrimeField& other) {
     BigInt<N * 2> r = value_.Mul(other.value_);
     BigInt<N>::template MontgomeryReduce64<Config::kModulusHasSpareBit>(
@@ -1,6 +1,7 @@
 #include "benchmark/benchmark.h"
 
 #include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
 
 namespace tachyon::math {
@@ -42,8 +43,44 @@ ADD_BENCHMARK(Mul, *)
 
 #undef ADD_BENCHMARK
 
+template <typename PrimeField>
+void BM_FastMul(benchmark::State& state) {
+  PrimeField::Init();
+  size_t size = state.range(0);
+  std::vector<PrimeField> test_set = PrepareTestSet<PrimeField>(size);
+  PrimeField ret = PrimeField::One();
+  size_t i = 0;
+  for (auto _ : state) {
+    ret.FastMulInPlace(test_set[(i++) % size]);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+template <typename PrimeField>
+void BM_AsmMul(benchmark::State& state) {
+  PrimeField::Init();
+  if (!internal::kIsAsmMulSupported) {
+    state.SkipWithError("BMI2 and ADX are not supported");
+    return;
+  }
+  size_t size = state.range(0);
+  std::vector<PrimeField> test_set = PrepareTestSet<PrimeField>(size);
+  PrimeField ret = PrimeField::One();
+  size_t i = 0;
+  for (auto _ : state) {
+    ret.AsmMulInPlace(test_set[(i++) % size]);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
 BENCHMARK_TEMPLATE(BM_Add, bn254::Fq)->Arg(1000);
 BENCHMARK_TEMPLATE(BM_Mul, bn254::Fq)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_FastMul, bn254::Fq)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_AsmMul, bn254::Fq)->Arg(1000);
+
+BENCHMARK_TEMPLATE(BM_Mul, bn254::Fr)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_FastMul, bn254::Fr)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_AsmMul, bn254::Fr)->Arg(1000);
 
 BENCHMARK_TEMPLATE(BM_Add, Goldilocks)->Arg(1000);
 BENCHMARK_TEMPLATE(BM_Mul, Goldilocks)->Arg(1000);
@@ -1,6 +1,10 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/buffer.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/math/finite_fields/test/gf7.h"
 
 namespace tachyon::math {
@@ -12,6 +16,12 @@ class PrimeFieldTest : public testing::Test {
   static void SetUpTestSuite() { GF7::Init(); }
 };
 
+template <typename PrimeField>
+class PrimeFieldAsmMulTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PrimeField::Init(); }
+};
+
 }  // namespace
 
 TEST_F(PrimeFieldTest, FromString) {
@@ -201,4 +211,44 @@ TEST_F(PrimeFieldTest, Copyable) {
   EXPECT_EQ(expected, value);
 }
 
+using AsmMulPrimeFieldTypes = testing::Types<bn254::Fq, bn254::Fr>;
+TYPED_TEST_SUITE(PrimeFieldAsmMulTest, AsmMulPrimeFieldTypes);
+
+TYPED_TEST(PrimeFieldAsmMulTest, MulInPlace) {
+  using F = TypeParam;
+  using BigIntTy = typename F::BigIntTy;
+
+  if constexpr (internal::HasAsmMul<typename F::Config>::value) {
+    if (!internal::kIsAsmMulSupported) {
+      GTEST_SKIP() << "BMI2 and ADX are not supported";
+    }
+
+    // NOTE(chokobole): |F::Zero() - F::One()| is modulus - 1 as a field
+    // element, while |F::FromMontgomery(kModulus - 1)| puts modulus - 1 in the
+    // limbs, which is the largest input the assembly sees.
+    std::vector<F> values = {
+        F::Zero(),
+        F::One(),
+        F::Zero() - F::One(),
+        F::FromMontgomery(F::Config::kModulus - BigIntTy::One()),
+        F::FromMontgomery(BigIntTy::One()),
+    };
+    for (size_t i = 0; i < 32; ++i) {
+      values.push_back(F::Random());
+    }
+
+    for (const F& a : values) {
+      for (const F& b : values) {
+        F expected = a;
+        expected.FastMulInPlace(b);
+        F actual = a;
+        actual.AsmMulInPlace(b);
+        EXPECT_EQ(actual, expected);
+      }
+    }
+  } else {
+    GTEST_SKIP() << "Assembly multiplication is not generated";
+  }
+}
+
 }  // namespace tachyon::math
@@ -0,0 +1,66 @@
+#include <limits>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+namespace tachyon::math {
+
+template <typename F, bool UseFourStepFFT>
+void BM_FFT(benchmark::State& state) {
+  using Domain = Radix2EvaluationDomain<F>;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  F::Init();
+  size_t size = state.range(0);
+  std::unique_ptr<Domain> domain = Domain::Create(size);
+  domain->set_four_step_fft_threshold(
+      UseFourStepFFT ? 0 : std::numeric_limits<size_t>::max());
+  const BaseDomain* base_domain = domain.get();
+  DensePoly poly = DensePoly::Random(size - 1);
+  Evals evals;
+  for (auto _ : state) {
+    evals = base_domain->FFT(poly);
+  }
+  benchmark::DoNotOptimize(evals);
+}
+
+template <typename F, bool UseFourStepFFT>
+void BM_IFFT(benchmark::State& state) {
+  using Domain = Radix2EvaluationDomain<F>;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  F::Init();
+  size_t size = state.range(0);
+  std::unique_ptr<Domain> domain = Domain::Create(size);
+  domain->set_four_step_fft_threshold(
+      UseFourStepFFT ? 0 : std::numeric_limits<size_t>::max());
+  const BaseDomain* base_domain = domain.get();
+  Evals evals = Evals::Random(size - 1);
+  DensePoly poly;
+  for (auto _ : state) {
+    poly = base_domain->IFFT(evals);
+  }
+  benchmark::DoNotOptimize(poly);
+}
+
+BENCHMARK_TEMPLATE(BM_FFT, bn254::Fr, false)
+    ->RangeMultiplier(4)
+    ->Range(1 << 16, 1 << 24);
+BENCHMARK_TEMPLATE(BM_FFT, bn254::Fr, true)
+    ->RangeMultiplier(4)
+    ->Range(1 << 16, 1 << 24);
+BENCHMARK_TEMPLATE(BM_IFFT, bn254::Fr, false)
+    ->RangeMultiplier(4)
+    ->Range(1 << 16, 1 << 24);
+BENCHMARK_TEMPLATE(BM_IFFT, bn254::Fr, true)
+    ->RangeMultiplier(4)
+    ->Range(1 << 16, 1 << 24);
+
+}  // namespace tachyon::math
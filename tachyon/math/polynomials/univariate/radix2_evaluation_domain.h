@@ -15,10 +15,13 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
+#include "absl/base/call_once.h"
 #include "absl/memory/memory.h"
 #include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
@@ -27,6 +30,9 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/base/threading/parallel_for.h"
+#include "tachyon/base/threading/thread_pool.h"
+#include "tachyon/math/finite_fields/packed_prime_field.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 
@@ -53,6 +59,16 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   constexpr static size_t kMinGapSizeForParallelization = 1 << 10;
   // The minimum number of chunks at which root compaction is beneficial.
   constexpr static size_t kDefaultMinNumChunksForCompaction = 1 << 7;
+  // The default maximum number of bytes that the cached twiddle factors of a
+  // single direction of the transform can take.
+  constexpr static size_t kDefaultTwiddleCacheMaxBytes = size_t{1} << 30;
+  // The default minimum size of the domain at which the in-order FFT and IFFT
+  // switch to the four-step algorithm. At this size, the evaluations of a
+  // 256-bit field no longer fit in the last level cache of most CPUs.
+  // See //tachyon/math/polynomials/univariate:fft_benchmark.
+  constexpr static size_t kDefaultFourStepFFTThreshold = size_t{1} << 20;
+  // The number of rows and columns of a tile of the blocked transpose.
+  constexpr static size_t kTransposeBlockSize = 16;
 
   enum class FFTOrder {
     // The input of the FFT must be in-order, but the output does not have to
@@ -84,9 +100,67 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     return min_num_chunks_for_compaction_;
   }
 
+  // Sets the maximum number of bytes that the twiddle factors of each
+  // direction of the transform can take. Caching only the roots takes
+  // n / 2 field elements and caching the compacted roots of every stage takes
+  // up to n / 2 more. If |max_bytes| is too small for the roots, nothing is
+  // cached and the roots are computed on every transform. This drops the
+  // twiddle factors shared with the domains cloned before.
+  void set_twiddle_cache_max_bytes(size_t max_bytes) {
+    twiddle_cache_max_bytes_ = max_bytes;
+    twiddle_cache_ = std::make_shared<TwiddleCache>();
+  }
+
+  size_t twiddle_cache_max_bytes() const { return twiddle_cache_max_bytes_; }
+
+  // Sets the minimum size of the domain at which the in-order FFT and IFFT use
+  // the four-step algorithm. See |FourStepFFTInPlace()|. Pass
+  // |std::numeric_limits<size_t>::max()| to disable it.
+  void set_four_step_fft_threshold(size_t four_step_fft_threshold) {
+    four_step_fft_threshold_ = four_step_fft_threshold;
+  }
+
+  size_t four_step_fft_threshold() const { return four_step_fft_threshold_; }
+
  private:
   template <typename T>
   FRIEND_TEST(UnivariateEvaluationDomainTest, RootsOfUnity);
+  template <typename T>
+  FRIEND_TEST(UnivariateEvaluationDomainTest, TwiddleCache);
+  template <typename T>
+  FRIEND_TEST(UnivariateEvaluationDomainTest, FourStepFFT);
+  FRIEND_TEST(Radix2EvaluationDomainTest, LargeGoldilocksFFT);
+
+  // The twiddle factors of a single direction of the transform, where ω is
+  // |group_gen_| for the FFT and |group_gen_inv_| for the IFFT.
+  struct TwiddleTable {
+    absl::once_flag once;
+    // |roots[i]| = ωⁱ for i in [0, n / 2).
+    std::vector<F> roots;
+    // |compacted_roots[k][i]| = |roots[i * (n / 2ᵏ⁺¹)]| for i in [0, 2ᵏ), which
+    // are the twiddle factors of the stage whose gap is 2ᵏ laid out
+    // contiguously. The stage whose gap is n / 2 uses |roots| as is.
+    std::vector<std::vector<F>> compacted_roots;
+  };
+
+  // NOTE(chokobole): This is shared among the domains created by |Clone()|,
+  // since they have the same size and generator. The tables are built lazily,
+  // at most once, even if the transforms run concurrently.
+  struct TwiddleCache {
+    TwiddleTable forward;
+    TwiddleTable inverse;
+  };
+
+  // NOTE(chokobole): |FourStepFFTInPlace()| needs a scratch buffer of n
+  // elements. Each transform takes one from here and gives back the storage
+  // of its input, which it swaps with the scratch buffer, so only the first
+  // transform allocates. This holds as many buffers as the transforms that
+  // have run at once, and it is shared among the domains created by
+  // |Clone()| like |TwiddleCache|.
+  struct ScratchBuffers {
+    std::mutex mutex;
+    std::vector<std::vector<F>> buffers;
+  };
 
   using UnivariateEvaluationDomain<F, MaxDegree>::UnivariateEvaluationDomain;
 
@@ -124,6 +198,109 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     return poly;
   }
 
+  // Unlike calling |FFT()| for each of |polys|, the multiplication by the
+  // powers of |coset_factor| is fused into the bit-reversal permutation and
+  // each butterfly of a stage is applied to every polynomial with a single
+  // twiddle factor load.
+  [[nodiscard]] std::vector<Evals> CosetFFTs(
+      absl::Span<const DensePoly* const> polys,
+      const F& coset_factor) const override {
+    std::vector<Evals> ret(polys.size());
+    if (polys.empty()) return ret;
+
+    bool four_step = ShouldUseFourStepFFT();
+    F factor = this->offset_ * coset_factor;
+    std::vector<F*> columns(polys.size());
+    for (size_t i = 0; i < polys.size(); ++i) {
+      const std::vector<F>& coeffs = polys[i]->coefficients_.coefficients_;
+      CHECK_LE(coeffs.size(), this->size_);
+      std::vector<F>& evals = ret[i].evaluations_;
+      evals.resize(this->size_);
+      ScaleAndPermute(coeffs, factor, /*permute=*/!four_step, evals);
+      columns[i] = evals.data();
+    }
+
+    if (four_step) {
+      for (Evals& evals : ret) {
+        FourStepFFTInPlace(evals.evaluations_, /*inverse=*/false);
+      }
+    } else {
+      BatchOutInHelper(columns);
+    }
+    return ret;
+  }
+
+  // Writes |coeffs[i]| * |factor|ⁱ into |out[rev(i)]| if |permute| is true,
+  // otherwise into |out[i]|, where rev(i) is the bit reversal of i. |out| is
+  // padded with zeros.
+  void ScaleAndPermute(const std::vector<F>& coeffs, const F& factor,
+                       bool permute, std::vector<F>& out) const {
+    size_t n = this->size_;
+    uint32_t log_n = this->log_size_of_group_;
+    base::ParallelForChunks(
+        0, n,
+        [&coeffs, &factor, permute, &out, log_n](size_t begin, size_t end) {
+          F pow = factor.Pow(begin);
+          for (size_t j = begin; j < end; ++j) {
+            size_t idx =
+                (permute && log_n > 0)
+                    ? base::bits::BitRev(j) >> (sizeof(size_t) * 8 - log_n)
+                    : j;
+            if (j < coeffs.size()) {
+              out[idx] = coeffs[j] * pow;
+              pow *= factor;
+            } else {
+              out[idx] = F::Zero();
+            }
+          }
+        },
+        /*grain_size=*/1024);
+  }
+
+  // Runs the stages of |OutInHelper()| over all of |columns| at once, which
+  // are bit-reversed by |ScaleAndPermute()|.
+  void BatchOutInHelper(const std::vector<F*>& columns) const {
+    size_t n = this->size_;
+    if (n < 2) return;
+    const TwiddleTable& twiddles = GetTwiddleTable(/*inverse=*/false);
+    std::vector<F> computed_roots;
+    if (twiddles.roots.empty()) {
+      computed_roots = this->GetRootsOfUnity(n / 2, this->group_gen_);
+    }
+    absl::Span<const F> roots = twiddles.roots.empty()
+                                    ? absl::MakeConstSpan(computed_roots)
+                                    : absl::MakeConstSpan(twiddles.roots);
+
+    size_t half_n = n / 2;
+    size_t block_size = std::min(half_n, kMinGapSizeForParallelization);
+    for (size_t gap = 1; gap < n; gap *= 2) {
+      uint32_t log_gap = base::bits::Log2Floor(gap);
+      absl::Span<const F> stage_roots = roots;
+      size_t step = half_n / gap;
+      if (!twiddles.compacted_roots.empty()) {
+        stage_roots = GetCompactedRoots(twiddles, gap);
+        step = 1;
+      }
+      // The b-th butterfly of a stage combines the (i + j)-th and the
+      // (i + j + |gap|)-th elements, where i = (b / |gap|) * 2 * |gap| and
+      // j = b % |gap|.
+      base::ParallelForChunks(
+          0, half_n,
+          [&columns, stage_roots, gap, log_gap, step](size_t begin,
+                                                      size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+              size_t j = k & (gap - 1);
+              size_t lo = ((k >> log_gap) << (log_gap + 1)) + j;
+              const F& root = stage_roots[j * step];
+              for (F* column : columns) {
+                Base::ButterflyFnOutIn(column[lo], column[lo + gap], root);
+              }
+            }
+          },
+          block_size);
+    }
+  }
+
   // Degree aware FFT that runs in O(n log d) instead of O(n log n).
   // Implementation copied from libiop. (See
   // https://github.com/arkworks-rs/algebra/blob/master/poly/src/domain/radix2/fft.rs#L28)
@@ -157,7 +334,7 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
                                    });
     }
     size_t start_gap = duplicity_of_initials;
-    OutInHelper(evals, this->group_gen_, start_gap);
+    OutInHelper(evals, start_gap);
   }
 
   constexpr void InOrderFFTInPlace(Evals& evals) const {
@@ -170,11 +347,11 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   constexpr void InOrderIFFTInPlace(DensePoly& poly) const {
     IFFTHelperInPlace(poly);
     if (this->offset_.IsOne()) {
-      // clang-format off
-      OPENMP_PARALLEL_FOR(F& val : poly.coefficients_.coefficients_) {
-        // clang-format on
-        val *= this->size_inv_;
-      }
+      std::vector<F>& coefficients = poly.coefficients_.coefficients_;
+      base::ParallelFor(0, coefficients.size(),
+                        [this, &coefficients](size_t i) {
+                          coefficients[i] *= this->size_inv_;
+                        });
     } else {
       Base::DistributePowersAndMulByConst(poly, this->offset_inv_,
                                           this->size_inv_);
@@ -182,17 +359,25 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   }
 
   constexpr void FFTHelperInPlace(Evals& evals) const {
+    if (ShouldUseFourStepFFT()) {
+      FourStepFFTInPlace(evals.evaluations_, /*inverse=*/false);
+      return;
+    }
     uint32_t log_len = static_cast<uint32_t>(base::bits::Log2Ceiling(
         static_cast<uint32_t>(evals.evaluations_.size())));
     this->SwapElements(evals, evals.evaluations_.size() - 1, log_len);
-    OutInHelper(evals, this->group_gen_, 1);
+    OutInHelper(evals, 1);
   }
 
   // Handles doing an IFFT with handling of being in order and out of order.
   // The results here must all be divided by |poly|, which is left up to the
   // caller to do.
   constexpr void IFFTHelperInPlace(DensePoly& poly) const {
-    InOutHelper(poly, this->group_gen_inv_);
+    if (ShouldUseFourStepFFT()) {
+      FourStepFFTInPlace(poly.coefficients_.coefficients_, /*inverse=*/true);
+      return;
+    }
+    InOutHelper(poly);
     uint32_t log_len = static_cast<uint32_t>(base::bits::Log2Ceiling(
         static_cast<uint32_t>(poly.coefficients_.coefficients_.size())));
     this->SwapElements(poly, poly.coefficients_.coefficients_.size() - 1,
@@ -204,44 +389,96 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
                                        absl::Span<const F> roots, size_t step,
                                        size_t chunk_size, size_t thread_nums,
                                        size_t gap) {
+    using PackedF = PackedPrimeField<F>;
     void (*fn)(F&, F&, const F&);
+    void (*packed_fn)(PackedF&, PackedF&, const PackedF&);
 
     if constexpr (Order == FFTOrder::kInOut) {
       fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnInOut;
+      packed_fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnInOut;
     } else {
       static_assert(Order == FFTOrder::kOutIn);
       fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn;
+      packed_fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn;
     }
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < poly_or_evals.NumElements();
-                        i += chunk_size) {
-      // If the chunk is sufficiently big that parallelism helps,
-      // we parallelize the butterfly operation within the chunk.
-      if (gap > kMinGapSizeForParallelization && chunk_size < thread_nums) {
-        OPENMP_PARALLEL_FOR(size_t j = 0; j < gap; ++j) {
-          if (j * step < roots.size()) {
-            fn(*poly_or_evals[i + j], *poly_or_evals[i + j + gap],
-               roots[j * step]);
+    // Applies the butterflies from the |begin|-th to the |end|-th of the chunk
+    // at |i|. If the CPU multiplies |PackedF| with SIMD instructions, they are
+    // applied to |PackedF::kLanes| positions at once and the rest are applied
+    // one by one.
+    bool use_packed = PackedF::IsSimdMulSupported();
+    auto apply = [&poly_or_evals, roots, step, gap, fn, packed_fn, use_packed](
+                     size_t i, size_t begin, size_t end) {
+      size_t j = begin;
+      if (use_packed) {
+        for (; j + PackedF::kLanes <= end; j += PackedF::kLanes) {
+          PackedF lo = PackedF::Load(poly_or_evals[i + j]);
+          PackedF hi = PackedF::Load(poly_or_evals[i + j + gap]);
+          PackedF root;
+          for (size_t l = 0; l < PackedF::kLanes; ++l) {
+            root[l] = roots[(j + l) * step];
           }
+          packed_fn(lo, hi, root);
+          lo.Store(poly_or_evals[i + j]);
+          hi.Store(poly_or_evals[i + j + gap]);
         }
+      }
+      for (; j < end; ++j) {
+        fn(*poly_or_evals[i + j], *poly_or_evals[i + j + gap],
+           roots[j * step]);
+      }
+    };
+
+    size_t num_chunks = poly_or_evals.NumElements() / chunk_size;
+    size_t num_butterflies = std::min(gap, (roots.size() + step - 1) / step);
+    base::ParallelFor(0, num_chunks, [&apply, chunk_size, num_chunks,
+                                      num_butterflies, thread_nums](size_t c) {
+      size_t i = c * chunk_size;
+      // If there are fewer chunks than threads and the chunk is sufficiently
+      // big that parallelism helps, we parallelize the butterfly operation
+      // within the chunk. The nested loop shares the threads of the outer one.
+      if (num_butterflies > kMinGapSizeForParallelization &&
+          num_chunks < thread_nums) {
+        base::ParallelForChunks(
+            0, num_butterflies,
+            [&apply, i](size_t begin, size_t end) { apply(i, begin, end); },
+            kMinGapSizeForParallelization);
       } else {
-        for (size_t j = 0, k = 0; j < gap && k < roots.size(); ++j, k += step) {
-          fn(*poly_or_evals[i + j], *poly_or_evals[i + j + gap], roots[k]);
-        }
+        apply(i, 0, num_butterflies);
       }
-    }
+    });
   }
 
-  constexpr void InOutHelper(DensePoly& poly, const F& root) const {
-    std::vector<F> roots = this->GetRootsOfUnity(this->size_ / 2, root);
+  constexpr void InOutHelper(DensePoly& poly) const {
+    DCHECK_EQ(poly.coefficients_.coefficients_.size(), this->size_);
+    if constexpr (internal::IsGoldilocksPrimeField<F>::value) {
+      if (GoldilocksNTTInPlace(poly.coefficients_.coefficients_,
+                               /*start_gap=*/1, /*dif=*/true)) {
+        return;
+      }
+    }
+    const TwiddleTable& twiddles = GetTwiddleTable(/*inverse=*/true);
+
+    size_t thread_nums = base::ThreadPool::Current()->num_threads();
+
+    if (!twiddles.compacted_roots.empty()) {
+      size_t gap = poly.coefficients_.coefficients_.size() / 2;
+      while (gap > 0) {
+        ApplyButterfly<FFTOrder::kInOut>(
+            poly, GetCompactedRoots(twiddles, gap), /*step=*/1,
+            /*chunk_size=*/2 * gap, thread_nums, gap);
+        gap /= 2;
+      }
+      return;
+    }
+
+    // The roots are compacted below, so the cached roots are copied.
+    std::vector<F> roots =
+        twiddles.roots.empty()
+            ? this->GetRootsOfUnity(this->size_ / 2, this->group_gen_inv_)
+            : twiddles.roots;
     size_t step = 1;
     bool first = true;
 
-#if defined(TACHYON_HAS_OPENMP)
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-#else
-    size_t thread_nums = 1;
-#endif
-
     size_t gap = poly.coefficients_.coefficients_.size() / 2;
     while (gap > 0) {
       // Each butterfly cluster uses 2 * |gap| positions.
@@ -254,11 +491,16 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       bool should_compact = num_chunks >= min_num_chunks_for_compaction_;
       if (should_compact) {
         if (!first) {
+          // NOTE(chokobole): The roots are compacted into another vector,
+          // because compacting them in place in parallel overwrites the roots
+          // that the other threads are about to read.
           size_t size = roots.size() / (step * 2);
-          OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
-            roots[i] = roots[i * (step * 2)];
-          }
-          roots.erase(roots.begin() + size, roots.end());
+          std::vector<F> compacted_roots(size);
+          base::ParallelFor(0, size,
+                            [&roots, &compacted_roots, step](size_t i) {
+                              compacted_roots[i] = roots[i * (step * 2)];
+                            });
+          roots = std::move(compacted_roots);
         }
         step = 1;
       } else {
@@ -272,9 +514,35 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     }
   }
 
-  constexpr void OutInHelper(Evals& evals, const F& root,
-                             size_t start_gap) const {
-    std::vector<F> roots_cache = this->GetRootsOfUnity(this->size_ / 2, root);
+  constexpr void OutInHelper(Evals& evals, size_t start_gap) const {
+    DCHECK_EQ(evals.evaluations_.size(), this->size_);
+    if constexpr (internal::IsGoldilocksPrimeField<F>::value) {
+      if (GoldilocksNTTInPlace(evals.evaluations_, start_gap, /*dif=*/false)) {
+        return;
+      }
+    }
+    const TwiddleTable& twiddles = GetTwiddleTable(/*inverse=*/false);
+
+    size_t thread_nums = base::ThreadPool::Current()->num_threads();
+
+    if (!twiddles.compacted_roots.empty()) {
+      size_t gap = start_gap;
+      while (gap < evals.evaluations_.size()) {
+        ApplyButterfly<FFTOrder::kOutIn>(
+            evals, GetCompactedRoots(twiddles, gap), /*step=*/1,
+            /*chunk_size=*/2 * gap, thread_nums, gap);
+        gap *= 2;
+      }
+      return;
+    }
+
+    std::vector<F> computed_roots;
+    if (twiddles.roots.empty()) {
+      computed_roots = this->GetRootsOfUnity(this->size_ / 2, this->group_gen_);
+    }
+    absl::Span<const F> roots_cache =
+        twiddles.roots.empty() ? absl::MakeConstSpan(computed_roots)
+                               : absl::MakeConstSpan(twiddles.roots);
     // The |std::min| is only necessary for the case where
     // |min_num_chunks_for_compaction_ = 1|. Else, notice that we compact the
     // |roots_cache| by a |step| of at least |min_num_chunks_for_compaction_|.
@@ -283,12 +551,6 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
                  roots_cache.size() / min_num_chunks_for_compaction_);
     std::vector<F> compacted_roots(compaction_max_size, F::Zero());
 
-#if defined(TACHYON_HAS_OPENMP)
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-#else
-    size_t thread_nums = 1;
-#endif
-
     size_t gap = start_gap;
     while (gap < evals.evaluations_.size()) {
       // Each butterfly cluster uses 2 * |gap| positions
@@ -301,9 +563,10 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       bool should_compact = num_chunks >= min_num_chunks_for_compaction_ &&
                             gap < evals.evaluations_.size() / 2;
       if (should_compact) {
-        OPENMP_PARALLEL_FOR(size_t i = 0; i < gap; ++i) {
+        base::ParallelFor(0, gap, [&compacted_roots, roots_cache,
+                                   num_chunks](size_t i) {
           compacted_roots[i] = roots_cache[i * num_chunks];
-        }
+        });
       }
       ApplyButterfly<FFTOrder::kOutIn>(
           evals,
@@ -315,7 +578,333 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     }
   }
 
+  // Runs the stages of |OutInHelper()| if |dif| is false, otherwise the ones
+  // of |InOutHelper()| with |GoldilocksSimdKernels|. Returns false if the CPU
+  // doesn't support them.
+  //
+  // NOTE(chokobole): In the Goldilocks prime field, 2 is a 192-th root of
+  // unity, so the twiddle factors of the stages whose gap is at most 32 are
+  // powers of 2 and they are multiplied with shifts. Besides, 2 stages are
+  // applied at once with the radix-4 butterflies, which halves the number of
+  // passes over |values|.
+  bool GoldilocksNTTInPlace(std::vector<F>& values, size_t start_gap,
+                            bool dif) const {
+    static_assert(sizeof(F) == sizeof(uint64_t));
+    const internal::GoldilocksSimdKernels* kernels =
+        internal::GetGoldilocksSimdKernels();
+    if (kernels == nullptr) return false;
+
+    size_t n = values.size();
+    if (n < 2) return true;
+    const TwiddleTable& twiddles = GetTwiddleTable(dif);
+    const F& root = dif ? this->group_gen_inv_ : this->group_gen_;
+
+    // |stage_twiddles[k]| is the twiddle factors of the stage whose gap is
+    // 2ᵏ. ω_m = 2^e is found for m = min(n, 64), so that ω_{2ᵏ⁺¹} is
+    // 2^{e * m / 2ᵏ⁺¹} for 2ᵏ⁺¹ <= m.
+    uint32_t log_n = this->log_size_of_group_;
+    size_t m = std::min(n, size_t{64});
+    uint32_t exponent = FindGoldilocksExponent(root.Pow(n / m));
+    std::vector<internal::GoldilocksTwiddles> stage_twiddles(log_n);
+    std::vector<std::vector<F>> computed_roots(log_n);
+    for (uint32_t k = 0; k < log_n; ++k) {
+      size_t gap = size_t{1} << k;
+      if (2 * gap <= m) {
+        stage_twiddles[k].exponent = static_cast<uint32_t>(
+            (exponent * (m / (2 * gap))) % internal::kGoldilocksTwoOrder);
+      } else {
+        absl::Span<const F> roots =
+            GetSubFFTRoots(twiddles, root, 2 * gap, &computed_roots[k]);
+        stage_twiddles[k].roots =
+            reinterpret_cast<const uint64_t*>(roots.data());
+      }
+    }
+
+    uint64_t* data = reinterpret_cast<uint64_t*>(values.data());
+    // Calls |stage(chunk, num_chunks, j_begin, j_end)| over the chunks of
+    // |chunk_size| in parallel. Each call covers about
+    // |kMinGapSizeForParallelization| butterflies.
+    auto run = [data, n](size_t chunk_size, size_t gap, auto stage) {
+      size_t num_chunks = n / chunk_size;
+      size_t j_block = std::min(gap, kMinGapSizeForParallelization);
+      size_t num_j_blocks = gap / j_block;
+      size_t chunks_per_item = std::min(
+          num_chunks,
+          std::max(kMinGapSizeForParallelization / gap, size_t{1}));
+      size_t num_items = num_chunks / chunks_per_item * num_j_blocks;
+      base::ParallelFor(0, num_items, [data, chunk_size, num_j_blocks,
+                                       chunks_per_item, j_block,
+                                       &stage](size_t item) {
+        size_t chunk = item / num_j_blocks * chunks_per_item;
+        size_t j = item % num_j_blocks * j_block;
+        stage(data + chunk * chunk_size, chunks_per_item, j, j + j_block);
+      });
+    };
+    auto radix2 = [kernels, dif, &stage_twiddles, &run](size_t gap) {
+      const internal::GoldilocksTwiddles& w =
+          stage_twiddles[base::bits::Log2Floor(gap)];
+      run(2 * gap, gap,
+          [kernels, dif, gap, &w](uint64_t* chunk, size_t num_chunks,
+                                  size_t j_begin, size_t j_end) {
+            kernels->radix2_stage(chunk, num_chunks, gap, j_begin, j_end, w,
+                                  dif);
+          });
+    };
+    auto radix4 = [kernels, dif, &stage_twiddles, &run](size_t gap) {
+      uint32_t log_gap = base::bits::Log2Floor(gap);
+      const internal::GoldilocksTwiddles& w = stage_twiddles[log_gap];
+      const internal::GoldilocksTwiddles& w2 = stage_twiddles[log_gap + 1];
+      run(4 * gap, gap,
+          [kernels, dif, gap, &w, &w2](uint64_t* chunk, size_t num_chunks,
+                                       size_t j_begin, size_t j_end) {
+            kernels->radix4_stage(chunk, num_chunks, gap, j_begin, j_end, w,
+                                  w2, dif);
+          });
+    };
+
+    if (dif) {
+      size_t gap = n / 2;
+      for (; gap >= 2; gap /= 4) {
+        radix4(gap / 2);
+      }
+      if (gap == 1) radix2(1);
+    } else {
+      size_t gap = start_gap;
+      for (; 4 * gap <= n; gap *= 4) {
+        radix4(gap);
+      }
+      if (gap < n) radix2(gap);
+    }
+    return true;
+  }
+
+  // Returns e such that 2^e = |root|, where the order of |root| divides 64.
+  static uint32_t FindGoldilocksExponent(const F& root) {
+    F pow = F::One();
+    for (uint32_t e = 0; e < internal::kGoldilocksTwoOrder; ++e) {
+      if (pow == root) return e;
+      pow.DoubleInPlace();
+    }
+    NOTREACHED();
+    return 0;
+  }
+
+  bool ShouldUseFourStepFFT() const {
+    // NOTE(chokobole): |GoldilocksNTTInPlace()| already blocks its stages so
+    // that they stay in cache, so it is preferred at every size if the CPU
+    // supports |GoldilocksSimdKernels|.
+    if constexpr (internal::IsGoldilocksPrimeField<F>::value) {
+      if (internal::GetGoldilocksSimdKernels() != nullptr) return false;
+    }
+    return this->log_size_of_group_ >= 2 &&
+           this->size_ >= four_step_fft_threshold_;
+  }
+
+  // Computes the FFT of |values| in place with ω = |group_gen_| or the IFFT
+  // without the division by n with ω = |group_gen_inv_|, where both the input
+  // and the output are in order. It uses the Bailey's four-step algorithm.
+  // Let n = n₁ * n₂, j = j₁ + n₁ * j₂ and k = k₂ + n₂ * k₁, then
+  //
+  //   X[k₂ + n₂ * k₁] = Σ_{j₁} ω_{n₁}^{j₁ * k₁} * ω^{j₁ * k₂} *
+  //                     Σ_{j₂} ω_{n₂}^{j₂ * k₂} * a[j₁ + n₁ * j₂]
+  //
+  // 1. Transpose the n₂ x n₁ matrix |values| into a n₁ x n₂ matrix.
+  // 2. Run a FFT of size n₂ on each row and multiply the j₁-th row by
+  //    ω^{j₁ * k₂}.
+  // 3. Transpose it into a n₂ x n₁ matrix and run a FFT of size n₁ on each
+  //    row.
+  // 4. Transpose it into a n₁ x n₂ matrix.
+  //
+  // Each sub-FFT runs on a contiguous row that fits in cache, so every element
+  // is moved between cache and memory a few times rather than once per stage.
+  // See https://www.davidhbailey.com/dhbpapers/fftq.pdf
+  void FourStepFFTInPlace(std::vector<F>& values, bool inverse) const {
+    DCHECK_EQ(values.size(), this->size_);
+    const TwiddleTable& twiddles = GetTwiddleTable(inverse);
+    const F& root = inverse ? this->group_gen_inv_ : this->group_gen_;
+    uint32_t log_n = this->log_size_of_group_;
+    size_t n1 = size_t{1} << ((log_n + 1) / 2);
+    size_t n2 = size_t{1} << (log_n / 2);
+
+    std::vector<F> buffer = AcquireScratchBuffer();
+    Transpose(values, n2, n1, absl::MakeSpan(buffer));
+
+    bool use_packed = PackedPrimeField<F>::IsSimdMulSupported();
+    std::vector<F> computed_roots;
+    absl::Span<const F> roots =
+        GetSubFFTRoots(twiddles, root, n2, &computed_roots);
+    base::ParallelFor(0, n1, [&buffer, n2, roots, use_packed, &twiddles,
+                              &root](size_t j1) {
+      absl::Span<F> row(&buffer[j1 * n2], n2);
+      SerialFFTInPlace(row, roots, use_packed);
+      if (j1 == 0) return;
+      // NOTE(chokobole): j₁ < n₁ <= n / 2, so ω^{j₁} can be read from the
+      // cached roots.
+      F step = twiddles.roots.empty() ? root.Pow(j1) : twiddles.roots[j1];
+      F twiddle = step;
+      for (size_t k2 = 1; k2 < n2; ++k2) {
+        row[k2] *= twiddle;
+        twiddle *= step;
+      }
+    });
+
+    Transpose(buffer, n1, n2, absl::MakeSpan(values));
+
+    roots = GetSubFFTRoots(twiddles, root, n1, &computed_roots);
+    base::ParallelFor(0, n2, [&values, n1, roots, use_packed](size_t k2) {
+      SerialFFTInPlace(absl::Span<F>(&values[k2 * n1], n1), roots, use_packed);
+    });
+
+    Transpose(values, n2, n1, absl::MakeSpan(buffer));
+    values.swap(buffer);
+    ReleaseScratchBuffer(std::move(buffer));
+  }
+
+  // Returns a buffer of n elements from |scratch_buffers_| or a new one if
+  // there is none. See |ScratchBuffers|.
+  std::vector<F> AcquireScratchBuffer() const {
+    {
+      std::lock_guard<std::mutex> lock(scratch_buffers_->mutex);
+      std::vector<std::vector<F>>& buffers = scratch_buffers_->buffers;
+      if (!buffers.empty()) {
+        std::vector<F> ret = std::move(buffers.back());
+        buffers.pop_back();
+        return ret;
+      }
+    }
+    return std::vector<F>(this->size_);
+  }
+
+  void ReleaseScratchBuffer(std::vector<F>&& buffer) const {
+    DCHECK_EQ(buffer.size(), this->size_);
+    std::lock_guard<std::mutex> lock(scratch_buffers_->mutex);
+    scratch_buffers_->buffers.push_back(std::move(buffer));
+  }
+
+  // Returns ω_m⁰, ω_m¹, ..., ω_m^{m / 2 - 1}, where ω_m = ω^{n / m}.
+  absl::Span<const F> GetSubFFTRoots(const TwiddleTable& twiddles,
+                                     const F& root, size_t m,
+                                     std::vector<F>* computed_roots) const {
+    if (!twiddles.compacted_roots.empty()) {
+      return GetCompactedRoots(twiddles, m / 2);
+    }
+    *computed_roots =
+        F::GetSuccessivePowers(m / 2, root.Pow(this->size_ / m));
+    return *computed_roots;
+  }
+
+  // Computes the FFT of |values| in place serially, where the input and the
+  // output are in order and |roots| is the return value of
+  // |GetSubFFTRoots()|. If |use_packed| is true, the butterflies of the stages
+  // whose gap is at least |PackedPrimeField<F>::kLanes| are applied to that
+  // many positions at once like |ApplyButterfly()|.
+  // NOTE(chokobole): The Goldilocks SIMD kernels of |GoldilocksNTTInPlace()|
+  // aren't used here, because |ShouldUseFourStepFFT()| never picks this
+  // algorithm when they are available.
+  static void SerialFFTInPlace(absl::Span<F> values, absl::Span<const F> roots,
+                               bool use_packed) {
+    using PackedF = PackedPrimeField<F>;
+
+    size_t m = values.size();
+    uint32_t log_m = base::bits::Log2Floor(m);
+    for (size_t idx = 1; idx < m; ++idx) {
+      size_t ridx = base::bits::BitRev(idx) >> (sizeof(size_t) * 8 - log_m);
+      if (idx < ridx) {
+        std::swap(values[idx], values[ridx]);
+      }
+    }
+    for (size_t gap = 1; gap < m; gap *= 2) {
+      size_t step = m / (2 * gap);
+      bool packed = use_packed && gap >= PackedF::kLanes;
+      for (size_t i = 0; i < m; i += 2 * gap) {
+        size_t j = 0;
+        if (packed) {
+          for (; j + PackedF::kLanes <= gap; j += PackedF::kLanes) {
+            PackedF lo = PackedF::Load(&values[i + j]);
+            PackedF hi = PackedF::Load(&values[i + j + gap]);
+            PackedF root;
+            for (size_t l = 0; l < PackedF::kLanes; ++l) {
+              root[l] = roots[(j + l) * step];
+            }
+            Base::ButterflyFnOutIn(lo, hi, root);
+            lo.Store(&values[i + j]);
+            hi.Store(&values[i + j + gap]);
+          }
+        }
+        for (; j < gap; ++j) {
+          Base::ButterflyFnOutIn(values[i + j], values[i + j + gap],
+                                 roots[j * step]);
+        }
+      }
+    }
+  }
+
+  // Transposes the |rows| x |cols| matrix |src| into |dst| tile by tile, so
+  // that both of them are accessed in cache-sized blocks.
+  static void Transpose(absl::Span<const F> src, size_t rows, size_t cols,
+                        absl::Span<F> dst) {
+    size_t row_blocks = (rows + kTransposeBlockSize - 1) / kTransposeBlockSize;
+    base::ParallelFor(0, row_blocks, [src, rows, cols, dst](size_t i) {
+      size_t row_begin = i * kTransposeBlockSize;
+      size_t row_end = std::min(row_begin + kTransposeBlockSize, rows);
+      for (size_t col_begin = 0; col_begin < cols;
+           col_begin += kTransposeBlockSize) {
+        size_t col_end = std::min(col_begin + kTransposeBlockSize, cols);
+        for (size_t r = row_begin; r < row_end; ++r) {
+          for (size_t c = col_begin; c < col_end; ++c) {
+            dst[c * rows + r] = src[r * cols + c];
+          }
+        }
+      }
+    });
+  }
+
+  const TwiddleTable& GetTwiddleTable(bool inverse) const {
+    TwiddleTable& twiddles =
+        inverse ? twiddle_cache_->inverse : twiddle_cache_->forward;
+    absl::call_once(twiddles.once, [this, inverse, &twiddles]() {
+      BuildTwiddleTable(inverse ? this->group_gen_inv_ : this->group_gen_,
+                        &twiddles);
+    });
+    return twiddles;
+  }
+
+  void BuildTwiddleTable(const F& root, TwiddleTable* twiddles) const {
+    size_t half_size = this->size_ / 2;
+    size_t roots_bytes = half_size * sizeof(F);
+    if (half_size == 0 || roots_bytes > twiddle_cache_max_bytes_) return;
+    twiddles->roots = this->GetRootsOfUnity(half_size, root);
+
+    // The compacted roots take less than |roots_bytes| in total.
+    if (2 * roots_bytes > twiddle_cache_max_bytes_) return;
+    uint32_t log_half_size = this->log_size_of_group_ - 1;
+    twiddles->compacted_roots.resize(log_half_size);
+    for (uint32_t k = 0; k < log_half_size; ++k) {
+      size_t gap = size_t{1} << k;
+      size_t step = half_size >> k;
+      std::vector<F>& compacted_roots = twiddles->compacted_roots[k];
+      compacted_roots.resize(gap);
+      base::ParallelFor(0, gap, [&compacted_roots, twiddles, step](size_t i) {
+        compacted_roots[i] = twiddles->roots[i * step];
+      });
+    }
+  }
+
+  // Returns the twiddle factors of the stage whose gap is |gap|.
+  // See |TwiddleTable::compacted_roots|.
+  static absl::Span<const F> GetCompactedRoots(const TwiddleTable& twiddles,
+                                               size_t gap) {
+    if (gap == twiddles.roots.size()) return twiddles.roots;
+    return twiddles.compacted_roots[base::bits::Log2Floor(gap)];
+  }
+
   size_t min_num_chunks_for_compaction_ = kDefaultMinNumChunksForCompaction;
+  size_t twiddle_cache_max_bytes_ = kDefaultTwiddleCacheMaxBytes;
+  size_t four_step_fft_threshold_ = kDefaultFourStepFFTThreshold;
+  std::shared_ptr<TwiddleCache> twiddle_cache_ =
+      std::make_shared<TwiddleCache>();
+  std::shared_ptr<ScratchBuffers> scratch_buffers_ =
+      std::make_shared<ScratchBuffers>();
 };
 
 }  // namespace tachyon::math
@@ -2,6 +2,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/buffer.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
 #include "tachyon/math/finite_fields/test/gf7.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 
@@ -273,6 +274,45 @@ TEST_F(UnivariateDensePolynomialTest, MultiplicativeOperators) {
   }
 }
 
+// The large polynomials are multiplied with the Karatsuba or the NTT
+// multiplication and divided with the Newton iteration, which are checked
+// against the schoolbook multiplication.
+TEST(UnivariateDensePolynomialLargeTest, MultiplicativeOperators) {
+  using F = bls12_381::Fr;
+  using LargePoly = UnivariateDensePolynomial<F, 2048>;
+  using LargeCoeffs = UnivariateDenseCoefficients<F, 2048>;
+
+  F::Init();
+
+  struct {
+    size_t a_degree;
+    size_t b_degree;
+  } tests[] = {
+      {10, 40}, {100, 100}, {300, 40}, {300, 700}, {1000, 999}, {1500, 200},
+  };
+
+  for (const auto& test : tests) {
+    SCOPED_TRACE(absl::Substitute("a_degree: $0, b_degree: $1", test.a_degree,
+                                  test.b_degree));
+    LargePoly a = LargePoly::Random(test.a_degree);
+    LargePoly b = LargePoly::Random(test.b_degree);
+
+    std::vector<F> expected =
+        base::CreateVector(test.a_degree + test.b_degree + 1, F::Zero());
+    internal::SchoolbookMulAccumulate(
+        absl::MakeConstSpan(a.coefficients().coefficients()),
+        absl::MakeConstSpan(b.coefficients().coefficients()),
+        absl::MakeSpan(expected));
+    LargePoly mul = a * b;
+    EXPECT_EQ(mul, LargePoly(LargeCoeffs(std::move(expected))));
+
+    LargePoly r = LargePoly::Random(test.b_degree - 1);
+    LargePoly dividend = mul + r;
+    EXPECT_EQ(dividend / b, a);
+    EXPECT_EQ(dividend % b, r);
+  }
+}
+
 TEST_F(UnivariateDensePolynomialTest, MulScalar) {
   Poly poly = Poly::Random(kMaxDegree);
   GF7 scalar = GF7::Random();
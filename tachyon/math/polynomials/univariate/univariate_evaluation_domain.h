@@ -11,7 +11,10 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/base/range.h"
@@ -116,6 +119,23 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   // Compute an IFFT.
   [[nodiscard]] constexpr virtual DensePoly IFFT(const Evals& evals) const = 0;
 
+  // Compute a FFT of each of |polys| after multiplying the i-th coefficient
+  // by |coset_factor|ⁱ. In other words, each of |polys| is evaluated over
+  // the coset of this domain shifted by |coset_factor|. Unlike |FFT()|, the
+  // result always has |size_| evaluations, even for a zero polynomial.
+  [[nodiscard]] virtual std::vector<Evals> CosetFFTs(
+      absl::Span<const DensePoly* const> polys, const F& coset_factor) const {
+    return base::Map(polys, [this, &coset_factor](const DensePoly* poly) {
+      DensePoly cloned = *poly;
+      DistributePowers(cloned, coset_factor);
+      Evals evals = FFT(cloned);
+      if (evals.NumElements() == 0) {
+        return Evals(std::vector<F>(size_, F::Zero()));
+      }
+      return evals;
+    });
+  }
+
   // Computes the first |size| roots of unity for the entire domain.
   // e.g. for the domain [1, g, g², ..., gⁿ⁻¹}] and |size| = n / 2, it computes
   // [1, g, g², ..., g^{(n / 2) - 1}]
@@ -370,8 +390,9 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   //             | c₀ * ω⁰ + c₁ * ω³ + c₂ * ω⁶ + c₃ * ω⁹ |
   // Note that the coefficients are in order and evaluations are out of order(should be swapped after).
   // clang-format on
-  constexpr static void ButterflyFnInOut(F& lo, F& hi, const F& root) {
-    F neg = lo;
+  template <typename T = F>
+  constexpr static void ButterflyFnInOut(T& lo, T& hi, const T& root) {
+    T neg = lo;
     neg -= hi;
 
     lo += hi;
@@ -411,10 +432,11 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   //             | c₀ * ω⁰ + c₁ * ω³ + c₂ * ω⁶ + c₃ * ω⁹ |
   // Note that the coefficients are out of order the evaluations are in order(should be swapped before).
   // clang-format on
-  constexpr static void ButterflyFnOutIn(F& lo, F& hi, const F& root) {
+  template <typename T = F>
+  constexpr static void ButterflyFnOutIn(T& lo, T& hi, const T& root) {
     hi *= root;
 
-    F neg = lo;
+    T neg = lo;
     neg -= hi;
 
     lo += hi;
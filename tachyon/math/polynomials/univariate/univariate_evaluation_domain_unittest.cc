@@ -3,13 +3,18 @@
 // can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
 // file.
 
+#include <limits>
+#include <memory>
+
 #include "absl/types/span.h"
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/containers/contains.h"
 #include "tachyon/base/functional/function_ref.h"
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
 #include "tachyon/math/elliptic_curves/bn/bn384_small_two_adicity/fq.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
 #include "tachyon/math/polynomials/univariate/mixed_radix_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
 
@@ -318,4 +323,205 @@ TYPED_TEST(UnivariateEvaluationDomainTest, RootsOfUnity) {
   }
 }
 
+TYPED_TEST(UnivariateEvaluationDomainTest, TwiddleCache) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  if constexpr (std::is_same_v<F, bls12_381::Fr>) {
+    const size_t log_domain_size = 10;
+    const size_t domain_size = size_t{1} << log_domain_size;
+    DensePoly rand_poly = DensePoly::Random(domain_size - 1);
+
+    std::unique_ptr<Domain> expected_domain = Domain::Create(domain_size);
+    expected_domain->set_twiddle_cache_max_bytes(0);
+    Evals expected_evals = expected_domain->FFT(rand_poly);
+    EXPECT_TRUE(expected_domain->twiddle_cache_->forward.roots.empty());
+
+    const size_t roots_bytes = domain_size / 2 * sizeof(F);
+    for (size_t max_bytes : {roots_bytes, 2 * roots_bytes}) {
+      std::unique_ptr<Domain> domain = Domain::Create(domain_size);
+      domain->set_twiddle_cache_max_bytes(max_bytes);
+      for (size_t min_num_chunks_for_compaction : {size_t{1}, size_t{1} << 7}) {
+        domain->set_min_num_chunks_for_compaction(
+            min_num_chunks_for_compaction);
+        Evals evals = domain->FFT(rand_poly);
+        EXPECT_EQ(evals, expected_evals);
+        EXPECT_EQ(domain->IFFT(evals), rand_poly);
+      }
+      EXPECT_EQ(domain->twiddle_cache_->forward.roots.size(), domain_size / 2);
+      EXPECT_EQ(domain->twiddle_cache_->inverse.compacted_roots.empty(),
+                max_bytes < 2 * roots_bytes);
+
+      // The twiddle factors are shared with the cloned domains.
+      std::unique_ptr<UnivariateEvaluationDomain<F, Domain::kMaxDegree>>
+          coset = domain->GetCoset(
+              F::FromMontgomery(F::Config::kSubgroupGenerator));
+      EXPECT_EQ(static_cast<Domain*>(coset.get())->twiddle_cache_,
+                domain->twiddle_cache_);
+    }
+  } else {
+    GTEST_SKIP() << "Skip testing TwiddleCache on MixedRadixEvaluationDomain";
+  }
+}
+
+TYPED_TEST(UnivariateEvaluationDomainTest, FourStepFFT) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  if constexpr (std::is_same_v<F, bls12_381::Fr>) {
+    for (size_t log_domain_size = 2; log_domain_size < 8; ++log_domain_size) {
+      size_t domain_size = size_t{1} << log_domain_size;
+      DensePoly rand_poly = DensePoly::Random(domain_size - 1);
+
+      std::unique_ptr<Domain> expected_domain = Domain::Create(domain_size);
+      expected_domain->set_four_step_fft_threshold(
+          std::numeric_limits<size_t>::max());
+      Evals expected_evals = expected_domain->FFT(rand_poly);
+
+      for (size_t max_bytes :
+           {size_t{0}, Domain::kDefaultTwiddleCacheMaxBytes}) {
+        std::unique_ptr<Domain> domain = Domain::Create(domain_size);
+        domain->set_twiddle_cache_max_bytes(max_bytes);
+        domain->set_four_step_fft_threshold(domain_size);
+        Evals evals = domain->FFT(rand_poly);
+        EXPECT_EQ(evals, expected_evals);
+        EXPECT_EQ(domain->IFFT(evals), rand_poly);
+        // The transforms above reuse a single scratch buffer.
+        EXPECT_EQ(domain->scratch_buffers_->buffers.size(), size_t{1});
+
+        std::unique_ptr<UnivariateEvaluationDomain<F, Domain::kMaxDegree>>
+            coset = domain->GetCoset(
+                F::FromMontgomery(F::Config::kSubgroupGenerator));
+        Evals coset_evals = coset->FFT(rand_poly);
+        for (size_t i = 0; i < domain_size; ++i) {
+          EXPECT_EQ(*coset_evals[i], rand_poly.Evaluate(coset->GetElement(i)));
+        }
+        EXPECT_EQ(coset->IFFT(coset_evals), rand_poly);
+      }
+
+      // The packed butterflies are checked even if the CPU doesn't multiply
+      // |PackedPrimeField| with SIMD, in which case they loop over the lanes.
+      std::vector<F> roots = F::GetSuccessivePowers(
+          domain_size / 2, expected_domain->group_gen_);
+      std::vector<F> expected_values = rand_poly.coefficients().coefficients();
+      std::vector<F> values = expected_values;
+      Domain::SerialFFTInPlace(absl::MakeSpan(expected_values), roots,
+                               /*use_packed=*/false);
+      Domain::SerialFFTInPlace(absl::MakeSpan(values), roots,
+                               /*use_packed=*/true);
+      EXPECT_EQ(values, expected_values);
+      EXPECT_EQ(values, expected_evals.evaluations());
+    }
+  } else {
+    GTEST_SKIP() << "Skip testing FourStepFFT on MixedRadixEvaluationDomain";
+  }
+}
+
+TYPED_TEST(UnivariateEvaluationDomainTest, CosetFFTs) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  const size_t log_degree = 5;
+  const size_t degree = (size_t{1} << log_degree) - 1;
+  std::vector<DensePoly> polys = {
+      DensePoly::Random(degree),
+      DensePoly::Random(degree / 2),
+      DensePoly::Zero(),
+  };
+  std::vector<const DensePoly*> poly_ptrs =
+      base::Map(polys, [](const DensePoly& poly) { return &poly; });
+  F coset_factor = F::Random();
+  for (size_t log_domain_size = log_degree; log_domain_size < log_degree + 2;
+       ++log_domain_size) {
+    size_t domain_size = size_t{1} << log_domain_size;
+    this->TestDomains(domain_size, [domain_size, &polys, &poly_ptrs,
+                                    &coset_factor](const BaseDomain& d) {
+      std::vector<Evals> evals_vec =
+          d.CosetFFTs(absl::MakeConstSpan(poly_ptrs), coset_factor);
+      ASSERT_EQ(evals_vec.size(), polys.size());
+      for (size_t i = 0; i < polys.size(); ++i) {
+        ASSERT_EQ(evals_vec[i].NumElements(), domain_size);
+        for (size_t j = 0; j < domain_size; ++j) {
+          EXPECT_EQ(*evals_vec[i][j],
+                    polys[i].Evaluate(coset_factor * d.GetElement(j)));
+        }
+      }
+    });
+  }
+
+  if constexpr (std::is_same_v<F, bls12_381::Fr>) {
+    size_t domain_size = size_t{1} << log_degree;
+    std::unique_ptr<Domain> domain = Domain::Create(domain_size);
+    const BaseDomain* base_domain = domain.get();
+    std::vector<Evals> expected =
+        base_domain->CosetFFTs(absl::MakeConstSpan(poly_ptrs), coset_factor);
+    domain->set_four_step_fft_threshold(domain_size);
+    EXPECT_EQ(
+        base_domain->CosetFFTs(absl::MakeConstSpan(poly_ptrs), coset_factor),
+        expected);
+  }
+}
+
+// The Goldilocks prime field runs the NTT with |GoldilocksSimdKernels| if the
+// CPU supports them. The sizes cover both the stages whose twiddle factors
+// are powers of 2 and the ones which aren't, and the last radix-2 stage.
+TEST(Radix2EvaluationDomainTest, GoldilocksFFTCorrectness) {
+  using Domain = Radix2EvaluationDomain<Goldilocks>;
+  using BaseDomain = UnivariateEvaluationDomain<Goldilocks, Domain::kMaxDegree>;
+  using DensePoly = Domain::DensePoly;
+  using Evals = Domain::Evals;
+
+  Goldilocks::Init();
+  for (size_t log_domain_size : {1, 2, 3, 6, 7, 9}) {
+    size_t domain_size = size_t{1} << log_domain_size;
+    std::unique_ptr<BaseDomain> domain = Domain::Create(domain_size);
+    std::unique_ptr<BaseDomain> coset_domain = domain->GetCoset(
+        Goldilocks::FromMontgomery(Goldilocks::Config::kSubgroupGenerator));
+    for (const BaseDomain* d : {domain.get(), coset_domain.get()}) {
+      for (size_t degree : {domain_size - 1, domain_size / 16}) {
+        if (degree == 0) continue;
+        DensePoly poly = DensePoly::Random(degree);
+        Evals evals = d->FFT(poly);
+        for (size_t i = 0; i < domain_size; ++i) {
+          EXPECT_EQ(*evals[i], poly.Evaluate(d->GetElement(i)));
+        }
+        EXPECT_EQ(poly, d->IFFT(evals));
+      }
+    }
+  }
+}
+
+// From |Radix2EvaluationDomain::kDefaultFourStepFFTThreshold| on, the other
+// prime fields run the four-step FFT, while the Goldilocks prime field keeps
+// running the NTT with |GoldilocksSimdKernels|.
+TEST(Radix2EvaluationDomainTest, LargeGoldilocksFFT) {
+  using Domain = Radix2EvaluationDomain<Goldilocks>;
+  using DensePoly = Domain::DensePoly;
+  using Evals = Domain::Evals;
+
+  Goldilocks::Init();
+  if (internal::GetGoldilocksSimdKernels() == nullptr) {
+    GTEST_SKIP() << "The CPU doesn't support the kernels";
+  }
+
+  size_t domain_size = Domain::kDefaultFourStepFFTThreshold;
+  std::unique_ptr<Domain> domain = Domain::Create(domain_size);
+  ASSERT_EQ(domain->four_step_fft_threshold(), domain_size);
+  EXPECT_FALSE(domain->ShouldUseFourStepFFT());
+
+  DensePoly poly = DensePoly::Random(domain_size - 1);
+  Evals evals = domain->FFT(poly);
+  for (size_t i : {size_t{0}, size_t{1}, domain_size / 3, domain_size - 1}) {
+    EXPECT_EQ(*evals[i], poly.Evaluate(domain->GetElement(i)));
+  }
+  EXPECT_EQ(poly, domain->IFFT(evals));
+}
+
 }  // namespace tachyon::math
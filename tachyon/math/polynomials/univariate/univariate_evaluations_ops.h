@@ -12,6 +12,7 @@
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/math/finite_fields/packed_prime_field.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 
 namespace tachyon::math {
@@ -21,6 +22,7 @@ template <typename F, size_t MaxDegree>
 class UnivariateEvaluationsOp {
  public:
   using Poly = UnivariateEvaluations<F, MaxDegree>;
+  using PackedF = PackedPrimeField<F>;
 
   static Poly& AddInPlace(Poly& self, const Poly& other) {
     std::vector<F>& l_evaluations = self.evaluations_;
@@ -73,17 +75,28 @@ class UnivariateEvaluationsOp {
       l_evaluations.clear();
       return self;
     }
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
+    size_t size = r_evaluations.size();
+    if (!PackedF::IsSimdMulSupported()) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+        l_evaluations[i] *= r_evaluations[i];
+      }
+      return self;
+    }
+    size_t num_packs = size / PackedF::kLanes;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_packs; ++i) {
+      size_t idx = i * PackedF::kLanes;
+      PackedF packed = PackedF::Load(&l_evaluations[idx]);
+      packed *= PackedF::Load(&r_evaluations[idx]);
+      packed.Store(&l_evaluations[idx]);
+    }
+    for (size_t i = num_packs * PackedF::kLanes; i < size; ++i) {
       l_evaluations[i] *= r_evaluations[i];
     }
     return self;
   }
 
   static Poly& MulInPlace(Poly& self, const F& scalar) {
-    std::vector<F>& l_evaluations = self.evaluations_;
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < l_evaluations.size(); ++i) {
-      l_evaluations[i] *= scalar;
-    }
+    MulScalarInPlace(self.evaluations_, scalar);
     return self;
   }
 
@@ -104,12 +117,30 @@ class UnivariateEvaluationsOp {
 
   static Poly& DivInPlace(Poly& self, const F& scalar) {
     std::vector<F>& l_evaluations = self.evaluations_;
-    F scalar_inv = scalar.Inverse();
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < l_evaluations.size(); ++i) {
-      l_evaluations[i] *= scalar_inv;
-    }
+    MulScalarInPlace(l_evaluations, scalar.Inverse());
     return self;
   }
+
+ private:
+  static void MulScalarInPlace(std::vector<F>& evaluations, const F& scalar) {
+    if (!PackedF::IsSimdMulSupported()) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < evaluations.size(); ++i) {
+        evaluations[i] *= scalar;
+      }
+      return;
+    }
+    PackedF packed_scalar = PackedF::Broadcast(scalar);
+    size_t num_packs = evaluations.size() / PackedF::kLanes;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_packs; ++i) {
+      size_t idx = i * PackedF::kLanes;
+      PackedF packed = PackedF::Load(&evaluations[idx]);
+      packed *= packed_scalar;
+      packed.Store(&evaluations[idx]);
+    }
+    for (size_t i = num_packs * PackedF::kLanes; i < evaluations.size(); ++i) {
+      evaluations[i] *= scalar;
+    }
+  }
 };
 
 }  // namespace internal
@@ -0,0 +1,244 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_POLYNOMIAL_FAST_OPS_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_POLYNOMIAL_FAST_OPS_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/numeric/bits.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/threading/parallel_for.h"
+
+namespace tachyon::math::internal {
+
+// NOTE(chokobole): The thresholds are the power-of-2 sizes from which each
+// algorithm beats the one below it in univariate_polynomial_fast_ops_benchmark
+// with bn254 Fr on a single thread. Each operand has the given size there.
+//
+// The schoolbook multiplication is used if the shorter operand has fewer
+// coefficients than this. Karatsuba is 1.3x faster at 32 coefficients.
+constexpr size_t kKaratsubaMulThreshold = 32;
+// The NTT multiplication is used if both operands have at least this many
+// coefficients and the field has a root of unity of the required order. NTT
+// only breaks even with Karatsuba at 128 coefficients and is 2x faster at 256.
+constexpr size_t kNTTMulThreshold = 256;
+// The Newton iteration division is used if both the divisor and the quotient
+// have at least this many coefficients. The long division is still faster at
+// 256 coefficients, and the Newton iteration is 1.5x faster at 512.
+constexpr size_t kNewtonDivisionThreshold = 512;
+
+// |SupportsNTTMul<F>::value| is true if |F| is a prime field that may have the
+// 2-adic roots of unity.
+template <typename F, typename SFINAE = void>
+struct SupportsNTTMul : std::false_type {};
+
+template <typename F>
+struct SupportsNTTMul<F, std::enable_if_t<F::HasRootOfUnity()>>
+    : std::true_type {};
+
+// Adds |a| * |b| to |out| with the schoolbook multiplication. The size of
+// |out| must be at least |a.size()| + |b.size()| - 1.
+template <typename F>
+void SchoolbookMulAccumulate(absl::Span<const F> a, absl::Span<const F> b,
+                             absl::Span<F> out) {
+  for (size_t i = 0; i < b.size(); ++i) {
+    const F& r = b[i];
+    if (r.IsZero()) continue;
+    for (size_t j = 0; j < a.size(); ++j) {
+      out[i + j] += a[j] * r;
+    }
+  }
+}
+
+// Adds |a| * |b| to |out| with the Karatsuba multiplication. The size of
+// |out| must be at least |a.size()| + |b.size()| - 1.
+template <typename F>
+void KaratsubaMulAccumulate(absl::Span<const F> a, absl::Span<const F> b,
+                            absl::Span<F> out) {
+  if (a.size() < b.size()) std::swap(a, b);
+  if (b.empty()) return;
+  if (b.size() < kKaratsubaMulThreshold) {
+    SchoolbookMulAccumulate(a, b, out);
+    return;
+  }
+  // If the operands are unbalanced, the longer one is split into the chunks
+  // of the size of the shorter one.
+  if (a.size() > b.size()) {
+    for (size_t offset = 0; offset < a.size(); offset += b.size()) {
+      size_t len = std::min(b.size(), a.size() - offset);
+      KaratsubaMulAccumulate(a.subspan(offset, len), b, out.subspan(offset));
+    }
+    return;
+  }
+
+  // a = a₀ + xʰ * a₁, b = b₀ + xʰ * b₁
+  // a * b = z₀ + xʰ * (z₁ - z₀ - z₂) + x²ʰ * z₂, where
+  //   z₀ = a₀ * b₀, z₂ = a₁ * b₁, z₁ = (a₀ + a₁) * (b₀ + b₁)
+  size_t n = a.size();
+  size_t h = n / 2;
+  size_t h2 = n - h;
+  absl::Span<const F> a0 = a.subspan(0, h);
+  absl::Span<const F> a1 = a.subspan(h);
+  absl::Span<const F> b0 = b.subspan(0, h);
+  absl::Span<const F> b1 = b.subspan(h);
+
+  std::vector<F> z0 = base::CreateVector(2 * h - 1, F::Zero());
+  std::vector<F> z2 = base::CreateVector(2 * h2 - 1, F::Zero());
+  KaratsubaMulAccumulate(a0, b0, absl::MakeSpan(z0));
+  KaratsubaMulAccumulate(a1, b1, absl::MakeSpan(z2));
+
+  std::vector<F> a_sum(a1.begin(), a1.end());
+  std::vector<F> b_sum(b1.begin(), b1.end());
+  for (size_t i = 0; i < h; ++i) {
+    a_sum[i] += a0[i];
+    b_sum[i] += b0[i];
+  }
+  std::vector<F> z1 = base::CreateVector(2 * h2 - 1, F::Zero());
+  KaratsubaMulAccumulate(absl::MakeConstSpan(a_sum), absl::MakeConstSpan(b_sum),
+                         absl::MakeSpan(z1));
+  for (size_t i = 0; i < z0.size(); ++i) {
+    z1[i] -= z0[i];
+    out[i] += z0[i];
+  }
+  for (size_t i = 0; i < z2.size(); ++i) {
+    z1[i] -= z2[i];
+    out[2 * h + i] += z2[i];
+  }
+  for (size_t i = 0; i < z1.size(); ++i) {
+    out[h + i] += z1[i];
+  }
+}
+
+// Computes the NTT of |values| in place, whose size is a power of 2 and
+// |root| is a primitive root of unity of that order.
+template <typename F>
+void NTTInPlace(std::vector<F>& values, const F& root) {
+  size_t n = values.size();
+  uint32_t log_n = base::bits::Log2Ceiling(n);
+  for (size_t i = 0; i < n; ++i) {
+    size_t j = base::bits::BitRev(i) >> (sizeof(size_t) * 8 - log_n);
+    if (i < j) std::swap(values[i], values[j]);
+  }
+
+  // |twiddles[j]| = ωʲ for j in [0, n / 2)
+  std::vector<F> twiddles = F::GetSuccessivePowers(n / 2, root);
+  for (size_t len = 2; len <= n; len <<= 1) {
+    size_t half = len / 2;
+    size_t stride = n / len;
+    base::ParallelFor(0, n / 2, [&values, &twiddles, len, half,
+                                 stride](size_t k) {
+      size_t j = k % half;
+      size_t i = (k / half) * len + j;
+      F t = values[i + half] * twiddles[j * stride];
+      values[i + half] = values[i] - t;
+      values[i] += t;
+    });
+  }
+}
+
+// Returns |a| * |b| with the NTT multiplication or false if |F| doesn't have
+// a root of unity of the required order.
+template <typename F>
+bool NTTMul(absl::Span<const F> a, absl::Span<const F> b, std::vector<F>* ret) {
+  size_t size = a.size() + b.size() - 1;
+  size_t n = absl::bit_ceil(size);
+  F root;
+  if (!F::GetRootOfUnity(n, &root)) return false;
+
+  std::vector<F> a_evals = base::CreateVector(n, F::Zero());
+  std::vector<F> b_evals = base::CreateVector(n, F::Zero());
+  std::copy(a.begin(), a.end(), a_evals.begin());
+  std::copy(b.begin(), b.end(), b_evals.begin());
+  NTTInPlace(a_evals, root);
+  NTTInPlace(b_evals, root);
+  base::ParallelFor(0, n, [&a_evals, &b_evals](size_t i) {
+    a_evals[i] *= b_evals[i];
+  });
+  NTTInPlace(a_evals, root.Inverse());
+
+  F n_inv = F::FromBigInt(typename F::BigIntTy(n)).Inverse();
+  a_evals.resize(size);
+  base::ParallelFor(0, size,
+                    [&a_evals, &n_inv](size_t i) { a_evals[i] *= n_inv; });
+  *ret = std::move(a_evals);
+  return true;
+}
+
+// Returns |a| * |b|, choosing the algorithm by the sizes of the operands.
+template <typename F>
+std::vector<F> MulCoefficients(absl::Span<const F> a, absl::Span<const F> b) {
+  if (a.empty() || b.empty()) return {};
+  if constexpr (SupportsNTTMul<F>::value) {
+    if (std::min(a.size(), b.size()) >= kNTTMulThreshold) {
+      std::vector<F> ret;
+      if (NTTMul(a, b, &ret)) return ret;
+    }
+  }
+  std::vector<F> ret = base::CreateVector(a.size() + b.size() - 1, F::Zero());
+  KaratsubaMulAccumulate(a, b, absl::MakeSpan(ret));
+  return ret;
+}
+
+// Returns g such that |f| * g = 1 mod xⁿ with the Newton iteration
+//
+//   gᵢ₊₁ = gᵢ * (2 - |f| * gᵢ) mod x^{2ⁱ⁺¹}
+//
+// where |f[0]| must not be zero.
+template <typename F>
+std::vector<F> InversePowerSeries(absl::Span<const F> f, size_t n) {
+  std::vector<F> g = {f[0].Inverse()};
+  for (size_t len = 1; len < n;) {
+    len = std::min(2 * len, n);
+    // e = |f| * g mod xˡᵉⁿ
+    std::vector<F> e = MulCoefficients(f.subspan(0, std::min(len, f.size())),
+                                       absl::MakeConstSpan(g));
+    e.resize(len, F::Zero());
+    // e = 2 - e
+    for (F& coefficient : e) {
+      coefficient.NegInPlace();
+    }
+    e[0] += F::One().Double();
+    g = MulCoefficients(absl::MakeConstSpan(g), absl::MakeConstSpan(e));
+    g.resize(len);
+  }
+  return g;
+}
+
+// Computes the quotient and the remainder of |a| / |b| with the Newton
+// iteration, where the leading coefficient of |b| must not be zero and |a|
+// must not be shorter than |b|. Let m = deg(|b|) and k = deg(|a|) - m, then
+//
+//   rev(q) = rev(a) * rev(b)⁻¹ mod xᵏ⁺¹
+//   r = a - q * b
+//
+// where rev(p) = xᵈᵉᵍ⁽ᵖ⁾ * p(1 / x) reverses the coefficients of p.
+template <typename F>
+void NewtonDivide(absl::Span<const F> a, absl::Span<const F> b,
+                  std::vector<F>* quotient, std::vector<F>* remainder) {
+  size_t k = a.size() - b.size() + 1;
+  std::vector<F> rev_a(a.rbegin(), a.rbegin() + k);
+  std::vector<F> rev_b(b.rbegin(), b.rend());
+  std::vector<F> rev_b_inv = InversePowerSeries(absl::MakeConstSpan(rev_b), k);
+
+  std::vector<F> rev_q = MulCoefficients(absl::MakeConstSpan(rev_a),
+                                         absl::MakeConstSpan(rev_b_inv));
+  rev_q.resize(k);
+  *quotient = std::vector<F>(rev_q.rbegin(), rev_q.rend());
+
+  std::vector<F> qb = MulCoefficients(absl::MakeConstSpan(*quotient), b);
+  size_t r_size = b.size() - 1;
+  remainder->resize(r_size);
+  base::ParallelFor(0, r_size, [a, &qb, remainder](size_t i) {
+    (*remainder)[i] = a[i] - qb[i];
+  });
+}
+
+}  // namespace tachyon::math::internal
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_POLYNOMIAL_FAST_OPS_H_
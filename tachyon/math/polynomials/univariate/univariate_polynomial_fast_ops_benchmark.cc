@@ -0,0 +1,134 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial_fast_ops.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename F>
+std::vector<F> PrepareCoefficients(size_t size) {
+  return base::CreateVector(size, []() { return F::Random(); });
+}
+
+// The long division that |UnivariatePolynomialOp::Divide()| falls back to
+// below |internal::kNewtonDivisionThreshold|.
+template <typename F>
+void LongDivide(const std::vector<F>& a, const std::vector<F>& b,
+                std::vector<F>* quotient, std::vector<F>* remainder) {
+  size_t m = b.size() - 1;
+  *remainder = a;
+  *quotient = base::CreateVector(a.size() - m, F::Zero());
+  F leading_inv = b.back().Inverse();
+  for (size_t i = a.size() - 1; i >= m; --i) {
+    F q = (*remainder)[i] * leading_inv;
+    (*quotient)[i - m] = q;
+    for (size_t j = 0; j <= m; ++j) {
+      (*remainder)[i - m + j] -= q * b[j];
+    }
+    if (i == 0) break;
+  }
+  remainder->resize(m);
+}
+
+}  // namespace
+
+template <typename F>
+void BM_SchoolbookMul(benchmark::State& state) {
+  F::Init();
+  size_t size = state.range(0);
+  std::vector<F> a = PrepareCoefficients<F>(size);
+  std::vector<F> b = PrepareCoefficients<F>(size);
+  std::vector<F> ret;
+  for (auto _ : state) {
+    ret = base::CreateVector(2 * size - 1, F::Zero());
+    internal::SchoolbookMulAccumulate(absl::MakeConstSpan(a),
+                                      absl::MakeConstSpan(b),
+                                      absl::MakeSpan(ret));
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+template <typename F>
+void BM_KaratsubaMul(benchmark::State& state) {
+  F::Init();
+  size_t size = state.range(0);
+  std::vector<F> a = PrepareCoefficients<F>(size);
+  std::vector<F> b = PrepareCoefficients<F>(size);
+  std::vector<F> ret;
+  for (auto _ : state) {
+    ret = base::CreateVector(2 * size - 1, F::Zero());
+    internal::KaratsubaMulAccumulate(absl::MakeConstSpan(a),
+                                     absl::MakeConstSpan(b),
+                                     absl::MakeSpan(ret));
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+template <typename F>
+void BM_NTTMul(benchmark::State& state) {
+  F::Init();
+  size_t size = state.range(0);
+  std::vector<F> a = PrepareCoefficients<F>(size);
+  std::vector<F> b = PrepareCoefficients<F>(size);
+  std::vector<F> ret;
+  for (auto _ : state) {
+    CHECK(internal::NTTMul(absl::MakeConstSpan(a), absl::MakeConstSpan(b),
+                           &ret));
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+// Divides a polynomial of 2 * size - 1 coefficients by one of size
+// coefficients, so that the divisor and the quotient have the same size.
+template <typename F>
+void BM_LongDivide(benchmark::State& state) {
+  F::Init();
+  size_t size = state.range(0);
+  std::vector<F> a = PrepareCoefficients<F>(2 * size - 1);
+  std::vector<F> b = PrepareCoefficients<F>(size);
+  std::vector<F> quotient;
+  std::vector<F> remainder;
+  for (auto _ : state) {
+    LongDivide(a, b, &quotient, &remainder);
+  }
+  benchmark::DoNotOptimize(quotient);
+  benchmark::DoNotOptimize(remainder);
+}
+
+template <typename F>
+void BM_NewtonDivide(benchmark::State& state) {
+  F::Init();
+  size_t size = state.range(0);
+  std::vector<F> a = PrepareCoefficients<F>(2 * size - 1);
+  std::vector<F> b = PrepareCoefficients<F>(size);
+  std::vector<F> quotient;
+  std::vector<F> remainder;
+  for (auto _ : state) {
+    internal::NewtonDivide(absl::MakeConstSpan(a), absl::MakeConstSpan(b),
+                           &quotient, &remainder);
+  }
+  benchmark::DoNotOptimize(quotient);
+  benchmark::DoNotOptimize(remainder);
+}
+
+BENCHMARK_TEMPLATE(BM_SchoolbookMul, bn254::Fr)
+    ->RangeMultiplier(2)
+    ->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_KaratsubaMul, bn254::Fr)
+    ->RangeMultiplier(2)
+    ->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_NTTMul, bn254::Fr)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_LongDivide, bn254::Fr)
+    ->RangeMultiplier(2)
+    ->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_NewtonDivide, bn254::Fr)
+    ->RangeMultiplier(2)
+    ->Range(16, 1024);
+
+}  // namespace tachyon::math
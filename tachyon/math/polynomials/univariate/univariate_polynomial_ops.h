@@ -11,10 +11,13 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/math/base/arithmetics_results.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial_fast_ops.h"
 
 namespace tachyon::math {
 namespace internal {
@@ -169,20 +172,11 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
       return self;
     }
 
-    size_t degree = self.Degree();
-    size_t other_degree = other.Degree();
-    std::vector<F> coefficients =
-        base::CreateVector(degree + other_degree + 1, F::Zero());
-    for (size_t i = 0; i < r_coefficients.size(); ++i) {
-      const F& r = r_coefficients[i];
-      if (r.IsZero()) {
-        continue;
-      } else {
-        for (size_t j = 0; j < l_coefficients.size(); ++j) {
-          coefficients[i + j] += l_coefficients[j] * r;
-        }
-      }
-    }
+    // The schoolbook, Karatsuba or NTT multiplication is chosen by the sizes.
+    // See |MulCoefficients()|.
+    std::vector<F> coefficients = MulCoefficients(
+        absl::MakeConstSpan(l_coefficients.data(), self.Degree() + 1),
+        absl::MakeConstSpan(r_coefficients.data(), other.Degree() + 1));
 
     l_coefficients = std::move(coefficients);
     self.coefficients_.RemoveHighDegreeZeros();
@@ -309,32 +303,63 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
     } else if (self.Degree() < other.Degree()) {
       return {UnivariatePolynomial<D>::Zero(), self.ToDense()};
     }
+    size_t self_degree = self.Degree();
+    size_t other_degree = other.Degree();
+    if constexpr (std::is_same_v<DOrS, D>) {
+      if (other_degree + 1 >= kNewtonDivisionThreshold &&
+          self_degree - other_degree + 1 >= kNewtonDivisionThreshold) {
+        const std::vector<F>& l_coefficients = self.coefficients_.coefficients_;
+        const std::vector<F>& r_coefficients =
+            other.coefficients_.coefficients_;
+        std::vector<F> quotient;
+        std::vector<F> remainder;
+        NewtonDivide(
+            absl::MakeConstSpan(l_coefficients.data(), self_degree + 1),
+            absl::MakeConstSpan(r_coefficients.data(), other_degree + 1),
+            &quotient, &remainder);
+        D q(std::move(quotient));
+        q.RemoveHighDegreeZeros();
+        D r(std::move(remainder));
+        r.RemoveHighDegreeZeros();
+        return {UnivariatePolynomial<D>(std::move(q)),
+                UnivariatePolynomial<D>(std::move(r))};
+      }
+    }
+
     std::vector<F> quotient =
-        base::CreateVector(self.Degree() - other.Degree() + 1, F::Zero());
+        base::CreateVector(self_degree - other_degree + 1, F::Zero());
     UnivariatePolynomial<D> remainder = self.ToDense();
     std::vector<F>& r_coefficients = remainder.coefficients_.coefficients_;
+    r_coefficients.resize(self_degree + 1);
     F divisor_leading_inv = other.GetLeadingCoefficient()->Inverse();
 
-    while (!remainder.IsZero() && remainder.Degree() >= other.Degree()) {
-      F q_coeff =
-          remainder.coefficients_.coefficients_.back() * divisor_leading_inv;
-      size_t degree = remainder.Degree() - other.Degree();
-      quotient[degree] = q_coeff;
-
-      if constexpr (std::is_same_v<DOrS, D>) {
-        const std::vector<F>& d_terms = other.coefficients_.coefficients_;
-        for (size_t i = 0; i < d_terms.size(); ++i) {
-          r_coefficients[degree + i] -= q_coeff * d_terms[i];
-        }
-      } else {
-        const std::vector<Term>& d_terms = other.coefficients().terms_;
-        for (const Term& d_term : d_terms) {
-          r_coefficients[degree + d_term.degree] -=
-              q_coeff * d_term.coefficient;
+    // NOTE(chokobole): The remainder is trimmed once at the end instead of on
+    // every iteration, since the degree of the remainder decreases by one per
+    // iteration regardless of the zero coefficients.
+    for (size_t i = self_degree; i >= other_degree; --i) {
+      const F& r_coeff = r_coefficients[i];
+      if (!r_coeff.IsZero()) {
+        F q_coeff = r_coeff * divisor_leading_inv;
+        size_t degree = i - other_degree;
+        quotient[degree] = q_coeff;
+
+        if constexpr (std::is_same_v<DOrS, D>) {
+          const std::vector<F>& d_terms = other.coefficients_.coefficients_;
+          for (size_t j = 0; j <= other_degree; ++j) {
+            r_coefficients[degree + j] -= q_coeff * d_terms[j];
+          }
+        } else {
+          const std::vector<Term>& d_terms = other.coefficients().terms_;
+          for (const Term& d_term : d_terms) {
+            r_coefficients[degree + d_term.degree] -=
+                q_coeff * d_term.coefficient;
+          }
         }
       }
-      remainder.coefficients_.RemoveHighDegreeZeros();
+      if (i == 0) break;
     }
+    r_coefficients.resize(other_degree);
+    remainder.coefficients_.RemoveHighDegreeZeros();
     D d(std::move(quotient));
     d.RemoveHighDegreeZeros();
     return {UnivariatePolynomial<D>(std::move(d)), std::move(remainder)};
@@ -12,6 +12,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
 #include "tachyon/crypto/commitments/kzg/shplonk.h"
 #include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
@@ -42,6 +44,8 @@ class SHPlonkExtension final
   using Field = typename Base::Field;
   using Poly = typename Base::Poly;
   using Evals = typename Base::Evals;
+  using Accumulator =
+      typename crypto::SHPlonk<Curve, MaxDegree, Commitment>::Accumulator;
 
   SHPlonkExtension() = default;
   explicit SHPlonkExtension(
@@ -63,6 +67,23 @@ class SHPlonkExtension final
     return shplonk_.GetBatchCommitments();
   }
 
+  template <typename Container>
+  [[nodiscard]] bool ComputeAccumulator(
+      const Container& poly_openings,
+      crypto::TranscriptReader<Commitment>* reader,
+      Accumulator* accumulator) const {
+    return shplonk_.ComputeAccumulator(poly_openings, reader, accumulator);
+  }
+
+  [[nodiscard]] bool VerifyAccumulator(const Accumulator& accumulator) const {
+    return shplonk_.VerifyAccumulator(accumulator);
+  }
+
+  [[nodiscard]] bool VerifyAccumulators(
+      absl::Span<const Accumulator> accumulators) const {
+    return shplonk_.VerifyAccumulators(accumulators);
+  }
+
   [[nodiscard]] bool DoUnsafeSetup(size_t size) {
     return shplonk_.DoUnsafeSetup(size);
   }
@@ -104,6 +125,12 @@ class SHPlonkExtension final
     return shplonk_.DoCommitLagrange(evals, state, index);
   }
 
+  [[nodiscard]] bool DoBatchCommitLagrange(
+      const std::vector<Evals>& evals_list, crypto::BatchCommitmentState& state,
+      size_t start_index) {
+    return shplonk_.DoBatchCommitLagrange(evals_list, state, start_index);
+  }
+
   template <typename ScalarContainer>
   [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
                                       Commitment* out) const {
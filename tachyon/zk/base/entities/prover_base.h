@@ -109,6 +109,16 @@ class ProverBase : public Entity<PCS> {
     CHECK(this->pcs_.CommitLagrange(evals, index));
   }
 
+  // Commits to every evaluations in |evals_list| at once and stores the
+  // commitments starting at |start_index|.
+  template <typename T = PCS,
+            std::enable_if_t<crypto::VectorCommitmentSchemeTraits<
+                T>::kSupportsBatchMode>* = nullptr>
+  void BatchCommitEvalsAt(const std::vector<Evals>& evals_list,
+                          size_t start_index) {
+    CHECK(this->pcs_.BatchCommitLagrange(evals_list, start_index));
+  }
+
   void CommitAndWriteToTranscript(const Evals& evals) {
     Commitment commitment = Commit(evals);
     CHECK(GetWriter()->WriteToTranscript(commitment));
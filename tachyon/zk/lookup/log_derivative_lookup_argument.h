@@ -0,0 +1,178 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/lookup/lookup_argument.h"
+
+namespace tachyon::zk {
+
+// |LogDerivativeLookupArgument| proves that the inputs of |lookups()| are in
+// the table they share. Let fᵢ(X) be the compressed input of the i-th lookup,
+// t(X) the compressed table and m(X) the number of times t(X) is looked up.
+// The lookups are split into chunks to bound the degree of the constraints,
+// and the k-th chunk cₖ has its own grand sum φₖ(X), which is constrained as
+// below on the usable rows, where φₖ(X) is 0 at the first row:
+//
+// φ₀(ωX) - φ₀(X) = Σᵢ∈c₀ 1 / (fᵢ(X) + β) - m(X) / (t(X) + β)
+// φₖ(ωX) - φₖ(X) = Σᵢ∈cₖ 1 / (fᵢ(X) + β) for k > 0
+//
+// Then Σₖ φₖ(X) is 0 at the last row, since every input is in the table.
+template <typename F>
+class LogDerivativeLookupArgument {
+ public:
+  using Chunk = std::vector<const LookupArgument<F>*>;
+
+  LogDerivativeLookupArgument() = default;
+  explicit LogDerivativeLookupArgument(std::vector<Chunk> chunks)
+      : chunks_(std::move(chunks)) {}
+
+  // Groups |lookups| by their table expressions, so that the lookups against
+  // the same table share a single multiplicity column. The groups are ordered
+  // by their first lookups. The lookups of a group are split into chunks in
+  // order, so that the degree of the constraint of each chunk doesn't exceed
+  // |max_degree|. A chunk has at least one lookup, so the degree of a chunk
+  // with a single lookup may still exceed it. The returned arguments refer to
+  // |lookups|, so they must not outlive it.
+  static std::vector<LogDerivativeLookupArgument> Group(
+      const std::vector<LookupArgument<F>>& lookups, size_t max_degree) {
+    std::vector<LogDerivativeLookupArgument> ret;
+    for (const LookupArgument<F>& lookup : lookups) {
+      auto it = std::find_if(ret.begin(), ret.end(),
+                             [&lookup](const LogDerivativeLookupArgument& arg) {
+                               return arg.HasTable(lookup);
+                             });
+      if (it == ret.end()) {
+        ret.push_back(LogDerivativeLookupArgument({{&lookup}}));
+        continue;
+      }
+      Chunk& chunk = it->chunks_.back();
+      if (it->ComputeChunkDegree(it->chunks_.size() - 1) +
+              ComputeMaxDegree(lookup.input_expressions()) <=
+          max_degree) {
+        chunk.push_back(&lookup);
+      } else {
+        it->chunks_.push_back({&lookup});
+      }
+    }
+    return ret;
+  }
+
+  const std::vector<Chunk>& chunks() const { return chunks_; }
+  size_t num_chunks() const { return chunks_.size(); }
+
+  // Returns the lookups of all the chunks in order.
+  std::vector<const LookupArgument<F>*> lookups() const {
+    std::vector<const LookupArgument<F>*> ret;
+    for (const Chunk& chunk : chunks_) {
+      ret.insert(ret.end(), chunk.begin(), chunk.end());
+    }
+    return ret;
+  }
+
+  const std::vector<std::unique_ptr<Expression<F>>>& table_expressions()
+      const {
+    CHECK(!chunks_.empty());
+    return chunks_[0][0]->table_expressions();
+  }
+
+  // Returns the maximum degree of the constraints of the chunks.
+  size_t RequiredDegree() const {
+    size_t degree = 0;
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      degree = std::max(degree, ComputeChunkDegree(i));
+    }
+    return degree;
+  }
+
+  // Returns the degree of the constraint of the |chunk_index|-th chunk below,
+  // where the terms of t(X) are only in the first chunk.
+  //
+  // (1 - (l_last(X) + l_blind(X))) * (
+  //   (φₖ(ωX) - φₖ(X)) * Πᵢ(fᵢ(X) + β) * (t(X) + β) -
+  //   Σᵢ Πⱼ≠ᵢ(fⱼ(X) + β) * (t(X) + β) + m(X) * Πᵢ(fᵢ(X) + β))
+  size_t ComputeChunkDegree(size_t chunk_index) const {
+    size_t degree = 2;
+    if (chunk_index == 0) degree += ComputeMaxDegree(table_expressions());
+    for (const LookupArgument<F>* lookup : chunks_[chunk_index]) {
+      degree += ComputeMaxDegree(lookup->input_expressions());
+    }
+    return degree;
+  }
+
+  // Returns the least degree that a chunk with a single lookup of |lookups|
+  // needs, which is the least degree that |Group()| can keep every chunk
+  // within.
+  static size_t ComputeMinRequiredDegree(
+      const std::vector<LookupArgument<F>>& lookups) {
+    size_t degree = 0;
+    for (const LookupArgument<F>& lookup : lookups) {
+      degree = std::max(degree,
+                        2 + ComputeMaxDegree(lookup.table_expressions()) +
+                            ComputeMaxDegree(lookup.input_expressions()));
+    }
+    return degree;
+  }
+
+ private:
+  static size_t ComputeMaxDegree(
+      const std::vector<std::unique_ptr<Expression<F>>>& expressions) {
+    size_t degree = 1;
+    for (const std::unique_ptr<Expression<F>>& expression : expressions) {
+      degree = std::max(degree, expression->Degree());
+    }
+    return degree;
+  }
+
+  bool HasTable(const LookupArgument<F>& lookup) const {
+    const std::vector<std::unique_ptr<Expression<F>>>& table =
+        table_expressions();
+    const std::vector<std::unique_ptr<Expression<F>>>& other =
+        lookup.table_expressions();
+    if (table.size() != other.size()) return false;
+    for (size_t i = 0; i < table.size(); ++i) {
+      if (*table[i] != *other[i]) return false;
+    }
+    return true;
+  }
+
+  // not owned
+  std::vector<Chunk> chunks_;
+};
+
+// Returns the value of the constraint of a chunk of
+// |LogDerivativeLookupArgument| without the selector of the usable rows, where
+// |inputs_plus_beta| are fᵢ(X) + β of the chunk and |table_plus_beta| is
+// t(X) + β. For the chunks after the first one, |table_plus_beta| is 1 and
+// |multiplicity| is 0.
+//
+// (φₖ(ωX) - φₖ(X)) * Πᵢ(fᵢ(X) + β) * (t(X) + β) -
+// Σᵢ Πⱼ≠ᵢ(fⱼ(X) + β) * (t(X) + β) + m(X) * Πᵢ(fᵢ(X) + β)
+template <typename F>
+F ComputeGrandSumConstraint(absl::Span<const F> inputs_plus_beta,
+                            const F& table_plus_beta, const F& multiplicity,
+                            const F& grand_sum, const F& grand_sum_next) {
+  // After the i-th iteration, |product| is Πⱼ≤ᵢ(fⱼ(X) + β) and |sum| is
+  // Σₖ≤ᵢ Πⱼ≤ᵢ,ⱼ≠ₖ(fⱼ(X) + β).
+  F product = F::One();
+  F sum = F::Zero();
+  for (const F& input_plus_beta : inputs_plus_beta) {
+    sum *= input_plus_beta;
+    sum += product;
+    product *= input_plus_beta;
+  }
+  return (grand_sum_next - grand_sum) * product * table_plus_beta -
+         sum * table_plus_beta + multiplicity * product;
+}
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_H_
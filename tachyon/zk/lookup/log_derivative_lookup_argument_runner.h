@@ -0,0 +1,78 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_H_
+
+#include <vector>
+
+#include "gtest/gtest_prod.h"
+
+#include "tachyon/crypto/commitments/polynomial_openings.h"
+#include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/base/point_set.h"
+#include "tachyon/zk/expressions/evaluator/simple_evaluator.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_argument.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_committed.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_evaluated.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_prepared.h"
+
+namespace tachyon::zk {
+
+// |LogDerivativeLookupArgumentRunner| proves a |LogDerivativeLookupArgument|
+// in the same steps as |LookupArgumentRunner| does for a |LookupArgument|:
+// 1. |PrepareArgument()| commits the multiplicities m(X) of the table instead
+//    of the permuted input A'(X) and the permuted table S'(X).
+// 2. |CommitPrepared()| commits the grand sum φₖ(X) of each chunk instead of
+//    the grand product z(X).
+template <typename Poly, typename Evals>
+class LogDerivativeLookupArgumentRunner {
+ public:
+  LogDerivativeLookupArgumentRunner() = delete;
+
+  template <typename PCS, typename F>
+  static LogDerivativeLookupPrepared<Poly, Evals> PrepareArgument(
+      ProverBase<PCS>* prover, const LogDerivativeLookupArgument<F>& argument,
+      const F& theta, const SimpleEvaluator<Evals>& evaluator_tpl);
+
+  template <typename PCS, typename F>
+  static LogDerivativeLookupCommitted<Poly> CommitPrepared(
+      ProverBase<PCS>* prover,
+      LogDerivativeLookupPrepared<Poly, Evals>&& prepared, const F& beta);
+
+  template <typename PCS, typename F>
+  static LogDerivativeLookupEvaluated<Poly> EvaluateCommitted(
+      ProverBase<PCS>* prover, LogDerivativeLookupCommitted<Poly>&& committed,
+      const F& x);
+
+  template <typename PCS, typename F>
+  static std::vector<crypto::PolynomialOpening<Poly>> OpenEvaluated(
+      const ProverBase<PCS>* prover,
+      const LogDerivativeLookupEvaluated<Poly>& evaluated, const F& x,
+      PointSet<F>& points);
+
+ private:
+  FRIEND_TEST(LogDerivativeLookupArgumentRunnerTest, ComputeMultiplicities);
+  FRIEND_TEST(LogDerivativeLookupArgumentRunnerTest,
+              ComputeMultiplicitiesWithInputNotInTable);
+  FRIEND_TEST(LogDerivativeLookupArgumentRunnerTest, ComputeGrandSums);
+
+  // Counts how many times each row of |table| is looked up by |inputs| on the
+  // usable rows. A value that appears more than once in |table| is counted at
+  // its first row. Returns false if a value of |inputs| is not in |table|.
+  template <typename PCS>
+  [[nodiscard]] static bool ComputeMultiplicities(
+      const ProverBase<PCS>* prover, const std::vector<Evals>& inputs,
+      const Evals& table, Evals* multiplicities);
+
+  // Returns the unblinded φₖ(X) of each chunk cₖ, where φₖ(1) = 0 and
+  // φ₀(ωⁱ⁺¹) = φ₀(ωⁱ) + Σⱼ∈c₀ 1 / (fⱼ(ωⁱ) + β) - m(ωⁱ) / (t(ωⁱ) + β),
+  // φₖ(ωⁱ⁺¹) = φₖ(ωⁱ) + Σⱼ∈cₖ 1 / (fⱼ(ωⁱ) + β) for k > 0.
+  template <typename PCS, typename F>
+  static std::vector<Evals> ComputeGrandSums(
+      const ProverBase<PCS>* prover,
+      const LogDerivativeLookupPrepared<Poly, Evals>& prepared, const F& beta);
+};
+
+}  // namespace tachyon::zk
+
+#include "tachyon/zk/lookup/log_derivative_lookup_argument_runner_impl.h"
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_H_
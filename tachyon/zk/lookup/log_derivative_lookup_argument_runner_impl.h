@@ -0,0 +1,241 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_IMPL_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_IMPL_H_
+
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/ref.h"
+#include "tachyon/base/threading/parallel_for.h"
+#include "tachyon/zk/lookup/compress_expression.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_argument_runner.h"
+#include "tachyon/zk/plonk/constraint_system/rotation.h"
+
+namespace tachyon::zk {
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+LogDerivativeLookupPrepared<Poly, Evals>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::PrepareArgument(
+    ProverBase<PCS>* prover, const LogDerivativeLookupArgument<F>& argument,
+    const F& theta, const SimpleEvaluator<Evals>& evaluator_tpl) {
+  // fᵢ(X) = θᵐ⁻¹Aᵢ,₀(X) + θᵐ⁻²Aᵢ,₁(X) + ... + θAᵢ,ₘ₋₂(X) + Aᵢ,ₘ₋₁(X)
+  std::vector<Evals> flat_compressed_inputs = base::Map(
+      argument.lookups(),
+      [prover, &theta, &evaluator_tpl](const LookupArgument<F>* lookup) {
+        return CompressExpressions(prover->domain(),
+                                   lookup->input_expressions(), theta,
+                                   evaluator_tpl);
+      });
+
+  // t(X) = θᵐ⁻¹S₀(X) + θᵐ⁻²S₁(X) + ... + θSₘ₋₂(X) + Sₘ₋₁(X)
+  Evals compressed_table = CompressExpressions(
+      prover->domain(), argument.table_expressions(), theta, evaluator_tpl);
+
+  // m(X)
+  Evals multiplicities;
+  CHECK(ComputeMultiplicities(prover, flat_compressed_inputs, compressed_table,
+                              &multiplicities));
+  CHECK(prover->blinder().Blind(multiplicities, /*include_last_row=*/true));
+
+  // Commit(m(X))
+  BlindedPolynomial<Poly> multiplicity_poly =
+      prover->CommitAndWriteToProofWithBlind(multiplicities);
+
+  std::vector<std::vector<Evals>> compressed_inputs;
+  compressed_inputs.reserve(argument.num_chunks());
+  auto it = std::make_move_iterator(flat_compressed_inputs.begin());
+  for (const typename LogDerivativeLookupArgument<F>::Chunk& chunk :
+       argument.chunks()) {
+    compressed_inputs.emplace_back(it, it + chunk.size());
+    it += chunk.size();
+  }
+
+  return {std::move(compressed_inputs), std::move(compressed_table),
+          std::move(multiplicities), std::move(multiplicity_poly)};
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+LogDerivativeLookupCommitted<Poly>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::CommitPrepared(
+    ProverBase<PCS>* prover,
+    LogDerivativeLookupPrepared<Poly, Evals>&& prepared, const F& beta) {
+  // φₖ(X)
+  std::vector<Evals> grand_sums = ComputeGrandSums(prover, prepared, beta);
+
+  // Commit(φₖ(X))
+  std::vector<BlindedPolynomial<Poly>> grand_sum_polys =
+      base::Map(grand_sums, [prover](Evals& grand_sum) {
+        CHECK(prover->blinder().Blind(grand_sum));
+        return prover->CommitAndWriteToProofWithBlind(grand_sum);
+      });
+
+  return {std::move(prepared).TakeMultiplicityPoly(),
+          std::move(grand_sum_polys)};
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+LogDerivativeLookupEvaluated<Poly>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::EvaluateCommitted(
+    ProverBase<PCS>* prover, LogDerivativeLookupCommitted<Poly>&& committed,
+    const F& x) {
+  F x_next = Rotation::Next().RotateOmega(prover->domain(), x);
+
+  BlindedPolynomial<Poly> multiplicity_poly =
+      std::move(committed).TakeMultiplicityPoly();
+  std::vector<BlindedPolynomial<Poly>> grand_sum_polys =
+      std::move(committed).TakeGrandSumPolys();
+
+  for (const BlindedPolynomial<Poly>& grand_sum_poly : grand_sum_polys) {
+    prover->EvaluateAndWriteToProof(grand_sum_poly.poly(), x);
+    prover->EvaluateAndWriteToProof(grand_sum_poly.poly(), x_next);
+  }
+  prover->EvaluateAndWriteToProof(multiplicity_poly.poly(), x);
+
+  return {std::move(multiplicity_poly), std::move(grand_sum_polys)};
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+std::vector<crypto::PolynomialOpening<Poly>>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::OpenEvaluated(
+    const ProverBase<PCS>* prover,
+    const LogDerivativeLookupEvaluated<Poly>& evaluated, const F& x,
+    PointSet<F>& points) {
+  F x_next = Rotation::Next().RotateOmega(prover->domain(), x);
+  base::DeepRef<const F> x_ref(&x);
+  base::DeepRef<const F> x_next_ref = points.Insert(x_next);
+
+  const std::vector<BlindedPolynomial<Poly>>& grand_sum_polys =
+      evaluated.grand_sum_polys();
+  std::vector<crypto::PolynomialOpening<Poly>> openings;
+  openings.reserve(2 * grand_sum_polys.size() + 1);
+  for (const BlindedPolynomial<Poly>& grand_sum_poly : grand_sum_polys) {
+    openings.emplace_back(base::DeepRef<const Poly>(&grand_sum_poly.poly()),
+                          x_ref, grand_sum_poly.poly().Evaluate(x));
+  }
+  openings.emplace_back(
+      base::DeepRef<const Poly>(&evaluated.multiplicity_poly().poly()), x_ref,
+      evaluated.multiplicity_poly().poly().Evaluate(x));
+  for (const BlindedPolynomial<Poly>& grand_sum_poly : grand_sum_polys) {
+    openings.emplace_back(base::DeepRef<const Poly>(&grand_sum_poly.poly()),
+                          x_next_ref, grand_sum_poly.poly().Evaluate(x_next));
+  }
+  return openings;
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS>
+bool LogDerivativeLookupArgumentRunner<Poly, Evals>::ComputeMultiplicities(
+    const ProverBase<PCS>* prover, const std::vector<Evals>& inputs,
+    const Evals& table, Evals* multiplicities) {
+  using F = typename Evals::Field;
+
+  constexpr RowIndex kNotFound = std::numeric_limits<RowIndex>::max();
+
+  size_t domain_size = prover->domain()->size();
+  RowIndex usable_rows = prover->GetUsableRows();
+
+  // a map of each unique element in the table expression and its first row
+  absl::flat_hash_map<F, RowIndex> table_rows;
+  table_rows.reserve(usable_rows);
+  for (RowIndex row = 0; row < usable_rows; ++row) {
+    table_rows.try_emplace(*table[row], row);
+  }
+
+  std::vector<RowIndex> counts(usable_rows, 0);
+  std::vector<RowIndex> input_rows(usable_rows);
+  for (const Evals& input : inputs) {
+    // NOTE(chokobole): The rows are looked up in parallel, but they are
+    // counted serially, since many rows of the input can hit the same row of
+    // the table.
+    base::ParallelFor(0, usable_rows, [&input, &table_rows,
+                                       &input_rows](size_t row) {
+      auto it = table_rows.find(*input[row]);
+      input_rows[row] = it == table_rows.end() ? kNotFound : it->second;
+    });
+    for (RowIndex row = 0; row < usable_rows; ++row) {
+      if (input_rows[row] == kNotFound) {
+        LOG(ERROR) << "input(" << input[row]->ToString()
+                   << ") is not found in table";
+        return false;
+      }
+      ++counts[input_rows[row]];
+    }
+  }
+
+  std::vector<F> values = base::CreateVector(domain_size, F::Zero());
+  base::ParallelFor(0, usable_rows, [&values, &counts](size_t row) {
+    values[row] = F(counts[row]);
+  });
+  *multiplicities = Evals(std::move(values));
+  return true;
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+std::vector<Evals> LogDerivativeLookupArgumentRunner<Poly, Evals>::
+    ComputeGrandSums(const ProverBase<PCS>* prover,
+                     const LogDerivativeLookupPrepared<Poly, Evals>& prepared,
+                     const F& beta) {
+  size_t domain_size = prover->domain()->size();
+  RowIndex usable_rows = prover->GetUsableRows();
+  const Evals& table = prepared.compressed_table();
+  const Evals& multiplicities = prepared.multiplicities();
+
+  // - m(ωⁱ) / (t(ωⁱ) + β), which only the first chunk has.
+  std::vector<F> table_terms(usable_rows);
+  base::ParallelFor(0, usable_rows, [&table, &beta, &table_terms](size_t row) {
+    table_terms[row] = *table[row] + beta;
+  });
+  CHECK(F::BatchInverseInPlace(table_terms));
+  base::ParallelFor(0, usable_rows,
+                    [&multiplicities, &table_terms](size_t row) {
+                      table_terms[row] *= -*multiplicities[row];
+                    });
+
+  std::vector<Evals> ret;
+  ret.reserve(prepared.compressed_inputs().size());
+  std::vector<F> inverses(usable_rows);
+  for (const std::vector<Evals>& chunk : prepared.compressed_inputs()) {
+    std::vector<F> terms = ret.empty()
+                               ? std::move(table_terms)
+                               : base::CreateVector(usable_rows, F::Zero());
+
+    // + Σⱼ∈cₖ 1 / (fⱼ(ωⁱ) + β)
+    for (const Evals& input : chunk) {
+      base::ParallelFor(0, usable_rows, [&input, &beta, &inverses](size_t row) {
+        inverses[row] = *input[row] + beta;
+      });
+      CHECK(F::BatchInverseInPlace(inverses));
+      base::ParallelFor(0, usable_rows, [&terms, &inverses](size_t row) {
+        terms[row] += inverses[row];
+      });
+    }
+
+    std::vector<F> grand_sum = base::CreateVector(domain_size, F::Zero());
+    for (RowIndex row = 0; row < usable_rows; ++row) {
+      grand_sum[row + 1] = grand_sum[row] + terms[row];
+    }
+    ret.push_back(Evals(std::move(grand_sum)));
+  }
+#if DCHECK_IS_ON()
+  // Every input is in the table, so the sum of all the terms is zero.
+  F last = F::Zero();
+  for (const Evals& grand_sum : ret) {
+    last += *grand_sum[usable_rows];
+  }
+  DCHECK(last.IsZero());
+#endif
+  return ret;
+}
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_IMPL_H_
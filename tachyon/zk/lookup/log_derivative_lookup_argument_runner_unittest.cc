@@ -0,0 +1,125 @@
+#include "tachyon/zk/lookup/log_derivative_lookup_argument_runner.h"
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/zk/lookup/test/compress_expression_test_setting.h"
+
+namespace tachyon::zk {
+
+class LogDerivativeLookupArgumentRunnerTest
+    : public CompressExpressionTestSetting {
+ public:
+  using Runner = LogDerivativeLookupArgumentRunner<Poly, Evals>;
+
+  void SetUp() override {
+    CompressExpressionTestSetting::SetUp();
+    prover_->blinder().set_blinding_factors(5);
+
+    n_ = prover_->pcs().N();
+    usable_rows_ = prover_->GetUsableRows();
+    // t = [1, 2, ..., |usable_rows_| - 1, 1, 0, ..., 0]
+    table_ = CreateColumn(
+        [this](RowIndex row) { return F(row % (usable_rows_ - 1) + 1); });
+  }
+
+ protected:
+  // Returns a column whose usable rows are |callback(row)| and the others
+  // are zero.
+  template <typename Callable>
+  Evals CreateColumn(Callable callback) const {
+    std::vector<F> values = base::CreateVector(n_, F::Zero());
+    for (RowIndex row = 0; row < usable_rows_; ++row) {
+      values[row] = callback(row);
+    }
+    return Evals(std::move(values));
+  }
+
+  size_t n_ = 0;
+  RowIndex usable_rows_ = 0;
+  Evals table_;
+};
+
+TEST_F(LogDerivativeLookupArgumentRunnerTest, ComputeMultiplicities) {
+  std::vector<Evals> inputs;
+  // f₀ = [1, 2, 3, 1, 2, 3, ...]
+  inputs.push_back(CreateColumn([](RowIndex row) { return F(row % 3 + 1); }));
+  // f₁ = [1, 1, 1, ...]
+  inputs.push_back(CreateColumn([](RowIndex row) { return F::One(); }));
+
+  Evals multiplicities;
+  ASSERT_TRUE(Runner::ComputeMultiplicities(prover_.get(), inputs, table_,
+                                            &multiplicities));
+
+  std::vector<RowIndex> expected(n_, 0);
+  for (RowIndex row = 0; row < usable_rows_; ++row) {
+    ++expected[row % 3];
+    ++expected[0];
+  }
+  for (size_t row = 0; row < n_; ++row) {
+    EXPECT_EQ(*multiplicities[row], F(expected[row]));
+  }
+}
+
+TEST_F(LogDerivativeLookupArgumentRunnerTest,
+       ComputeMultiplicitiesWithInputNotInTable) {
+  std::vector<Evals> inputs;
+  inputs.push_back(CreateColumn([this](RowIndex row) {
+    return row == usable_rows_ - 1 ? F(usable_rows_ + 1) : F(row + 1);
+  }));
+
+  Evals multiplicities;
+  EXPECT_FALSE(Runner::ComputeMultiplicities(prover_.get(), inputs, table_,
+                                             &multiplicities));
+}
+
+TEST_F(LogDerivativeLookupArgumentRunnerTest, ComputeGrandSums) {
+  const F beta = F::Random();
+
+  std::vector<Evals> inputs;
+  inputs.push_back(CreateColumn([](RowIndex row) { return F(row % 5 + 1); }));
+  inputs.push_back(CreateColumn([](RowIndex row) { return F(row / 2 + 1); }));
+  inputs.push_back(CreateColumn([](RowIndex row) { return F(3); }));
+
+  Evals multiplicities;
+  ASSERT_TRUE(Runner::ComputeMultiplicities(prover_.get(), inputs, table_,
+                                            &multiplicities));
+  std::vector<std::vector<Evals>> chunks(2);
+  chunks[0].push_back(std::move(inputs[0]));
+  chunks[0].push_back(std::move(inputs[1]));
+  chunks[1].push_back(std::move(inputs[2]));
+  LogDerivativeLookupPrepared<Poly, Evals> prepared(
+      std::move(chunks), std::move(table_), std::move(multiplicities),
+      BlindedPolynomial<Poly>());
+
+  std::vector<Evals> grand_sums =
+      Runner::ComputeGrandSums(prover_.get(), prepared, beta);
+  ASSERT_EQ(grand_sums.size(), 2);
+
+  F last = F::Zero();
+  for (size_t k = 0; k < grand_sums.size(); ++k) {
+    const Evals& grand_sum = grand_sums[k];
+    EXPECT_TRUE(grand_sum[0]->IsZero());
+    last += *grand_sum[usable_rows_];
+    for (RowIndex row = 0; row < usable_rows_; ++row) {
+      std::vector<F> inputs_plus_beta = base::Map(
+          prepared.compressed_inputs()[k],
+          [row, &beta](const Evals& input) { return *input[row] + beta; });
+      F table_plus_beta =
+          k == 0 ? *prepared.compressed_table()[row] + beta : F::One();
+      F multiplicity = k == 0 ? *prepared.multiplicities()[row] : F::Zero();
+      EXPECT_TRUE(ComputeGrandSumConstraint<F>(
+                      inputs_plus_beta, table_plus_beta, multiplicity,
+                      *grand_sum[row], *grand_sum[row + 1])
+                      .IsZero());
+    }
+  }
+  // Neither of the chunks sums up to zero on its own, but they do together.
+  EXPECT_FALSE(grand_sums[1][usable_rows_]->IsZero());
+  EXPECT_TRUE(last.IsZero());
+}
+
+}  // namespace tachyon::zk
@@ -0,0 +1,126 @@
+#include "tachyon/zk/lookup/log_derivative_lookup_argument.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/finite_fields/test/gf7.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+using GF7 = math::GF7;
+using Expr = std::unique_ptr<Expression<GF7>>;
+
+class LogDerivativeLookupArgumentTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { GF7::Init(); }
+
+  static Expr Advice(size_t column_index) {
+    return ExpressionFactory<GF7>::Advice(
+        AdviceQuery(0, Rotation::Cur(), AdviceColumnKey(column_index)));
+  }
+
+  static Expr Fixed(size_t column_index) {
+    return ExpressionFactory<GF7>::Fixed(
+        FixedQuery(0, Rotation::Cur(), FixedColumnKey(column_index)));
+  }
+
+  static LookupArgument<GF7> CreateLookup(Expr input, Expr table) {
+    std::vector<Expr> input_expressions;
+    input_expressions.push_back(std::move(input));
+    std::vector<Expr> table_expressions;
+    table_expressions.push_back(std::move(table));
+    return LookupArgument<GF7>("lookup", std::move(input_expressions),
+                               std::move(table_expressions));
+  }
+};
+
+}  // namespace
+
+TEST_F(LogDerivativeLookupArgumentTest, Group) {
+  std::vector<LookupArgument<GF7>> lookups;
+  lookups.push_back(CreateLookup(Advice(0), Fixed(0)));
+  lookups.push_back(CreateLookup(Advice(1), Fixed(1)));
+  lookups.push_back(CreateLookup(Advice(2), Fixed(0)));
+  lookups.push_back(CreateLookup(
+      ExpressionFactory<GF7>::Product(Advice(0), Advice(1)), Fixed(0)));
+
+  std::vector<LogDerivativeLookupArgument<GF7>> arguments =
+      LogDerivativeLookupArgument<GF7>::Group(lookups, /*max_degree=*/7);
+  ASSERT_EQ(arguments.size(), 2);
+  ASSERT_EQ(arguments[0].num_chunks(), 1);
+  EXPECT_EQ(arguments[0].lookups(),
+            (std::vector<const LookupArgument<GF7>*>{&lookups[0], &lookups[2],
+                                                     &lookups[3]}));
+  ASSERT_EQ(arguments[1].num_chunks(), 1);
+  EXPECT_EQ(arguments[1].lookups(),
+            (std::vector<const LookupArgument<GF7>*>{&lookups[1]}));
+
+  // 2 + (1 + 1 + 2) + 1
+  EXPECT_EQ(arguments[0].RequiredDegree(), 7);
+  // 2 + 1 + 1
+  EXPECT_EQ(arguments[1].RequiredDegree(), 4);
+  EXPECT_EQ(arguments[1].RequiredDegree(), lookups[1].RequiredDegree());
+}
+
+TEST_F(LogDerivativeLookupArgumentTest, GroupIntoChunks) {
+  std::vector<LookupArgument<GF7>> lookups;
+  lookups.push_back(CreateLookup(Advice(0), Fixed(0)));
+  lookups.push_back(CreateLookup(Advice(1), Fixed(0)));
+  lookups.push_back(CreateLookup(
+      ExpressionFactory<GF7>::Product(Advice(0), Advice(1)), Fixed(0)));
+  lookups.push_back(CreateLookup(Advice(2), Fixed(0)));
+  lookups.push_back(CreateLookup(Advice(3), Fixed(0)));
+
+  EXPECT_EQ(LogDerivativeLookupArgument<GF7>::ComputeMinRequiredDegree(lookups),
+            5);
+
+  std::vector<LogDerivativeLookupArgument<GF7>> arguments =
+      LogDerivativeLookupArgument<GF7>::Group(lookups, /*max_degree=*/5);
+  ASSERT_EQ(arguments.size(), 1);
+  const LogDerivativeLookupArgument<GF7>& argument = arguments[0];
+  ASSERT_EQ(argument.num_chunks(), 3);
+  using Chunk = LogDerivativeLookupArgument<GF7>::Chunk;
+  // 2 + (1 + 1) + 1
+  EXPECT_EQ(argument.chunks()[0], (Chunk{&lookups[0], &lookups[1]}));
+  EXPECT_EQ(argument.ComputeChunkDegree(0), 5);
+  // 2 + (2 + 1)
+  EXPECT_EQ(argument.chunks()[1], (Chunk{&lookups[2], &lookups[3]}));
+  EXPECT_EQ(argument.ComputeChunkDegree(1), 5);
+  // 2 + 1
+  EXPECT_EQ(argument.chunks()[2], (Chunk{&lookups[4]}));
+  EXPECT_EQ(argument.ComputeChunkDegree(2), 3);
+  EXPECT_EQ(argument.RequiredDegree(), 5);
+  EXPECT_EQ(argument.lookups(),
+            (std::vector<const LookupArgument<GF7>*>{
+                &lookups[0], &lookups[1], &lookups[2], &lookups[3],
+                &lookups[4]}));
+}
+
+TEST_F(LogDerivativeLookupArgumentTest, ComputeGrandSumConstraint) {
+  std::vector<GF7> inputs_plus_beta = {GF7(2), GF7(3), GF7(5)};
+  GF7 table_plus_beta(4);
+  GF7 multiplicity(2);
+  GF7 grand_sum(6);
+
+  // φ(ωX) = φ(X) + Σᵢ 1 / (fᵢ(X) + β) - m(X) / (t(X) + β)
+  GF7 grand_sum_next = grand_sum - multiplicity / table_plus_beta;
+  for (const GF7& input_plus_beta : inputs_plus_beta) {
+    grand_sum_next += GF7::One() / input_plus_beta;
+  }
+  EXPECT_TRUE(ComputeGrandSumConstraint<GF7>(inputs_plus_beta, table_plus_beta,
+                                             multiplicity, grand_sum,
+                                             grand_sum_next)
+                  .IsZero());
+  EXPECT_FALSE(ComputeGrandSumConstraint<GF7>(
+                   inputs_plus_beta, table_plus_beta, multiplicity, grand_sum,
+                   grand_sum_next + GF7::One())
+                   .IsZero());
+}
+
+}  // namespace tachyon::zk
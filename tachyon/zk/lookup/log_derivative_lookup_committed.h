@@ -0,0 +1,44 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_COMMITTED_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_COMMITTED_H_
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/zk/base/blinded_polynomial.h"
+
+namespace tachyon::zk {
+
+template <typename Poly>
+class LogDerivativeLookupCommitted {
+ public:
+  using F = typename Poly::Field;
+
+  LogDerivativeLookupCommitted(
+      BlindedPolynomial<Poly>&& multiplicity_poly,
+      std::vector<BlindedPolynomial<Poly>>&& grand_sum_polys)
+      : multiplicity_poly_(std::move(multiplicity_poly)),
+        grand_sum_polys_(std::move(grand_sum_polys)) {}
+
+  const BlindedPolynomial<Poly>& multiplicity_poly() const {
+    return multiplicity_poly_;
+  }
+  // |grand_sum_polys()[k]| is the grand sum of the k-th chunk.
+  const std::vector<BlindedPolynomial<Poly>>& grand_sum_polys() const {
+    return grand_sum_polys_;
+  }
+
+  BlindedPolynomial<Poly>&& TakeMultiplicityPoly() && {
+    return std::move(multiplicity_poly_);
+  }
+  std::vector<BlindedPolynomial<Poly>>&& TakeGrandSumPolys() && {
+    return std::move(grand_sum_polys_);
+  }
+
+ private:
+  BlindedPolynomial<Poly> multiplicity_poly_;
+  std::vector<BlindedPolynomial<Poly>> grand_sum_polys_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_COMMITTED_H_
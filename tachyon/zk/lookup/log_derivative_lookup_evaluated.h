@@ -0,0 +1,37 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_EVALUATED_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_EVALUATED_H_
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/zk/base/blinded_polynomial.h"
+
+namespace tachyon::zk {
+
+template <typename Poly>
+class LogDerivativeLookupEvaluated {
+ public:
+  using F = typename Poly::Field;
+
+  LogDerivativeLookupEvaluated(
+      BlindedPolynomial<Poly>&& multiplicity_poly,
+      std::vector<BlindedPolynomial<Poly>>&& grand_sum_polys)
+      : multiplicity_poly_(std::move(multiplicity_poly)),
+        grand_sum_polys_(std::move(grand_sum_polys)) {}
+
+  const BlindedPolynomial<Poly>& multiplicity_poly() const {
+    return multiplicity_poly_;
+  }
+  // |grand_sum_polys()[k]| is the grand sum of the k-th chunk.
+  const std::vector<BlindedPolynomial<Poly>>& grand_sum_polys() const {
+    return grand_sum_polys_;
+  }
+
+ private:
+  BlindedPolynomial<Poly> multiplicity_poly_;
+  std::vector<BlindedPolynomial<Poly>> grand_sum_polys_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_EVALUATED_H_
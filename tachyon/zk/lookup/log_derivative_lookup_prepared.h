@@ -0,0 +1,46 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_PREPARED_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_PREPARED_H_
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/zk/base/blinded_polynomial.h"
+
+namespace tachyon::zk {
+
+template <typename Poly, typename Evals>
+class LogDerivativeLookupPrepared {
+ public:
+  using F = typename Poly::Field;
+
+  LogDerivativeLookupPrepared() = default;
+  LogDerivativeLookupPrepared(
+      std::vector<std::vector<Evals>>&& compressed_inputs,
+      Evals&& compressed_table, Evals&& multiplicities,
+      BlindedPolynomial<Poly>&& multiplicity_poly)
+      : compressed_inputs_(std::move(compressed_inputs)),
+        compressed_table_(std::move(compressed_table)),
+        multiplicities_(std::move(multiplicities)),
+        multiplicity_poly_(std::move(multiplicity_poly)) {}
+
+  // |compressed_inputs()[k]| are the compressed inputs of the k-th chunk.
+  const std::vector<std::vector<Evals>>& compressed_inputs() const {
+    return compressed_inputs_;
+  }
+  const Evals& compressed_table() const { return compressed_table_; }
+  const Evals& multiplicities() const { return multiplicities_; }
+
+  BlindedPolynomial<Poly>&& TakeMultiplicityPoly() && {
+    return std::move(multiplicity_poly_);
+  }
+
+ private:
+  std::vector<std::vector<Evals>> compressed_inputs_;
+  Evals compressed_table_;
+  Evals multiplicities_;
+  BlindedPolynomial<Poly> multiplicity_poly_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_PREPARED_H_
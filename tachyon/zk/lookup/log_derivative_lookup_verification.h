@@ -0,0 +1,110 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_H_
+
+#include <vector>
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/polynomial_openings.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_argument.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_verification_data.h"
+#include "tachyon/zk/lookup/lookup_verification.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_verification_evaluator.h"
+
+namespace tachyon::zk {
+
+template <typename F, typename C>
+F CreateGrandSumExpression(
+    const LogDerivativeLookupVerificationData<F, C>& data,
+    const LogDerivativeLookupArgument<F>& argument, size_t chunk_index) {
+  VanishingVerificationEvaluator<F> evaluator(data);
+  // fᵢ(X) + β = θᵐ⁻¹aᵢ,₀(X) + ... + aᵢ,ₘ₋₁(X) + β
+  std::vector<F> inputs_plus_beta = base::Map(
+      argument.chunks()[chunk_index],
+      [&data, &evaluator](const LookupArgument<F>* lookup) {
+        return CompressExpressions(lookup->input_expressions(), *data.theta,
+                                   evaluator) +
+               *data.beta;
+      });
+  if (chunk_index != 0) {
+    return ComputeGrandSumConstraint<F>(
+        inputs_plus_beta, F::One(), F::Zero(),
+        data.grand_sum_evals[chunk_index],
+        data.grand_sum_next_evals[chunk_index]);
+  }
+  // t(X) + β = θᵐ⁻¹s₀(X) + ... + sₘ₋₁(X) + β
+  F table_plus_beta = CompressExpressions(argument.table_expressions(),
+                                          *data.theta, evaluator) +
+                      *data.beta;
+  return ComputeGrandSumConstraint<F>(
+      inputs_plus_beta, table_plus_beta, *data.multiplicity_eval,
+      data.grand_sum_evals[0], data.grand_sum_next_evals[0]);
+}
+
+template <typename F>
+size_t GetSizeOfLogDerivativeLookupVerificationExpressions(
+    const LogDerivativeLookupArgument<F>& argument) {
+  return 2 * argument.num_chunks() + 1;
+}
+
+template <typename F, typename C>
+std::vector<F> CreateLogDerivativeLookupVerificationExpressions(
+    const LogDerivativeLookupVerificationData<F, C>& data,
+    const LogDerivativeLookupArgument<F>& argument) {
+  F active_rows = F::One() - (*data.l_last + *data.l_blind);
+  std::vector<F> ret;
+  ret.reserve(GetSizeOfLogDerivativeLookupVerificationExpressions(argument));
+  // l_first(X) * φₖ(X) = 0
+  for (const F& grand_sum_eval : data.grand_sum_evals) {
+    ret.push_back(*data.l_first * grand_sum_eval);
+  }
+  // l_last(X) * Σₖ φₖ(X) = 0
+  F grand_sum_last = F::Zero();
+  for (const F& grand_sum_eval : data.grand_sum_evals) {
+    grand_sum_last += grand_sum_eval;
+  }
+  ret.push_back(*data.l_last * grand_sum_last);
+  // (1 - (l_last(X) + l_blind(X))) * (
+  //   (φₖ(ωX) - φₖ(X)) * Πᵢ(fᵢ(X) + β) * (t(X) + β) -
+  //   Σᵢ Πⱼ≠ᵢ(fⱼ(X) + β) * (t(X) + β) + m(X) * Πᵢ(fᵢ(X) + β)
+  // ) = 0, where t(X) + β is 1 and m(X) is 0 for k > 0.
+  for (size_t k = 0; k < argument.num_chunks(); ++k) {
+    ret.push_back(active_rows * CreateGrandSumExpression(data, argument, k));
+  }
+  return ret;
+}
+
+template <typename F>
+size_t GetSizeOfLogDerivativeLookupVerifierQueries(
+    const LogDerivativeLookupArgument<F>& argument) {
+  return 2 * argument.num_chunks() + 1;
+}
+
+template <typename PCS, typename F, typename C,
+          typename Poly = typename PCS::Poly>
+std::vector<crypto::PolynomialOpening<Poly, C>>
+CreateLogDerivativeLookupQueries(
+    const LogDerivativeLookupVerificationData<F, C>& data,
+    const LogDerivativeLookupArgument<F>& argument) {
+  std::vector<crypto::PolynomialOpening<Poly, C>> queries;
+  queries.reserve(GetSizeOfLogDerivativeLookupVerifierQueries(argument));
+  // Open lookup grand sum commitments at x.
+  for (size_t k = 0; k < data.grand_sum_commitments.size(); ++k) {
+    queries.emplace_back(
+        base::DeepRef<const C>(&data.grand_sum_commitments[k]),
+        base::DeepRef<const F>(data.x), data.grand_sum_evals[k]);
+  }
+  // Open lookup multiplicity commitment at x.
+  queries.emplace_back(base::DeepRef<const C>(data.multiplicity_commitment),
+                       base::DeepRef<const F>(data.x), *data.multiplicity_eval);
+  // Open lookup grand sum commitments at ω * x.
+  for (size_t k = 0; k < data.grand_sum_commitments.size(); ++k) {
+    queries.emplace_back(
+        base::DeepRef<const C>(&data.grand_sum_commitments[k]),
+        base::DeepRef<const F>(data.x_next), data.grand_sum_next_evals[k]);
+  }
+  return queries;
+}
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_H_
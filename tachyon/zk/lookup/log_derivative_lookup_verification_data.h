@@ -0,0 +1,30 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_DATA_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_DATA_H_
+
+#include "absl/types/span.h"
+
+#include "tachyon/zk/plonk/vanishing/vanishing_verification_data.h"
+
+namespace tachyon::zk {
+
+template <typename F, typename C>
+struct LogDerivativeLookupVerificationData
+    : public VanishingVerificationData<F> {
+  const C* multiplicity_commitment = nullptr;
+  const F* multiplicity_eval = nullptr;
+  // The k-th elements of the spans below belong to the k-th chunk.
+  absl::Span<const C> grand_sum_commitments;
+  absl::Span<const F> grand_sum_evals;
+  absl::Span<const F> grand_sum_next_evals;
+  const F* theta = nullptr;
+  const F* beta = nullptr;
+  const F* x = nullptr;
+  const F* x_next = nullptr;
+  const F* l_first = nullptr;
+  const F* l_blind = nullptr;
+  const F* l_last = nullptr;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_DATA_H_
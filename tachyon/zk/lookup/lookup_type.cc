@@ -0,0 +1,18 @@
+#include "tachyon/zk/lookup/lookup_type.h"
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::zk {
+
+std::string_view LookupTypeToString(LookupType type) {
+  switch (type) {
+    case LookupType::kHalo2:
+      return "Halo2";
+    case LookupType::kLogDerivative:
+      return "LogDerivative";
+  }
+  NOTREACHED();
+  return "";
+}
+
+}  // namespace tachyon::zk
@@ -0,0 +1,27 @@
+#ifndef TACHYON_ZK_LOOKUP_LOOKUP_TYPE_H_
+#define TACHYON_ZK_LOOKUP_LOOKUP_TYPE_H_
+
+#include <string_view>
+
+#include "tachyon/export.h"
+
+namespace tachyon::zk {
+
+// The lookup argument that proves the lookups of a constraint system.
+// - |kHalo2|: Commits the permuted input and table of each lookup and their
+//   grand product. See
+//   https://zcash.github.io/halo2/design/proving-system/lookup.html.
+// - |kLogDerivative|: Commits a multiplicity column per table and the grand
+//   sum of the inverses, so it doesn't need to sort anything. The lookups
+//   against the same table share the columns. See
+//   https://eprint.iacr.org/2022/1530.
+enum class LookupType {
+  kHalo2,
+  kLogDerivative,
+};
+
+TACHYON_EXPORT std::string_view LookupTypeToString(LookupType type);
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOOKUP_TYPE_H_
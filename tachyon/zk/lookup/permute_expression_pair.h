@@ -7,13 +7,15 @@
 #ifndef TACHYON_ZK_LOOKUP_PERMUTE_EXPRESSION_PAIR_H_
 #define TACHYON_ZK_LOOKUP_PERMUTE_EXPRESSION_PAIR_H_
 
-#include <algorithm>
+#include <functional>
 #include <utility>
 #include <vector>
 
-#include "absl/container/btree_map.h"
+#include "absl/container/flat_hash_map.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/base/threading/parallel_for.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/lookup/lookup_pair.h"
 
@@ -24,32 +26,47 @@ namespace tachyon::zk {
 // - like values in A' are vertically adjacent to each other; and
 // - the first row in a sequence of like values in A' is the row
 //   that has the corresponding value in S'.
-// This method returns (A', S') if no errors are encountered.
+// This method returns (A', S') without blinding the rows behind the usable
+// rows if no errors are encountered. It doesn't touch the random number
+// generator of |prover|, so it is safe to run it for many pairs at once.
 template <typename PCS, typename Evals, typename F = typename Evals::Field>
-[[nodiscard]] bool PermuteExpressionPair(ProverBase<PCS>* prover,
-                                         const LookupPair<Evals>& in,
-                                         LookupPair<Evals>* out) {
+[[nodiscard]] bool PermuteExpressionPairWithoutBlinding(
+    const ProverBase<PCS>* prover, const LookupPair<Evals>& in,
+    LookupPair<Evals>* out) {
+  using BigIntTy = typename F::BigIntTy;
+
+  constexpr size_t kParallelThreshold = 1024;
+
   size_t domain_size = prover->domain()->size();
   RowIndex usable_rows = prover->GetUsableRows();
 
-  std::vector<F> permuted_input_expressions = in.input().evaluations();
+  // NOTE(chokobole): The values are sorted and counted in their canonical
+  // form. Comparing field elements directly converts them out of the
+  // montgomery form on every comparison, and the order must be the canonical
+  // one to produce the same permutation as halo2.
+  std::vector<BigIntTy> sorted_inputs(usable_rows);
+  std::vector<BigIntTy> table_values(usable_rows);
+  base::ParallelFor(0, usable_rows, [&in, &sorted_inputs,
+                                     &table_values](size_t i) {
+    sorted_inputs[i] = in.input()[i]->ToBigInt();
+    table_values[i] = in.table()[i]->ToBigInt();
+  });
 
   // sort input lookup expression values
-  std::sort(permuted_input_expressions.begin(),
-            permuted_input_expressions.begin() + usable_rows);
+  base::ParallelSort(sorted_inputs, std::less<>(), kParallelThreshold);
+
+  std::vector<F> permuted_input_expressions = in.input().evaluations();
+  base::ParallelFor(0, usable_rows,
+                    [&permuted_input_expressions, &sorted_inputs](size_t i) {
+                      permuted_input_expressions[i] =
+                          F::FromBigInt(sorted_inputs[i]);
+                    });
 
   // a map of each unique element in the table expression and its count
-  absl::btree_map<F, RowIndex> leftover_table_map;
-
-  for (RowIndex i = 0; i < usable_rows; ++i) {
-    const F& coeff = *in.table()[i];
-    // if key doesn't exist, insert the key and value 1 for the key.
-    auto it = leftover_table_map.try_emplace(coeff, RowIndex{1});
-    // no inserted value, meaning the key exists.
-    if (!it.second) {
-      // Increase value by 1 if not inserted.
-      ++((*it.first).second);
-    }
+  absl::flat_hash_map<BigIntTy, RowIndex> leftover_table_map;
+  leftover_table_map.reserve(usable_rows);
+  for (const BigIntTy& value : table_values) {
+    ++leftover_table_map[value];
   }
 
   std::vector<F> permuted_table_expressions =
@@ -57,7 +74,7 @@ template <typename PCS, typename Evals, typename F = typename Evals::Field>
 
   std::vector<RowIndex> repeated_input_rows;
   for (RowIndex row = 0; row < usable_rows; ++row) {
-    const F& input_value = permuted_input_expressions[row];
+    const BigIntTy& input_value = sorted_inputs[row];
 
     // ref: https://zcash.github.io/halo2/design/proving-system/lookup.html
     //
@@ -94,15 +111,15 @@ template <typename PCS, typename Evals, typename F = typename Evals::Field>
     //               --------                --------
     // we can see that elements of A' {1,2,5} is in S' {1,4,2,5}
     //
-    if (row == 0 || input_value != permuted_input_expressions[row - 1]) {
+    if (row == 0 || input_value != sorted_inputs[row - 1]) {
       // Assign S'(x) with A'(x).
-      permuted_table_expressions[row] = input_value;
+      permuted_table_expressions[row] = permuted_input_expressions[row];
 
       // remove one instance of input_value from |leftover_table_map|.
       auto it = leftover_table_map.find(input_value);
       // if input value is not found, return error
       if (it == leftover_table_map.end()) {
-        LOG(ERROR) << "input(" << input_value.ToString()
+        LOG(ERROR) << "input(" << permuted_input_expressions[row].ToString()
                    << ") is not found in table";
         return false;
       }
@@ -115,12 +132,19 @@ template <typename PCS, typename Evals, typename F = typename Evals::Field>
     }
   }
 
-  // populate permuted table at unfilled rows with leftover table elements
-  for (auto it = leftover_table_map.begin(); it != leftover_table_map.end();
-       ++it) {
-    const F& coeff = it->first;
-    const RowIndex count = it->second;
+  // The leftover table elements are visited in ascending order, which is the
+  // order halo2 visits them in its |BTreeMap|.
+  std::vector<std::pair<BigIntTy, RowIndex>> leftover_table_elements;
+  leftover_table_elements.reserve(repeated_input_rows.size());
+  for (const auto& [value, count] : leftover_table_map) {
+    if (count > 0) leftover_table_elements.emplace_back(value, count);
+  }
+  base::ParallelSort(leftover_table_elements, std::less<>(),
+                     kParallelThreshold);
 
+  // populate permuted table at unfilled rows with leftover table elements
+  for (const auto& [value, count] : leftover_table_elements) {
+    F coeff = F::FromBigInt(value);
     for (RowIndex i = 0; i < count; ++i) {
       CHECK(!repeated_input_rows.empty());
       RowIndex row = repeated_input_rows.back();
@@ -131,13 +155,30 @@ template <typename PCS, typename Evals, typename F = typename Evals::Field>
 
   CHECK(repeated_input_rows.empty());
 
-  Evals input(std::move(permuted_input_expressions));
-  Evals table(std::move(permuted_table_expressions));
+  *out = {Evals(std::move(permuted_input_expressions)),
+          Evals(std::move(permuted_table_expressions))};
+  return true;
+}
 
+// Blinds the rows of (A', S') behind the usable rows, including the last row.
+template <typename PCS, typename Evals>
+void BlindPermutedExpressionPair(ProverBase<PCS>* prover,
+                                 LookupPair<Evals>* pair) {
+  Evals input = std::move(*pair).TakeInput();
+  Evals table = std::move(*pair).TakeTable();
   prover->blinder().Blind(input, /*include_last_row=*/true);
   prover->blinder().Blind(table, /*include_last_row=*/true);
+  *pair = {std::move(input), std::move(table)};
+}
 
-  *out = {std::move(input), std::move(table)};
+// Same as |PermuteExpressionPairWithoutBlinding()|, but the returned (A', S')
+// is blinded.
+template <typename PCS, typename Evals>
+[[nodiscard]] bool PermuteExpressionPair(ProverBase<PCS>* prover,
+                                         const LookupPair<Evals>& in,
+                                         LookupPair<Evals>* out) {
+  if (!PermuteExpressionPairWithoutBlinding(prover, in, out)) return false;
+  BlindPermutedExpressionPair(prover, out);
   return true;
 }
 
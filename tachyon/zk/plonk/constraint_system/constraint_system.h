@@ -24,7 +24,9 @@
 #include "tachyon/base/functional/callback.h"
 #include "tachyon/zk/base/row_index.h"
 #include "tachyon/zk/expressions/evaluator/simple_selector_finder.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_argument.h"
 #include "tachyon/zk/lookup/lookup_argument.h"
+#include "tachyon/zk/lookup/lookup_type.h"
 #include "tachyon/zk/plonk/constraint_system/constraint.h"
 #include "tachyon/zk/plonk/constraint_system/gate.h"
 #include "tachyon/zk/plonk/constraint_system/query.h"
@@ -102,6 +104,38 @@ class ConstraintSystem {
 
   const std::vector<LookupArgument<F>>& lookups() const { return lookups_; }
 
+  LookupType lookup_type() const { return lookup_type_; }
+
+  // Sets the argument that proves |lookups()|. It must be set before the keys
+  // are generated, since it changes the degree of the constraint system.
+  void set_lookup_type(LookupType lookup_type) {
+    lookup_type_ = lookup_type;
+    cached_degree_.reset();
+  }
+
+  // Returns |lookups()| grouped by their tables for
+  // |LookupType::kLogDerivative|. The lookups of each table are split into
+  // chunks within the degree that the gates and the permutation argument
+  // already need, or the one that a single lookup needs if it is higher. The
+  // returned arguments refer to |lookups()|, so they must not outlive this.
+  std::vector<LogDerivativeLookupArgument<F>> ComputeLogDerivativeLookups()
+      const {
+    size_t max_degree = std::max(
+        ComputeDegreeWithoutLookups(),
+        LogDerivativeLookupArgument<F>::ComputeMinRequiredDegree(lookups_));
+    return LogDerivativeLookupArgument<F>::Group(lookups_, max_degree);
+  }
+
+  // Returns the number of grand sums of |ComputeLogDerivativeLookups()|.
+  size_t ComputeLogDerivativeLookupGrandSumNums() const {
+    size_t num_grand_sums = 0;
+    for (const LogDerivativeLookupArgument<F>& argument :
+         ComputeLogDerivativeLookups()) {
+      num_grand_sums += argument.num_chunks();
+    }
+    return num_grand_sums;
+  }
+
   const absl::flat_hash_map<ColumnKeyBase, std::string>&
   general_column_annotations() const {
     return general_column_annotations_;
@@ -442,19 +476,10 @@ class ConstraintSystem {
   // constraints).
   size_t ComputeDegree() const {
     if (!cached_degree_.has_value()) {
-      // The permutation argument will serve alongside the gates, so must be
-      // accounted for.
-      size_t degree = permutation_.RequiredDegree();
-
       // The lookup argument also serves alongside the gates and must be
       // accounted for.
-      degree = std::max(degree, ComputeLookupRequiredDegree());
-
-      // Account for each gate to ensure our quotient polynomial is the
-      // correct degree and that our extended domain is the right size.
-      degree = std::max(degree, ComputeGateRequiredDegree());
-
-      cached_degree_ = std::max(degree, minimum_degree_.value_or(1));
+      cached_degree_ = std::max(ComputeDegreeWithoutLookups(),
+                                ComputeLookupRequiredDegree());
     }
     return *cached_degree_;
   }
@@ -556,11 +581,35 @@ class ConstraintSystem {
     return true;
   }
 
+  size_t ComputeDegreeWithoutLookups() const {
+    // The permutation argument will serve alongside the gates, so must be
+    // accounted for.
+    size_t degree = permutation_.RequiredDegree();
+
+    // Account for each gate to ensure our quotient polynomial is the
+    // correct degree and that our extended domain is the right size.
+    degree = std::max(degree, ComputeGateRequiredDegree());
+
+    return std::max(degree, minimum_degree_.value_or(1));
+  }
+
   size_t ComputeLookupRequiredDegree() const {
-    std::vector<size_t> required_degrees =
-        base::Map(lookups_, [](const LookupArgument<F>& argument) {
-          return argument.RequiredDegree();
-        });
+    std::vector<size_t> required_degrees;
+    switch (lookup_type_) {
+      case LookupType::kHalo2:
+        required_degrees =
+            base::Map(lookups_, [](const LookupArgument<F>& argument) {
+              return argument.RequiredDegree();
+            });
+        break;
+      case LookupType::kLogDerivative:
+        required_degrees = base::Map(
+            ComputeLogDerivativeLookups(),
+            [](const LogDerivativeLookupArgument<F>& argument) {
+              return argument.RequiredDegree();
+            });
+        break;
+    }
     auto max_required_degree =
         std::max_element(required_degrees.begin(), required_degrees.end());
     if (max_required_degree == required_degrees.end()) return 1;
@@ -615,6 +664,8 @@ class ConstraintSystem {
   // of table expressions involved in the lookup.
   std::vector<LookupArgument<F>> lookups_;
 
+  LookupType lookup_type_ = LookupType::kHalo2;
+
   // List of indexes of Fixed columns which are associated to a
   // circuit-general Column tied to their annotation.
   absl::flat_hash_map<ColumnKeyBase, std::string> general_column_annotations_;
@@ -3,6 +3,9 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/zk/plonk/examples/circuit_test.h"
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
 #include "tachyon/zk/plonk/keys/proving_key.h"
@@ -632,6 +635,90 @@ TEST_F(SimpleCircuitTest, LoadProvingKey) {
   }
 }
 
+TEST_F(SimpleCircuitTest, LoadProvingKeyFromMappedFile) {
+  size_t n = 16;
+  CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+  prover_->set_domain(Domain::Create(n));
+
+  F constant(7);
+  F a(2);
+  F b(3);
+  SimpleCircuit<F, SimpleFloorPlanner> circuit(constant, a, b);
+
+  ProvingKey<PCS> pkey;
+  ASSERT_TRUE(pkey.Load(prover_.get(), circuit));
+
+  base::Uint8VectorBuffer buffer;
+  ASSERT_TRUE(WriteMappedProvingKey(pkey, &buffer));
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("proving_key");
+  ASSERT_TRUE(base::WriteFile(path, buffer.owned_buffer()));
+
+  MappedProvingKey<F> mapped;
+  ASSERT_TRUE(mapped.Load(path));
+  EXPECT_EQ(mapped.num_fixed_columns(), pkey.fixed_columns().size());
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped.fixed_column(0).data()) %
+                MappedProvingKeyHeader::kAlignment,
+            uintptr_t{0});
+
+  VerifyingKey<PCS> vkey;
+  ASSERT_TRUE(vkey.Load(prover_.get(), circuit));
+  EXPECT_EQ(mapped.transcript_repr(), vkey.transcript_repr());
+  ProvingKey<PCS> mapped_pkey;
+  VerifyingKey<PCS> same_vkey;
+  ASSERT_TRUE(same_vkey.Load(prover_.get(), circuit));
+  EXPECT_FALSE(mapped_pkey.LoadFromMapped(n / 2, std::move(same_vkey), mapped));
+  SimpleCircuit<F, SimpleFloorPlanner> other_circuit(constant + F::One(), a,
+                                                     b);
+  VerifyingKey<PCS> other_vkey;
+  ASSERT_TRUE(other_vkey.Load(prover_.get(), other_circuit));
+  EXPECT_FALSE(mapped_pkey.LoadFromMapped(n, std::move(other_vkey), mapped));
+  ASSERT_TRUE(mapped_pkey.LoadFromMapped(n, std::move(vkey), mapped));
+  EXPECT_EQ(mapped_pkey.l_first(), pkey.l_first());
+  EXPECT_EQ(mapped_pkey.l_last(), pkey.l_last());
+  EXPECT_EQ(mapped_pkey.l_active_row(), pkey.l_active_row());
+  EXPECT_EQ(mapped_pkey.fixed_columns(), pkey.fixed_columns());
+  EXPECT_EQ(mapped_pkey.fixed_polys(), pkey.fixed_polys());
+  EXPECT_EQ(mapped_pkey.permutation_proving_key(),
+            pkey.permutation_proving_key());
+
+  // Flip a bit of the first vector.
+  std::vector<uint8_t> corrupted = buffer.owned_buffer();
+  MappedVectorEntry entry;
+  memcpy(&entry, &corrupted[sizeof(MappedProvingKeyHeader)], sizeof(entry));
+  corrupted[entry.offset] ^= 1;
+  base::FilePath corrupted_path = temp_dir.GetPath().Append("corrupted");
+  ASSERT_TRUE(base::WriteFile(corrupted_path, corrupted));
+  MappedProvingKey<F> corrupted_mapped;
+  EXPECT_FALSE(corrupted_mapped.Load(corrupted_path));
+  MappedProvingKey<F> unverified_mapped;
+  EXPECT_TRUE(
+      unverified_mapped.Load(corrupted_path, /*verify_checksums=*/false));
+
+  std::vector<uint8_t> truncated = buffer.owned_buffer();
+  truncated.pop_back();
+  base::FilePath truncated_path = temp_dir.GetPath().Append("truncated");
+  ASSERT_TRUE(base::WriteFile(truncated_path, truncated));
+  MappedProvingKey<F> truncated_mapped;
+  EXPECT_FALSE(truncated_mapped.Load(truncated_path));
+
+  // A header whose number of vectors would overflow.
+  std::vector<uint8_t> overflowed = buffer.owned_buffer();
+  MappedProvingKeyHeader header;
+  memcpy(&header, overflowed.data(), sizeof(header));
+  header.num_fixed_columns = uint64_t{1} << 63;
+  header.header_checksum =
+      zk::internal::ComputeMappedChecksum(absl::Span<const uint8_t>(
+          reinterpret_cast<const uint8_t*>(&header),
+          offsetof(MappedProvingKeyHeader, header_checksum)));
+  memcpy(overflowed.data(), &header, sizeof(header));
+  base::FilePath overflowed_path = temp_dir.GetPath().Append("overflowed");
+  ASSERT_TRUE(base::WriteFile(overflowed_path, overflowed));
+  MappedProvingKey<F> overflowed_mapped;
+  EXPECT_FALSE(overflowed_mapped.Load(overflowed_path));
+}
+
 TEST_F(SimpleCircuitTest, CreateProof) {
   size_t n = 16;
   CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
@@ -660,6 +747,78 @@ TEST_F(SimpleCircuitTest, CreateProof) {
   EXPECT_THAT(proof, testing::ContainerEq(expected_proof));
 }
 
+TEST_F(SimpleCircuitTest, CreateProofWithPrecomputedCosets) {
+  size_t n = 16;
+  F constant(7);
+  F a(2);
+  F b(3);
+  SimpleCircuit<F, SimpleFloorPlanner> circuit(constant, a, b);
+
+  // NOTE(chokobole): The prover is reset before loading a key, so that each
+  // proof starts from the same transcript and random number generator.
+  auto load_proving_key = [this, n, &a, &b](const F& key_constant,
+                                            ProvingKey<PCS>* pkey) {
+    SetUp();
+    CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+    prover_->set_domain(Domain::Create(n));
+    SimpleCircuit<F, SimpleFloorPlanner> key_circuit(key_constant, a, b);
+    CHECK(pkey->Load(prover_.get(), key_circuit));
+  };
+  auto create_proof = [this, &circuit, &constant, &a, &b](
+                          const ProvingKey<PCS>& pkey) {
+    std::vector<SimpleCircuit<F, SimpleFloorPlanner>> circuits = {circuit};
+    F c = constant * a.Square() * b.Square();
+    std::vector<F> instance_column = {std::move(c)};
+    std::vector<Evals> instance_columns = {Evals(std::move(instance_column))};
+    std::vector<std::vector<Evals>> instance_columns_vec = {
+        std::move(instance_columns)};
+    prover_->CreateProof(pkey, std::move(instance_columns_vec), circuits);
+    return prover_->GetWriter()->buffer().owned_buffer();
+  };
+
+  ProvingKey<PCS> pkey;
+  load_proving_key(constant, &pkey);
+  pkey.PrecomputeCosets(prover_.get());
+  ASSERT_FALSE(pkey.cosets().empty());
+  EXPECT_EQ(pkey.cosets().transcript_repr(),
+            pkey.verifying_key().transcript_repr());
+
+  base::Uint8VectorBuffer buffer;
+  ASSERT_TRUE(buffer.Grow(base::EstimateSize(pkey.cosets())));
+  ASSERT_TRUE(buffer.Write(pkey.cosets()));
+  buffer.set_buffer_offset(0);
+  ProvingKeyCosets<Evals> cosets;
+  ASSERT_TRUE(buffer.Read(&cosets));
+  EXPECT_EQ(cosets, pkey.cosets());
+
+  // The cosets of a key with another fixed column are rejected.
+  ProvingKey<PCS> other_pkey;
+  load_proving_key(F(8), &other_pkey);
+  ProvingKeyCosets<Evals> other_cosets = cosets;
+  EXPECT_FALSE(other_pkey.SetCosets(prover_.get(), std::move(other_cosets)));
+  EXPECT_TRUE(other_pkey.cosets().empty());
+
+  // The proof must be made from the cosets, so tampering with them changes
+  // the proof.
+  std::vector<ProvingKeyCosetPart<Evals>> tampered_parts = cosets.parts();
+  *tampered_parts[0].l_first[0] += F::One();
+  ProvingKeyCosets<Evals> tampered_cosets(
+      cosets.transcript_repr(), cosets.zeta(), std::move(tampered_parts));
+  load_proving_key(constant, &pkey);
+  ASSERT_TRUE(pkey.SetCosets(prover_.get(), std::move(tampered_cosets)));
+  std::vector<uint8_t> tampered_proof = create_proof(pkey);
+
+  load_proving_key(constant, &pkey);
+  ASSERT_TRUE(pkey.cosets().empty());
+  ASSERT_TRUE(pkey.SetCosets(prover_.get(), std::move(cosets)));
+  std::vector<uint8_t> proof = create_proof(pkey);
+
+  std::vector<uint8_t> expected_proof(std::begin(kExpectedProof),
+                                      std::end(kExpectedProof));
+  EXPECT_THAT(proof, testing::ContainerEq(expected_proof));
+  EXPECT_NE(tampered_proof, expected_proof);
+}
+
 TEST_F(SimpleCircuitTest, Verify) {
   size_t n = 16;
   CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
@@ -867,4 +1026,57 @@ TEST_F(SimpleCircuitTest, Verify) {
   EXPECT_EQ(h_eval, expected_h_eval);
 }
 
+TEST_F(SimpleCircuitTest, VerifyProofs) {
+  size_t n = 16;
+  CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+  prover_->set_domain(Domain::Create(n));
+
+  F constant(7);
+  F a(2);
+  F b(3);
+  SimpleCircuit<F, SimpleFloorPlanner> circuit(constant, a, b);
+
+  VerifyingKey<PCS> vkey;
+  ASSERT_TRUE(vkey.Load(prover_.get(), circuit));
+
+  std::vector<uint8_t> owned_proof(std::begin(kExpectedProof),
+                                   std::end(kExpectedProof));
+  Verifier<PCS> verifier =
+      CreateVerifier(CreateBufferWithProof(absl::MakeSpan(owned_proof)));
+  F c = constant * a.Square() * b.Square();
+
+  auto create_batch = [&owned_proof](const std::vector<F>& instances) {
+    std::vector<Verifier<PCS>::BatchEntry> batch;
+    for (const F& instance : instances) {
+      Verifier<PCS>::BatchEntry entry;
+      entry.transcript = std::make_unique<Blake2bReader<Commitment>>(
+          CreateBufferWithProof(absl::MakeSpan(owned_proof)));
+      std::vector<F> instance_column = {instance};
+      std::vector<Evals> instance_columns = {
+          Evals(std::move(instance_column))};
+      entry.instance_columns_vec = {std::move(instance_columns)};
+      batch.push_back(std::move(entry));
+    }
+    return batch;
+  };
+
+  std::vector<size_t> invalid_indices;
+  std::vector<Verifier<PCS>::BatchEntry> batch = create_batch({c, c, c});
+  EXPECT_TRUE(verifier.VerifyProofs(vkey, batch, &invalid_indices));
+  EXPECT_TRUE(invalid_indices.empty());
+
+  batch = create_batch({c, c + F::One(), c});
+  EXPECT_FALSE(verifier.VerifyProofs(vkey, batch, &invalid_indices));
+  EXPECT_EQ(invalid_indices, std::vector<size_t>({1}));
+
+  // A truncated proof is rejected instead of aborting the verifier.
+  std::vector<uint8_t> truncated_proof(
+      owned_proof.begin(), owned_proof.begin() + owned_proof.size() / 2);
+  batch = create_batch({c, c, c});
+  batch[2].transcript = std::make_unique<Blake2bReader<Commitment>>(
+      CreateBufferWithProof(absl::MakeSpan(truncated_proof)));
+  EXPECT_FALSE(verifier.VerifyProofs(vkey, batch, &invalid_indices));
+  EXPECT_EQ(invalid_indices, std::vector<size_t>({2}));
+}
+
 }  // namespace tachyon::zk::halo2
@@ -13,6 +13,7 @@
 #include <memory>
 #include <utility>
 
+#include "tachyon/zk/lookup/lookup_type.h"
 #include "tachyon/zk/plonk/constraint_system/circuit.h"
 
 namespace tachyon::zk {
@@ -57,11 +58,14 @@ class SimpleLookupConfig {
 
 // This is taken and modified from
 // https://github.com/kroma-network/halo2/blob/7d0a36990452c8e7ebd600de258420781a9b7917/halo2_proofs/benches/dev_lookup.rs#L28-L91.
-template <typename F, size_t Bits, template <typename> class _FloorPlanner>
+// |NumLookups| is the number of the lookups of the advice column into the
+// table, which is one in the original.
+template <typename F, size_t Bits, template <typename> class _FloorPlanner,
+          LookupType Type = LookupType::kHalo2, size_t NumLookups = 1>
 class SimpleLookupCircuit : public Circuit<SimpleLookupConfig<F, Bits>> {
  public:
-  using FloorPlanner =
-      _FloorPlanner<SimpleLookupCircuit<F, Bits, _FloorPlanner>>;
+  using FloorPlanner = _FloorPlanner<
+      SimpleLookupCircuit<F, Bits, _FloorPlanner, Type, NumLookups>>;
 
   SimpleLookupCircuit() = default;
   explicit SimpleLookupCircuit(uint32_t k) : k_(k) {}
@@ -75,22 +79,25 @@ class SimpleLookupCircuit : public Circuit<SimpleLookupConfig<F, Bits>> {
     SimpleLookupConfig<F, Bits> config(meta.CreateComplexSelector(),
                                        meta.CreateLookupTableColumn(),
                                        meta.CreateAdviceColumn());
-
-    meta.Lookup("lookup", [&config](VirtualCells<F>& meta) {
-      std::unique_ptr<Expression<F>> selector =
-          meta.QuerySelector(config.selector());
-      std::unique_ptr<Expression<F>> not_selector =
-          ExpressionFactory<F>::Constant(F::One()) - selector->Clone();
-      std::unique_ptr<Expression<F>> advice =
-          meta.QueryAdvice(config.advice(), Rotation::Cur());
-
-      LookupPairs<std::unique_ptr<Expression<F>>, LookupTableColumn>
-          lookup_pairs;
-      lookup_pairs.emplace_back(
-          std::move(selector) * std::move(advice) + std::move(not_selector),
-          config.table());
-      return lookup_pairs;
-    });
+    meta.set_lookup_type(Type);
+
+    for (size_t i = 0; i < NumLookups; ++i) {
+      meta.Lookup("lookup", [&config](VirtualCells<F>& meta) {
+        std::unique_ptr<Expression<F>> selector =
+            meta.QuerySelector(config.selector());
+        std::unique_ptr<Expression<F>> not_selector =
+            ExpressionFactory<F>::Constant(F::One()) - selector->Clone();
+        std::unique_ptr<Expression<F>> advice =
+            meta.QueryAdvice(config.advice(), Rotation::Cur());
+
+        LookupPairs<std::unique_ptr<Expression<F>>, LookupTableColumn>
+            lookup_pairs;
+        lookup_pairs.emplace_back(
+            std::move(selector) * std::move(advice) + std::move(not_selector),
+            config.table());
+        return lookup_pairs;
+      });
+    }
 
     return config;
   }
@@ -1,12 +1,18 @@
 #include "tachyon/zk/plonk/examples/simple_lookup_circuit.h"
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "tachyon/base/threading/task_group.h"
+#include "tachyon/base/threading/thread_pool.h"
 #include "tachyon/zk/plonk/examples/circuit_test.h"
+#include "tachyon/zk/plonk/halo2/blake2b_transcript.h"
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
+#include "tachyon/zk/plonk/halo2/proof_serializer.h"
 #include "tachyon/zk/plonk/keys/proving_key.h"
 #include "tachyon/zk/plonk/layout/floor_planner/simple_floor_planner.h"
 
@@ -545,6 +551,43 @@ TEST_F(SimpleLookupCircuitTest, CreateProof) {
   EXPECT_THAT(proof, testing::ContainerEq(expected_proof));
 }
 
+TEST_F(SimpleLookupCircuitTest, CreateProofOnThreadPools) {
+  size_t n = 32;
+  auto create_proof = [this, n](base::ThreadPool* pool) {
+    SetUp();
+    CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+    prover_->set_domain(Domain::Create(n));
+
+    SimpleLookupCircuit<F, kBits, SimpleFloorPlanner> circuit(4);
+    std::vector<SimpleLookupCircuit<F, kBits, SimpleFloorPlanner>> circuits =
+        {circuit};
+    std::vector<std::vector<Evals>> instance_columns_vec = {{}};
+
+    ProvingKey<PCS> pkey;
+    CHECK(pkey.Load(prover_.get(), circuit));
+    // The proof is created inside a task of |pool|, so the task graphs and
+    // the parallel loops of the prover run on |pool|.
+    base::TaskGroup group(pool);
+    group.Run([this, &pkey, &instance_columns_vec, &circuits]() {
+      prover_->CreateProof(pkey, std::move(instance_columns_vec), circuits);
+    });
+    group.Wait();
+    return prover_->GetWriter()->buffer().owned_buffer();
+  };
+
+  // On a single thread, the tasks of the graphs run one by one in the order
+  // they are added, which is the order of the serial prover.
+  base::ThreadPool serial_pool(1);
+  std::vector<uint8_t> serial_proof = create_proof(&serial_pool);
+  base::ThreadPool pool(4);
+  std::vector<uint8_t> proof = create_proof(&pool);
+
+  EXPECT_THAT(proof, testing::ContainerEq(serial_proof));
+  std::vector<uint8_t> expected_proof(std::begin(kExpectedProof),
+                                      std::end(kExpectedProof));
+  EXPECT_THAT(proof, testing::ContainerEq(expected_proof));
+}
+
 TEST_F(SimpleLookupCircuitTest, Verify) {
   size_t n = 32;
   CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
@@ -746,4 +789,173 @@ TEST_F(SimpleLookupCircuitTest, Verify) {
   EXPECT_EQ(h_eval, expected_h_eval);
 }
 
+TEST_F(SimpleLookupCircuitTest, VerifyWithLogDerivativeLookup) {
+  size_t n = 32;
+  CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+  prover_->set_domain(Domain::Create(n));
+
+  using Circuit = SimpleLookupCircuit<F, kBits, SimpleFloorPlanner,
+                                      LookupType::kLogDerivative>;
+  Circuit circuit(4);
+  std::vector<Circuit> circuits = {std::move(circuit)};
+
+  std::vector<Evals> instance_columns;
+  std::vector<std::vector<Evals>> instance_columns_vec = {instance_columns};
+
+  ProvingKey<PCS> pkey;
+  ASSERT_TRUE(pkey.Load(prover_.get(), circuit));
+  ASSERT_EQ(pkey.verifying_key().constraint_system().lookup_type(),
+            LookupType::kLogDerivative);
+  prover_->CreateProof(pkey, std::move(instance_columns_vec), circuits);
+
+  std::vector<uint8_t> owned_proof =
+      prover_->GetWriter()->buffer().owned_buffer();
+  Verifier<PCS> verifier =
+      CreateVerifier(CreateBufferWithProof(absl::MakeSpan(owned_proof)));
+  instance_columns_vec = {std::move(instance_columns)};
+
+  Proof<F, Commitment> proof;
+  F h_eval;
+  ASSERT_TRUE(verifier.VerifyProofForTesting(
+      pkey.verifying_key(), instance_columns_vec, &proof, &h_eval));
+
+  // A single multiplicity column and a single grand sum are committed instead
+  // of the permuted input and table and the product.
+  EXPECT_TRUE(proof.lookup_permuted_commitments_vec.empty());
+  EXPECT_TRUE(proof.lookup_product_commitments_vec.empty());
+  ASSERT_EQ(proof.lookup_multiplicity_commitments_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_multiplicity_commitments_vec[0].size(), 1);
+  ASSERT_EQ(proof.lookup_grand_sum_commitments_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_grand_sum_commitments_vec[0].size(), 1);
+  ASSERT_EQ(proof.lookup_multiplicity_evals_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_multiplicity_evals_vec[0].size(), 1);
+  ASSERT_EQ(proof.lookup_grand_sum_evals_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_grand_sum_evals_vec[0].size(), 1);
+  ASSERT_EQ(proof.lookup_grand_sum_next_evals_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_grand_sum_next_evals_vec[0].size(), 1);
+}
+
+TEST_F(SimpleLookupCircuitTest, VerifyWithChunkedLogDerivativeLookups) {
+  size_t n = 32;
+  CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+  prover_->set_domain(Domain::Create(n));
+
+  using Circuit = SimpleLookupCircuit<F, kBits, SimpleFloorPlanner,
+                                      LookupType::kLogDerivative,
+                                      /*NumLookups=*/3>;
+  Circuit circuit(4);
+  std::vector<Circuit> circuits = {std::move(circuit)};
+
+  std::vector<Evals> instance_columns;
+  std::vector<std::vector<Evals>> instance_columns_vec = {instance_columns};
+
+  ProvingKey<PCS> pkey;
+  ASSERT_TRUE(pkey.Load(prover_.get(), circuit));
+  const ConstraintSystem<F>& constraint_system =
+      pkey.verifying_key().constraint_system();
+  // The lookups share the table, but a single chunk of all of them would need
+  // the degree 2 + 1 + 3 * 2, so they are split into the chunks of the degree
+  // 2 + 1 + 2, 2 + 2 and 2 + 2.
+  std::vector<LogDerivativeLookupArgument<F>> arguments =
+      constraint_system.ComputeLogDerivativeLookups();
+  ASSERT_EQ(arguments.size(), 1);
+  EXPECT_EQ(arguments[0].num_chunks(), 3);
+  EXPECT_EQ(constraint_system.ComputeDegree(), 5);
+  prover_->CreateProof(pkey, std::move(instance_columns_vec), circuits);
+
+  std::vector<uint8_t> owned_proof =
+      prover_->GetWriter()->buffer().owned_buffer();
+  Verifier<PCS> verifier =
+      CreateVerifier(CreateBufferWithProof(absl::MakeSpan(owned_proof)));
+  instance_columns_vec = {std::move(instance_columns)};
+
+  Proof<F, Commitment> proof;
+  ASSERT_TRUE(verifier.VerifyProofForTesting(
+      pkey.verifying_key(), instance_columns_vec, &proof, nullptr));
+
+  // A single multiplicity column is shared by the chunks, each of which has
+  // its own grand sum.
+  ASSERT_EQ(proof.lookup_multiplicity_commitments_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_multiplicity_commitments_vec[0].size(), 1);
+  ASSERT_EQ(proof.lookup_grand_sum_commitments_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_grand_sum_commitments_vec[0].size(), 3);
+  ASSERT_EQ(proof.lookup_multiplicity_evals_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_multiplicity_evals_vec[0].size(), 1);
+  ASSERT_EQ(proof.lookup_grand_sum_evals_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_grand_sum_evals_vec[0].size(), 3);
+  ASSERT_EQ(proof.lookup_grand_sum_next_evals_vec.size(), 1);
+  EXPECT_EQ(proof.lookup_grand_sum_next_evals_vec[0].size(), 3);
+}
+
+TEST_F(SimpleLookupCircuitTest,
+       VerifyWithWrongLogDerivativeLookupMultiplicity) {
+  size_t n = 32;
+  CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+  prover_->set_domain(Domain::Create(n));
+
+  using Circuit = SimpleLookupCircuit<F, kBits, SimpleFloorPlanner,
+                                      LookupType::kLogDerivative,
+                                      /*NumLookups=*/3>;
+  Circuit circuit(4);
+  std::vector<Circuit> circuits = {std::move(circuit)};
+
+  std::vector<Evals> instance_columns;
+  std::vector<std::vector<Evals>> instance_columns_vec = {instance_columns};
+
+  ProvingKey<PCS> pkey;
+  ASSERT_TRUE(pkey.Load(prover_.get(), circuit));
+  prover_->CreateProof(pkey, std::move(instance_columns_vec), circuits);
+
+  std::vector<uint8_t> owned_proof =
+      prover_->GetWriter()->buffer().owned_buffer();
+  instance_columns_vec = {std::move(instance_columns)};
+
+  Proof<F, Commitment> proof;
+  F h_eval;
+  {
+    Verifier<PCS> verifier =
+        CreateVerifier(CreateBufferWithProof(absl::MakeSpan(owned_proof)));
+    ASSERT_TRUE(verifier.VerifyProofForTesting(
+        pkey.verifying_key(), instance_columns_vec, &proof, &h_eval));
+  }
+
+  // Replaces m(x) in the proof with m(x) + 1.
+  F multiplicity_eval = proof.lookup_multiplicity_evals_vec[0][0];
+  std::vector<uint8_t> eval_bytes(32);
+  std::vector<uint8_t> wrong_eval_bytes(32);
+  {
+    base::Buffer buffer(eval_bytes.data(), eval_bytes.size());
+    ASSERT_TRUE(ProofSerializer<F>::WriteToProof(multiplicity_eval, buffer));
+    base::Buffer wrong_buffer(wrong_eval_bytes.data(),
+                              wrong_eval_bytes.size());
+    ASSERT_TRUE(ProofSerializer<F>::WriteToProof(multiplicity_eval + F::One(),
+                                                 wrong_buffer));
+  }
+  auto it = std::search(owned_proof.begin(), owned_proof.end(),
+                        eval_bytes.begin(), eval_bytes.end());
+  ASSERT_NE(it, owned_proof.end());
+  std::copy(wrong_eval_bytes.begin(), wrong_eval_bytes.end(), it);
+
+  // NOTE(chokobole): |CreateVerifier()| can't be called twice, since it takes
+  // the PCS and the domain of |prover_|.
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(n, F(2)));
+  std::unique_ptr<crypto::TranscriptReader<Commitment>> reader =
+      std::make_unique<Blake2bReader<Commitment>>(
+          CreateBufferWithProof(absl::MakeSpan(owned_proof)));
+  Verifier<PCS> verifier(std::move(pcs), std::move(reader));
+  verifier.set_domain(Domain::Create(n));
+  EXPECT_FALSE(verifier.VerifyProofForTesting(
+      pkey.verifying_key(), instance_columns_vec, nullptr, nullptr));
+
+  // Apart from the challenges squeezed after m(x), the wrong m(x) alone breaks
+  // the constraint of the first chunk.
+  verifier.ComputeAuxValues(pkey.verifying_key().constraint_system(), proof);
+  EXPECT_EQ(verifier.ComputeExpectedHEval(1, pkey.verifying_key(), proof),
+            h_eval);
+  proof.lookup_multiplicity_evals_vec[0][0] += F::One();
+  EXPECT_NE(verifier.ComputeExpectedHEval(1, pkey.verifying_key(), proof),
+            h_eval);
+}
+
 }  // namespace tachyon::zk::halo2
@@ -1,6 +1,7 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_ARGUMENT_H_
 #define TACHYON_ZK_PLONK_HALO2_ARGUMENT_H_
 
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -37,23 +38,33 @@ class Argument {
     return argument_data_->TransformAdvice(domain);
   }
 
-  std::vector<std::vector<LookupPermuted<Poly, Evals>>> CompressLookupStep(
+  // |L| is |LookupPermuted<Poly, Evals>| if the lookup type of
+  // |constraint_system| is |LookupType::kHalo2|. Otherwise, it is
+  // |LogDerivativeLookupPrepared<Poly, Evals>|.
+  template <typename L>
+  std::vector<std::vector<L>> CompressLookupStep(
       ProverBase<PCS>* prover, const ConstraintSystem<F>& constraint_system,
       const F& theta) const {
     std::vector<RefTable<Evals>> tables = argument_data_->ExportColumnTables(
         absl::MakeConstSpan(*fixed_columns_));
-    return BatchPermuteLookups(prover, constraint_system.lookups(), tables,
-                               argument_data_->GetChallenges(), theta);
+    if constexpr (std::is_same_v<L, LookupPermuted<Poly, Evals>>) {
+      return BatchPermuteLookups(prover, constraint_system.lookups(), tables,
+                                 argument_data_->GetChallenges(), theta);
+    } else {
+      return BatchPrepareLogDerivativeLookups(
+          prover, constraint_system.ComputeLogDerivativeLookups(), tables,
+          argument_data_->GetChallenges(), theta);
+    }
   }
 
-  StepReturns<PermutationCommitted<Poly>, LookupCommitted<Poly>,
+  template <typename LookupCommittedTy, typename L>
+  StepReturns<PermutationCommitted<Poly>, LookupCommittedTy,
               VanishingCommitted<PCS>>
   CommitCircuitStep(
       ProverBase<PCS>* prover, const ConstraintSystem<F>& constraint_system,
       const PermutationProvingKey<Poly, Evals>& permutation_proving_key,
-      std::vector<std::vector<LookupPermuted<Poly, Evals>>>&&
-          permuted_lookups_vec,
-      const F& beta, const F& gamma) {
+      std::vector<std::vector<L>>&& compressed_lookups_vec, const F& beta,
+      const F& gamma) {
     std::vector<RefTable<Evals>> tables = argument_data_->ExportColumnTables(
         absl::MakeConstSpan(*fixed_columns_));
 
@@ -62,9 +73,15 @@ class Argument {
                                 permutation_proving_key, tables,
                                 constraint_system.ComputeDegree(), beta, gamma);
 
-    std::vector<std::vector<LookupCommitted<Poly>>> committed_lookups_vec =
-        BatchCommitLookups(prover, std::move(permuted_lookups_vec), beta,
-                           gamma);
+    std::vector<std::vector<LookupCommittedTy>> committed_lookups_vec;
+    if constexpr (std::is_same_v<L, LookupPermuted<Poly, Evals>>) {
+      committed_lookups_vec = BatchCommitLookups(
+          prover, std::move(compressed_lookups_vec), beta, gamma);
+    } else {
+      // NOTE(chokobole): The log derivative lookup argument needs only β.
+      committed_lookups_vec =
+          BatchCommitLookups(prover, std::move(compressed_lookups_vec), beta);
+    }
 
     VanishingCommitted<PCS> vanishing_committed;
     CHECK(CommitRandomPoly(prover, &vanishing_committed));
@@ -89,8 +106,8 @@ class Argument {
         argument_data_->ExportPolyTables(absl::MakeConstSpan(*fixed_polys_)));
   }
 
-  template <typename P, typename L, typename V>
-  StepReturns<PermutationEvaluated<Poly>, LookupEvaluated<Poly>,
+  template <typename LookupEvaluatedTy, typename P, typename L, typename V>
+  StepReturns<PermutationEvaluated<Poly>, LookupEvaluatedTy,
               VanishingEvaluated<PCS>>
   EvaluateCircuitStep(ProverBase<PCS>* prover,
                       const ProvingKey<PCS>& proving_key,
@@ -115,7 +132,7 @@ class Argument {
         BatchEvaluatePermutations(prover,
                                   std::move(committed).TakePermutations(), x);
 
-    std::vector<std::vector<LookupEvaluated<Poly>>> evaluated_lookups_vec =
+    std::vector<std::vector<LookupEvaluatedTy>> evaluated_lookups_vec =
         BatchEvaluateLookups(prover, std::move(committed).TakeLookupsVec(), x);
 
     return {std::move(evaluated_permutations), std::move(evaluated_lookups_vec),
@@ -160,12 +177,8 @@ class Argument {
                  std::make_move_iterator(openings.end()));
 
       // Generate openings for lookup columns of the specific circuit.
-      openings = base::FlatMap(
-          evaluated.lookups_vec()[i],
-          [prover, &x, this](const LookupEvaluated<Poly>& evaluated_lookup) {
-            return LookupArgumentRunner<Poly, Evals>::OpenEvaluated(
-                prover, evaluated_lookup, x, opening_points_set_);
-          });
+      openings = OpenLookups(prover, evaluated.lookups_vec()[i], x,
+                             opening_points_set_);
       ret.insert(ret.end(), std::make_move_iterator(openings.begin()),
                  std::make_move_iterator(openings.end()));
     }
@@ -62,11 +62,13 @@ class ArgumentData {
     Synthesizer<PCS> synthesizer(num_circuits, &constraint_system);
     synthesizer.GenerateAdviceColumns(prover, circuits, instance_columns_vec);
 
-    return ArgumentData(std::move(synthesizer).TakeAdviceColumnsVec(),
-                        std::move(synthesizer).TakeAdviceBlindsVec(),
-                        std::move(synthesizer).TakeChallenges(),
-                        std::move(instance_columns_vec),
-                        std::move(instance_polys_vec));
+    ArgumentData ret(std::move(synthesizer).TakeAdviceColumnsVec(),
+                     std::move(synthesizer).TakeAdviceBlindsVec(),
+                     std::move(synthesizer).TakeChallenges(),
+                     std::move(instance_columns_vec),
+                     std::move(instance_polys_vec));
+    ret.advice_polys_vec_ = std::move(synthesizer).TakeAdvicePolysVec();
+    return ret;
   }
 
   size_t GetNumCircuits() const { return instance_columns_vec_.size(); }
@@ -83,9 +85,16 @@ class ArgumentData {
   // Generate a vector of advice coefficient-formed polynomials with a vector
   // of advice evaluation-formed columns. (a.k.a. Batch IFFT)
   // And for memory optimization, every evaluations of advice will be released
-  // as soon as transforming it to coefficient form.
+  // as soon as transforming it to coefficient form. If this was created by
+  // |Create()|, the polynomials were already generated while the advice
+  // columns were committed, so only the evaluations are released.
   void TransformAdvice(const Domain* domain) {
     CHECK(!advice_transformed_);
+    if (!advice_polys_vec_.empty()) {
+      advice_columns_vec_.clear();
+      advice_transformed_ = true;
+      return;
+    }
     advice_polys_vec_ = base::Map(
         advice_columns_vec_, [domain](std::vector<Evals>& advice_columns) {
           return base::Map(advice_columns, [domain](Evals& advice_column) {
@@ -172,6 +181,10 @@ class ArgumentData {
   // evaluations after generating an advice polynomial. That is, when
   // |advice_transformed_| is set to true, |advice_columns_vec_| is
   // released, and only |advice_polys_vec_| becomes available for use.
+  // NOTE(chokobole): |advice_polys_vec_| is filled by |Create()| before
+  // |advice_transformed_| is set, so that the IFFTs overlap with the MSMs of
+  // the advice commitments. This keeps both forms of the advice until
+  // |TransformAdvice()| is called.
   bool advice_transformed_ = false;
   std::vector<std::vector<Evals>> advice_columns_vec_;
   std::vector<std::vector<Poly>> advice_polys_vec_;
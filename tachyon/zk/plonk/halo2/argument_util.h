@@ -2,7 +2,9 @@
 #define TACHYON_ZK_PLONK_HALO2_ARGUMENT_UTIL_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -11,9 +13,13 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/numerics/checked_math.h"
 #include "tachyon/base/ref.h"
+#include "tachyon/base/task_graph.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/base/point_set.h"
+#include "tachyon/zk/lookup/compress_expression.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_argument_runner.h"
 #include "tachyon/zk/lookup/lookup_argument_runner.h"
+#include "tachyon/zk/lookup/permute_expression_pair.h"
 #include "tachyon/zk/plonk/base/ref_table.h"
 #include "tachyon/zk/plonk/constraint_system/constraint_system.h"
 #include "tachyon/zk/plonk/constraint_system/query.h"
@@ -23,6 +29,130 @@
 
 namespace tachyon::zk::halo2 {
 
+// Permutes and commits to the lookups with a |base::TaskGraph|, so that the
+// permutations, the MSMs and the IFFTs of the different lookups overlap. The
+// tasks share the threads of |base::ThreadPool::Current()| with the parallel
+// loops inside them, so this is used regardless of the number of lookups. The
+// random values are drawn and the commitments are written to the proof in the
+// same order as |LookupArgumentRunner::PermuteArgument()| does for each lookup
+// one by one, so the proof is the same.
+template <typename PCS, typename F, typename Evals,
+          typename Poly = typename PCS::Poly>
+std::vector<std::vector<LookupPermuted<Poly, Evals>>>
+PipelinePermuteLookups(ProverBase<PCS>* prover,
+                       const std::vector<LookupArgument<F>>& lookup_arguments,
+                       const std::vector<RefTable<Evals>>& tables,
+                       absl::Span<const F> challenges, const F& theta,
+                       int32_t n) {
+  using Commitment = typename PCS::Commitment;
+
+  struct State {
+    LookupPair<Evals> compressed_evals_pair;
+    LookupPair<Evals> permuted_evals_pair;
+    Commitment permuted_input_commitment;
+    Commitment permuted_table_commitment;
+    Poly permuted_input_poly;
+    Poly permuted_table_poly;
+    F permuted_input_blind;
+    F permuted_table_blind;
+  };
+
+  size_t num_circuits = tables.size();
+  size_t num_lookups = lookup_arguments.size();
+  std::vector<State> states(num_circuits * num_lookups);
+
+  base::TaskGraph graph;
+  std::optional<base::TaskGraph::TaskId> prev_blind;
+  std::optional<base::TaskGraph::TaskId> prev_write;
+  for (size_t i = 0; i < states.size(); ++i) {
+    State* state = &states[i];
+    const RefTable<Evals>* table = &tables[i / num_lookups];
+    const LookupArgument<F>* argument = &lookup_arguments[i % num_lookups];
+
+    base::TaskGraph::TaskId permute = graph.AddTask([prover, challenges,
+                                                     &theta, n, state, table,
+                                                     argument]() {
+      SimpleEvaluator<Evals> evaluator(0, n, 1, *table, challenges);
+      // A_compressed(X) = θᵐ⁻¹A₀(X) + θᵐ⁻²A₁(X) + ... + θAₘ₋₂(X) + Aₘ₋₁(X)
+      // S_compressed(X) = θᵐ⁻¹S₀(X) + θᵐ⁻²S₁(X) + ... + θSₘ₋₂(X) + Sₘ₋₁(X)
+      state->compressed_evals_pair = {
+          CompressExpressions(prover->domain(), argument->input_expressions(),
+                              theta, evaluator),
+          CompressExpressions(prover->domain(), argument->table_expressions(),
+                              theta, evaluator)};
+      CHECK(PermuteExpressionPairWithoutBlinding(
+          prover, state->compressed_evals_pair, &state->permuted_evals_pair));
+    });
+
+    // NOTE(chokobole): The blinding tasks are chained, because they share the
+    // random number generator of |prover|.
+    std::vector<base::TaskGraph::TaskId> blind_dependencies = {permute};
+    if (prev_blind.has_value()) blind_dependencies.push_back(*prev_blind);
+    base::TaskGraph::TaskId blind = graph.AddTask(
+        [prover, state]() {
+          BlindPermutedExpressionPair(prover, &state->permuted_evals_pair);
+          state->permuted_input_blind = prover->blinder().Generate();
+          state->permuted_table_blind = prover->blinder().Generate();
+        },
+        blind_dependencies);
+    prev_blind = blind;
+
+    // Commit(A'(X)), Commit(S'(X))
+    base::TaskGraph::TaskId commit_input = graph.AddTask(
+        [prover, state]() {
+          state->permuted_input_commitment =
+              prover->Commit(state->permuted_evals_pair.input());
+        },
+        {blind});
+    base::TaskGraph::TaskId commit_table = graph.AddTask(
+        [prover, state]() {
+          state->permuted_table_commitment =
+              prover->Commit(state->permuted_evals_pair.table());
+        },
+        {blind});
+    graph.AddTask(
+        [prover, state]() {
+          state->permuted_input_poly =
+              prover->domain()->IFFT(state->permuted_evals_pair.input());
+        },
+        {blind});
+    graph.AddTask(
+        [prover, state]() {
+          state->permuted_table_poly =
+              prover->domain()->IFFT(state->permuted_evals_pair.table());
+        },
+        {blind});
+
+    // NOTE(chokobole): The writing tasks are chained as well to keep the order
+    // of the proof.
+    std::vector<base::TaskGraph::TaskId> write_dependencies = {commit_input,
+                                                               commit_table};
+    if (prev_write.has_value()) write_dependencies.push_back(*prev_write);
+    prev_write = graph.AddTask(
+        [prover, state]() {
+          CHECK(prover->GetWriter()->WriteToProof(
+              state->permuted_input_commitment));
+          CHECK(prover->GetWriter()->WriteToProof(
+              state->permuted_table_commitment));
+        },
+        write_dependencies);
+  }
+  graph.Run();
+
+  return base::CreateVector(num_circuits, [num_lookups, &states](size_t i) {
+    return base::CreateVector(num_lookups, [num_lookups, &states, i](size_t j) {
+      State& state = states[i * num_lookups + j];
+      return LookupPermuted<Poly, Evals>(
+          std::move(state.compressed_evals_pair),
+          std::move(state.permuted_evals_pair),
+          {std::move(state.permuted_input_poly),
+           std::move(state.permuted_input_blind)},
+          {std::move(state.permuted_table_poly),
+           std::move(state.permuted_table_blind)});
+    });
+  });
+}
+
 template <typename PCS, typename F, typename Evals,
           typename Poly = typename PCS::Poly>
 std::vector<std::vector<LookupPermuted<Poly, Evals>>> BatchPermuteLookups(
@@ -30,6 +160,20 @@ std::vector<std::vector<LookupPermuted<Poly, Evals>>> BatchPermuteLookups(
     const std::vector<LookupArgument<F>>& lookup_arguments,
     const std::vector<RefTable<Evals>>& tables, absl::Span<const F> challenges,
     const F& theta) {
+  base::CheckedNumeric<int32_t> n_tmp = prover->pcs().N();
+  int32_t n = n_tmp.ValueOrDie();
+  return PipelinePermuteLookups(prover, lookup_arguments, tables, challenges,
+                                theta, n);
+}
+
+template <typename PCS, typename F, typename Evals,
+          typename Poly = typename PCS::Poly>
+std::vector<std::vector<LogDerivativeLookupPrepared<Poly, Evals>>>
+BatchPrepareLogDerivativeLookups(
+    ProverBase<PCS>* prover,
+    const std::vector<LogDerivativeLookupArgument<F>>& lookup_arguments,
+    const std::vector<RefTable<Evals>>& tables, absl::Span<const F> challenges,
+    const F& theta) {
   size_t num_circuits = tables.size();
   base::CheckedNumeric<int32_t> n_tmp = prover->pcs().N();
   int32_t n = n_tmp.ValueOrDie();
@@ -38,11 +182,13 @@ std::vector<std::vector<LookupPermuted<Poly, Evals>>> BatchPermuteLookups(
                                            n](size_t i) {
     const RefTable<Evals>& table = tables[i];
     return base::Map(
-        lookup_arguments, [prover, challenges, &table, &theta,
-                           n](const LookupArgument<F>& lookup_argument) {
+        lookup_arguments,
+        [prover, challenges, &table, &theta,
+         n](const LogDerivativeLookupArgument<F>& lookup_argument) {
           SimpleEvaluator<Evals> simple_evaluator(0, n, 1, table, challenges);
-          return LookupArgumentRunner<Poly, Evals>::PermuteArgument(
-              prover, lookup_argument, theta, simple_evaluator);
+          return LogDerivativeLookupArgumentRunner<Poly, Evals>::
+              PrepareArgument(prover, lookup_argument, theta,
+                              simple_evaluator);
         });
   });
 }
@@ -67,6 +213,27 @@ std::vector<std::vector<LookupCommitted<Poly>>> BatchCommitLookups(
       });
 }
 
+template <typename PCS, typename Poly, typename Evals, typename F>
+std::vector<std::vector<LogDerivativeLookupCommitted<Poly>>>
+BatchCommitLookups(
+    ProverBase<PCS>* prover,
+    std::vector<std::vector<LogDerivativeLookupPrepared<Poly, Evals>>>&&
+        prepared_lookups_vec,
+    const F& beta) {
+  return base::Map(
+      prepared_lookups_vec,
+      [prover, &beta](std::vector<LogDerivativeLookupPrepared<Poly, Evals>>&
+                          prepared_lookups) {
+        return base::Map(
+            prepared_lookups,
+            [prover,
+             &beta](LogDerivativeLookupPrepared<Poly, Evals>& prepared_lookup) {
+              return LogDerivativeLookupArgumentRunner<Poly, Evals>::
+                  CommitPrepared(prover, std::move(prepared_lookup), beta);
+            });
+      });
+}
+
 template <typename PCS, typename Poly, typename F>
 std::vector<std::vector<LookupEvaluated<Poly>>> BatchEvaluateLookups(
     ProverBase<PCS>* prover,
@@ -84,6 +251,55 @@ std::vector<std::vector<LookupEvaluated<Poly>>> BatchEvaluateLookups(
       });
 }
 
+template <typename PCS, typename Poly, typename F>
+std::vector<std::vector<LogDerivativeLookupEvaluated<Poly>>>
+BatchEvaluateLookups(
+    ProverBase<PCS>* prover,
+    std::vector<std::vector<LogDerivativeLookupCommitted<Poly>>>&&
+        committed_lookups_vec,
+    const F& x) {
+  using Evals = typename PCS::Evals;
+
+  return base::Map(
+      committed_lookups_vec,
+      [prover,
+       &x](std::vector<LogDerivativeLookupCommitted<Poly>>& committed_lookups) {
+        return base::Map(
+            committed_lookups,
+            [prover, &x](LogDerivativeLookupCommitted<Poly>& committed_lookup) {
+              return LogDerivativeLookupArgumentRunner<Poly, Evals>::
+                  EvaluateCommitted(prover, std::move(committed_lookup), x);
+            });
+      });
+}
+
+template <typename PCS, typename Poly, typename F>
+std::vector<crypto::PolynomialOpening<Poly>> OpenLookups(
+    const ProverBase<PCS>* prover,
+    const std::vector<LookupEvaluated<Poly>>& evaluated_lookups, const F& x,
+    PointSet<F>& points) {
+  return base::FlatMap(
+      evaluated_lookups,
+      [prover, &x, &points](const LookupEvaluated<Poly>& evaluated_lookup) {
+        return LookupArgumentRunner<Poly, typename PCS::Evals>::OpenEvaluated(
+            prover, evaluated_lookup, x, points);
+      });
+}
+
+template <typename PCS, typename Poly, typename F>
+std::vector<crypto::PolynomialOpening<Poly>> OpenLookups(
+    const ProverBase<PCS>* prover,
+    const std::vector<LogDerivativeLookupEvaluated<Poly>>& evaluated_lookups,
+    const F& x, PointSet<F>& points) {
+  return base::FlatMap(
+      evaluated_lookups,
+      [prover, &x,
+       &points](const LogDerivativeLookupEvaluated<Poly>& evaluated_lookup) {
+        return LogDerivativeLookupArgumentRunner<Poly, typename PCS::Evals>::
+            OpenEvaluated(prover, evaluated_lookup, x, points);
+      });
+}
+
 template <typename PCS, typename Poly, typename Evals, typename F>
 std::vector<PermutationCommitted<Poly>> BatchCommitPermutations(
     ProverBase<PCS>* prover, const PermutationArgument& permutation_argument,
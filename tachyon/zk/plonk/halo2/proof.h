@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "tachyon/base/json/json.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_verification_data.h"
 #include "tachyon/zk/lookup/lookup_pair.h"
 #include "tachyon/zk/lookup/lookup_verification_data.h"
 #include "tachyon/zk/plonk/permutation/permutation_verification_data.h"
@@ -42,6 +43,16 @@ struct Proof {
   std::vector<std::vector<F>> lookup_permuted_input_evals_vec;
   std::vector<std::vector<F>> lookup_permuted_input_inv_evals_vec;
   std::vector<std::vector<F>> lookup_permuted_table_evals_vec;
+  // NOTE(chokobole): The fields below are filled only if the lookup type of
+  // the constraint system is |LookupType::kLogDerivative|. Then the fields of
+  // the halo2 lookup argument above are left empty. The multiplicity fields
+  // have an element per |LogDerivativeLookupArgument|, while the grand sum
+  // fields have an element per chunk of them in order.
+  std::vector<std::vector<C>> lookup_multiplicity_commitments_vec;
+  std::vector<std::vector<C>> lookup_grand_sum_commitments_vec;
+  std::vector<std::vector<F>> lookup_grand_sum_evals_vec;
+  std::vector<std::vector<F>> lookup_grand_sum_next_evals_vec;
+  std::vector<std::vector<F>> lookup_multiplicity_evals_vec;
 
   // auxiliary values
   F l_first;
@@ -85,7 +96,15 @@ struct Proof {
            lookup_permuted_input_inv_evals_vec ==
                other.lookup_permuted_input_inv_evals_vec &&
            lookup_permuted_table_evals_vec ==
-               other.lookup_permuted_table_evals_vec;
+               other.lookup_permuted_table_evals_vec &&
+           lookup_multiplicity_commitments_vec ==
+               other.lookup_multiplicity_commitments_vec &&
+           lookup_grand_sum_commitments_vec ==
+               other.lookup_grand_sum_commitments_vec &&
+           lookup_grand_sum_evals_vec == other.lookup_grand_sum_evals_vec &&
+           lookup_grand_sum_next_evals_vec ==
+               other.lookup_grand_sum_next_evals_vec &&
+           lookup_multiplicity_evals_vec == other.lookup_multiplicity_evals_vec;
   }
   bool operator!=(const Proof& other) const { return !operator==(other); }
 
@@ -149,6 +168,33 @@ struct Proof {
     ret.l_last = &l_last;
     return ret;
   }
+
+  LogDerivativeLookupVerificationData<F, C>
+  ToLogDerivativeLookupVerificationData(size_t i, size_t j,
+                                        size_t grand_sum_offset,
+                                        size_t num_chunks) const {
+    LogDerivativeLookupVerificationData<F, C> ret;
+    ret.fixed_evals = absl::MakeConstSpan(fixed_evals);
+    ret.advice_evals = absl::MakeConstSpan(advice_evals_vec[i]);
+    ret.instance_evals = absl::MakeConstSpan(instance_evals_vec[i]);
+    ret.challenges = absl::MakeConstSpan(challenges);
+    ret.multiplicity_commitment = &lookup_multiplicity_commitments_vec[i][j];
+    ret.multiplicity_eval = &lookup_multiplicity_evals_vec[i][j];
+    ret.grand_sum_commitments = absl::MakeConstSpan(
+        &lookup_grand_sum_commitments_vec[i][grand_sum_offset], num_chunks);
+    ret.grand_sum_evals = absl::MakeConstSpan(
+        &lookup_grand_sum_evals_vec[i][grand_sum_offset], num_chunks);
+    ret.grand_sum_next_evals = absl::MakeConstSpan(
+        &lookup_grand_sum_next_evals_vec[i][grand_sum_offset], num_chunks);
+    ret.theta = &theta;
+    ret.beta = &beta;
+    ret.x = &x;
+    ret.x_next = &x_next;
+    ret.l_first = &l_first;
+    ret.l_blind = &l_blind;
+    ret.l_last = &l_last;
+    return ret;
+  }
 };
 
 }  // namespace zk::halo2
@@ -205,6 +251,16 @@ class RapidJsonValueConverter<zk::halo2::Proof<F, C>> {
                    value.lookup_permuted_input_inv_evals_vec, allocator);
     AddJsonElement(object, "lookup_permuted_table_evals_vec",
                    value.lookup_permuted_table_evals_vec, allocator);
+    AddJsonElement(object, "lookup_multiplicity_commitments_vec",
+                   value.lookup_multiplicity_commitments_vec, allocator);
+    AddJsonElement(object, "lookup_grand_sum_commitments_vec",
+                   value.lookup_grand_sum_commitments_vec, allocator);
+    AddJsonElement(object, "lookup_grand_sum_evals_vec",
+                   value.lookup_grand_sum_evals_vec, allocator);
+    AddJsonElement(object, "lookup_grand_sum_next_evals_vec",
+                   value.lookup_grand_sum_next_evals_vec, allocator);
+    AddJsonElement(object, "lookup_multiplicity_evals_vec",
+                   value.lookup_multiplicity_evals_vec, allocator);
     return object;
   }
 
@@ -285,6 +341,21 @@ class RapidJsonValueConverter<zk::halo2::Proof<F, C>> {
     if (!ParseJsonElement(json_value, "lookup_permuted_table_evals_vec",
                           &proof.lookup_permuted_table_evals_vec, error))
       return false;
+    if (!ParseJsonElement(json_value, "lookup_multiplicity_commitments_vec",
+                          &proof.lookup_multiplicity_commitments_vec, error))
+      return false;
+    if (!ParseJsonElement(json_value, "lookup_grand_sum_commitments_vec",
+                          &proof.lookup_grand_sum_commitments_vec, error))
+      return false;
+    if (!ParseJsonElement(json_value, "lookup_grand_sum_evals_vec",
+                          &proof.lookup_grand_sum_evals_vec, error))
+      return false;
+    if (!ParseJsonElement(json_value, "lookup_grand_sum_next_evals_vec",
+                          &proof.lookup_grand_sum_next_evals_vec, error))
+      return false;
+    if (!ParseJsonElement(json_value, "lookup_multiplicity_evals_vec",
+                          &proof.lookup_multiplicity_evals_vec, error))
+      return false;
 
     *proof_out = std::move(proof);
     return true;
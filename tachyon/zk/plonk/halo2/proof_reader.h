@@ -48,7 +48,7 @@ class ProofReader {
   const Proof<F, C>& proof() const { return proof_; }
   Proof<F, C>& proof() { return proof_; }
 
-  void ReadAdviceCommitmentsVecAndChallenges() {
+  [[nodiscard]] bool ReadAdviceCommitmentsVecAndChallenges() {
     CHECK_EQ(cursor_, ProofCursor::kAdviceCommitmentsVecAndChallenges);
     const ConstraintSystem<F>& constraint_system =
         verifying_key_.constraint_system();
@@ -73,15 +73,17 @@ class ProofReader {
       }
     }
     cursor_ = ProofCursor::kTheta;
+    return !failed_;
   }
 
-  void ReadTheta() {
+  [[nodiscard]] bool ReadTheta() {
     CHECK_EQ(cursor_, ProofCursor::kTheta);
     proof_.theta = transcript_->SqueezeChallenge();
     cursor_ = ProofCursor::kLookupPermutedCommitments;
+    return !failed_;
   }
 
-  void ReadLookupPermutedCommitments() {
+  [[nodiscard]] bool ReadLookupPermutedCommitments() {
     CHECK_EQ(cursor_, ProofCursor::kLookupPermutedCommitments);
     size_t num_lookups = verifying_key_.constraint_system().lookups().size();
     proof_.lookup_permuted_commitments_vec =
@@ -93,16 +95,33 @@ class ProofReader {
           });
         });
     cursor_ = ProofCursor::kBetaAndGamma;
+    return !failed_;
   }
 
-  void ReadBetaAndGamma() {
+  // NOTE(chokobole): The log derivative lookup argument shares the cursors
+  // with the halo2 lookup argument. The multiplicity commitments take the place
+  // of the permuted commitments and the grand sum commitments take the place of
+  // the product commitments.
+  [[nodiscard]] bool ReadLookupMultiplicityCommitments() {
+    CHECK_EQ(cursor_, ProofCursor::kLookupPermutedCommitments);
+    size_t num_lookups =
+        verifying_key_.constraint_system().ComputeLogDerivativeLookups().size();
+    proof_.lookup_multiplicity_commitments_vec = base::CreateVector(
+        num_circuits_,
+        [this, num_lookups]() { return ReadMany<C>(num_lookups); });
+    cursor_ = ProofCursor::kBetaAndGamma;
+    return !failed_;
+  }
+
+  [[nodiscard]] bool ReadBetaAndGamma() {
     CHECK_EQ(cursor_, ProofCursor::kBetaAndGamma);
     proof_.beta = transcript_->SqueezeChallenge();
     proof_.gamma = transcript_->SqueezeChallenge();
     cursor_ = ProofCursor::kPermutationProductCommitments;
+    return !failed_;
   }
 
-  void ReadPermutationProductCommitments() {
+  [[nodiscard]] bool ReadPermutationProductCommitments() {
     CHECK_EQ(cursor_, ProofCursor::kPermutationProductCommitments);
     const ConstraintSystem<F>& constraint_system =
         verifying_key_.constraint_system();
@@ -111,59 +130,79 @@ class ProofReader {
         num_circuits_,
         [this, num_products]() { return ReadMany<C>(num_products); });
     cursor_ = ProofCursor::kLookupProductCommitments;
+    return !failed_;
   }
 
-  void ReadLookupProductCommitments() {
+  [[nodiscard]] bool ReadLookupProductCommitments() {
     CHECK_EQ(cursor_, ProofCursor::kLookupProductCommitments);
     size_t num_lookups = verifying_key_.constraint_system().lookups().size();
     proof_.lookup_product_commitments_vec = base::CreateVector(
         num_circuits_,
         [this, num_lookups]() { return ReadMany<C>(num_lookups); });
     cursor_ = ProofCursor::kVanishingRandomPolyCommitment;
+    return !failed_;
+  }
+
+  [[nodiscard]] bool ReadLookupGrandSumCommitments() {
+    CHECK_EQ(cursor_, ProofCursor::kLookupProductCommitments);
+    size_t num_grand_sums = verifying_key_.constraint_system()
+                                .ComputeLogDerivativeLookupGrandSumNums();
+    proof_.lookup_grand_sum_commitments_vec = base::CreateVector(
+        num_circuits_,
+        [this, num_grand_sums]() { return ReadMany<C>(num_grand_sums); });
+    cursor_ = ProofCursor::kVanishingRandomPolyCommitment;
+    return !failed_;
   }
 
-  void ReadVanishingRandomPolyCommitment() {
+  [[nodiscard]] bool ReadVanishingRandomPolyCommitment() {
     CHECK_EQ(cursor_, ProofCursor::kVanishingRandomPolyCommitment);
     proof_.vanishing_random_poly_commitment = Read<C>();
     cursor_ = ProofCursor::kY;
+    return !failed_;
   }
 
-  void ReadY() {
+  [[nodiscard]] bool ReadY() {
     CHECK_EQ(cursor_, ProofCursor::kY);
     proof_.y = transcript_->SqueezeChallenge();
     cursor_ = ProofCursor::kVanishingHPolyCommitments;
+    return !failed_;
   }
 
-  void ReadVanishingHPolyCommitments() {
+  [[nodiscard]] bool ReadVanishingHPolyCommitments() {
     CHECK_EQ(cursor_, ProofCursor::kVanishingHPolyCommitments);
     size_t quotient_poly_degree =
         verifying_key_.constraint_system().ComputeDegree() - 1;
     proof_.vanishing_h_poly_commitments = ReadMany<C>(quotient_poly_degree);
     cursor_ = ProofCursor::kX;
+    return !failed_;
   }
 
-  void ReadX() {
+  [[nodiscard]] bool ReadX() {
     CHECK_EQ(cursor_, ProofCursor::kX);
     proof_.x = transcript_->SqueezeChallenge();
     cursor_ = ProofCursor::kInstanceEvals;
+    return !failed_;
   }
 
-  void ReadInstanceEvalsIfQueryInstance() {
+  [[nodiscard]] bool ReadInstanceEvalsIfQueryInstance() {
     CHECK_EQ(cursor_, ProofCursor::kInstanceEvals);
     size_t num_instance_queries =
         verifying_key_.constraint_system().instance_queries().size();
-    return base::CreateVector(num_circuits_, [this, num_instance_queries]() {
-      return ReadMany<F>(num_instance_queries);
-    });
+    proof_.instance_evals_vec =
+        base::CreateVector(num_circuits_, [this, num_instance_queries]() {
+          return ReadMany<F>(num_instance_queries);
+        });
     cursor_ = ProofCursor::kAdviceEvals;
+    return !failed_;
   }
 
-  void ReadInstanceEvalsIfNoQueryInstance() {
+  [[nodiscard]] bool ReadInstanceEvalsIfNoQueryInstance() {
     CHECK_EQ(cursor_, ProofCursor::kInstanceEvals);
     cursor_ = ProofCursor::kAdviceEvals;
+    return !failed_;
   }
 
-  void ReadAdviceEvals() {
+  [[nodiscard]] bool ReadAdviceEvals() {
     CHECK_EQ(cursor_, ProofCursor::kAdviceEvals);
     size_t num_advice_queries =
         verifying_key_.constraint_system().advice_queries().size();
@@ -172,30 +211,34 @@ class ProofReader {
           return ReadMany<F>(num_advice_queries);
         });
     cursor_ = ProofCursor::kFixedEvals;
+    return !failed_;
   }
 
-  void ReadFixedEvals() {
+  [[nodiscard]] bool ReadFixedEvals() {
     CHECK_EQ(cursor_, ProofCursor::kFixedEvals);
     size_t num_fixed_queries =
         verifying_key_.constraint_system().fixed_queries().size();
     proof_.fixed_evals = ReadMany<F>(num_fixed_queries);
     cursor_ = ProofCursor::kVanishingRandomEval;
+    return !failed_;
   }
 
-  void ReadVanishingRandomEval() {
+  [[nodiscard]] bool ReadVanishingRandomEval() {
     CHECK_EQ(cursor_, ProofCursor::kVanishingRandomEval);
     proof_.vanishing_random_eval = Read<F>();
     cursor_ = ProofCursor::kCommonPermutationEvals;
+    return !failed_;
   }
 
-  void ReadCommonPermutationEvals() {
+  [[nodiscard]] bool ReadCommonPermutationEvals() {
     CHECK_EQ(cursor_, ProofCursor::kCommonPermutationEvals);
     proof_.common_permutation_evals = ReadMany<F>(
         verifying_key_.permutation_verifying_key().commitments().size());
     cursor_ = ProofCursor::kPermutationEvals;
+    return !failed_;
   }
 
-  void ReadPermutationEvals() {
+  [[nodiscard]] bool ReadPermutationEvals() {
     CHECK_EQ(cursor_, ProofCursor::kPermutationEvals);
     proof_.permutation_product_evals_vec.resize(num_circuits_);
     proof_.permutation_product_next_evals_vec.resize(num_circuits_);
@@ -213,9 +256,10 @@ class ProofReader {
       }
     }
     cursor_ = ProofCursor::kLookupEvalsVec;
+    return !failed_;
   }
 
-  void ReadLookupEvals() {
+  [[nodiscard]] bool ReadLookupEvals() {
     CHECK_EQ(cursor_, ProofCursor::kLookupEvalsVec);
     proof_.lookup_product_evals_vec.resize(num_circuits_);
     proof_.lookup_product_next_evals_vec.resize(num_circuits_);
@@ -238,13 +282,44 @@ class ProofReader {
       }
     }
     // TODO(chokobole): Implement reading data for the last pairing step.
+    return !failed_;
+  }
+
+  [[nodiscard]] bool ReadLogDerivativeLookupEvals() {
+    CHECK_EQ(cursor_, ProofCursor::kLookupEvalsVec);
+    proof_.lookup_grand_sum_evals_vec.resize(num_circuits_);
+    proof_.lookup_grand_sum_next_evals_vec.resize(num_circuits_);
+    proof_.lookup_multiplicity_evals_vec.resize(num_circuits_);
+    std::vector<LogDerivativeLookupArgument<F>> arguments =
+        verifying_key_.constraint_system().ComputeLogDerivativeLookups();
+    for (size_t i = 0; i < num_circuits_; ++i) {
+      size_t num_grand_sums = proof_.lookup_grand_sum_commitments_vec[i].size();
+      proof_.lookup_grand_sum_evals_vec[i].reserve(num_grand_sums);
+      proof_.lookup_grand_sum_next_evals_vec[i].reserve(num_grand_sums);
+      proof_.lookup_multiplicity_evals_vec[i].reserve(arguments.size());
+      for (const LogDerivativeLookupArgument<F>& argument : arguments) {
+        for (size_t k = 0; k < argument.num_chunks(); ++k) {
+          proof_.lookup_grand_sum_evals_vec[i].push_back(Read<F>());
+          proof_.lookup_grand_sum_next_evals_vec[i].push_back(Read<F>());
+        }
+        proof_.lookup_multiplicity_evals_vec[i].push_back(Read<F>());
+      }
+    }
+    return !failed_;
   }
 
  private:
+  // NOTE(chokobole): Once a read fails, the following reads are skipped and
+  // every step returns false so that a malformed proof is rejected rather than
+  // aborting the verifier.
   template <typename T>
   T Read() {
     T value;
-    CHECK(transcript_->ReadFromProof(&value));
+    if (failed_) return value;
+    if (!transcript_->ReadFromProof(&value)) {
+      LOG(ERROR) << "Failed to read from proof";
+      failed_ = true;
+    }
     return value;
   }
 
@@ -259,6 +334,7 @@ class ProofReader {
   size_t num_circuits_ = 0;
   Proof<F, C> proof_;
   ProofCursor cursor_ = ProofCursor::kAdviceCommitmentsVecAndChallenges;
+  bool failed_ = false;
 };
 
 }  // namespace tachyon::zk::halo2
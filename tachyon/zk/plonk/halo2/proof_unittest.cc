@@ -87,6 +87,16 @@ TEST(ProofTest, JsonValueConverter) {
       CreateRandomElementsVec<F>(num_circuits_, num_elements_);
   expected_proof.lookup_permuted_table_evals_vec =
       CreateRandomElementsVec<F>(num_circuits_, num_elements_);
+  expected_proof.lookup_multiplicity_commitments_vec =
+      CreateRandomElementsVec<Commitment>(num_circuits_, num_elements_);
+  expected_proof.lookup_grand_sum_commitments_vec =
+      CreateRandomElementsVec<Commitment>(num_circuits_, num_elements_);
+  expected_proof.lookup_grand_sum_evals_vec =
+      CreateRandomElementsVec<F>(num_circuits_, num_elements_);
+  expected_proof.lookup_grand_sum_next_evals_vec =
+      CreateRandomElementsVec<F>(num_circuits_, num_elements_);
+  expected_proof.lookup_multiplicity_evals_vec =
+      CreateRandomElementsVec<F>(num_circuits_, num_elements_);
   std::string json = base::WriteToJson(expected_proof);
 
   Proof<F, Commitment> proof;
@@ -121,6 +121,25 @@ class Prover : public ProverBase<PCS> {
 
   void CreateProof(const ProvingKey<PCS>& proving_key,
                    ArgumentData<PCS>* argument_data) {
+    switch (proving_key.verifying_key().constraint_system().lookup_type()) {
+      case LookupType::kHalo2:
+        DoCreateProof<LookupPermuted<Poly, Evals>, LookupCommitted<Poly>,
+                      LookupEvaluated<Poly>>(proving_key, argument_data);
+        return;
+      case LookupType::kLogDerivative:
+        DoCreateProof<LogDerivativeLookupPrepared<Poly, Evals>,
+                      LogDerivativeLookupCommitted<Poly>,
+                      LogDerivativeLookupEvaluated<Poly>>(proving_key,
+                                                          argument_data);
+        return;
+    }
+    NOTREACHED();
+  }
+
+  template <typename LookupCompressedTy, typename LookupCommittedTy,
+            typename LookupEvaluatedTy>
+  void DoCreateProof(const ProvingKey<PCS>& proving_key,
+                     ArgumentData<PCS>* argument_data) {
     Argument<PCS> argument(&proving_key.fixed_columns(),
                            &proving_key.fixed_polys(), argument_data);
 
@@ -128,18 +147,21 @@ class Prover : public ProverBase<PCS> {
     auto state =
         reinterpret_cast<halo2::Blake2bWriter<Commitment>*>(writer)->GetState();
     F theta = writer->SqueezeChallenge();
-    std::vector<std::vector<LookupPermuted<Poly, Evals>>> permuted_lookups_vec =
-        argument.CompressLookupStep(
+    std::vector<std::vector<LookupCompressedTy>> compressed_lookups_vec =
+        argument.template CompressLookupStep<LookupCompressedTy>(
             this, proving_key.verifying_key().constraint_system(), theta);
 
+    // NOTE(chokobole): γ is squeezed even if the log derivative lookup
+    // argument is used, because the permutation argument needs it.
     F beta = writer->SqueezeChallenge();
     F gamma = writer->SqueezeChallenge();
-    StepReturns<PermutationCommitted<Poly>, LookupCommitted<Poly>,
+    StepReturns<PermutationCommitted<Poly>, LookupCommittedTy,
                 VanishingCommitted<PCS>>
-        committed_result = argument.CommitCircuitStep(
-            this, proving_key.verifying_key().constraint_system(),
-            proving_key.permutation_proving_key(),
-            std::move(permuted_lookups_vec), beta, gamma);
+        committed_result =
+            argument.template CommitCircuitStep<LookupCommittedTy>(
+                this, proving_key.verifying_key().constraint_system(),
+                proving_key.permutation_proving_key(),
+                std::move(compressed_lookups_vec), beta, gamma);
 
     F y = writer->SqueezeChallenge();
     argument.TransformAdvice(this->domain());
@@ -151,11 +173,12 @@ class Prover : public ProverBase<PCS> {
                            &constructed_vanishing));
 
     F x = writer->SqueezeChallenge();
-    StepReturns<PermutationEvaluated<Poly>, LookupEvaluated<Poly>,
+    StepReturns<PermutationEvaluated<Poly>, LookupEvaluatedTy,
                 VanishingEvaluated<PCS>>
         evaluated_result =
-            argument.EvaluateCircuitStep(this, proving_key, committed_result,
-                                         std::move(constructed_vanishing), x);
+            argument.template EvaluateCircuitStep<LookupEvaluatedTy>(
+                this, proving_key, committed_result,
+                std::move(constructed_vanishing), x);
 
     std::vector<crypto::PolynomialOpening<Poly>> openings =
         argument.ConstructOpenings(this, proving_key, evaluated_result, x);
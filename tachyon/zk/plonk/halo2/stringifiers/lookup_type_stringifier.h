@@ -0,0 +1,22 @@
+#ifndef TACHYON_ZK_PLONK_HALO2_STRINGIFIERS_LOOKUP_TYPE_STRINGIFIER_H_
+#define TACHYON_ZK_PLONK_HALO2_STRINGIFIERS_LOOKUP_TYPE_STRINGIFIER_H_
+
+#include <ostream>
+
+#include "tachyon/base/strings/rust_stringifier.h"
+#include "tachyon/zk/lookup/lookup_type.h"
+
+namespace tachyon::base::internal {
+
+template <>
+class RustDebugStringifier<zk::LookupType> {
+ public:
+  static std::ostream& AppendToStream(std::ostream& os, RustFormatter& fmt,
+                                      zk::LookupType type) {
+    return os << zk::LookupTypeToString(type);
+  }
+};
+
+}  // namespace tachyon::base::internal
+
+#endif  // TACHYON_ZK_PLONK_HALO2_STRINGIFIERS_LOOKUP_TYPE_STRINGIFIER_H_
@@ -7,10 +7,12 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_SYNTHESIZER_H_
 #define TACHYON_ZK_PLONK_HALO2_SYNTHESIZER_H_
 
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/task_graph.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/plonk/constraint_system/constraint_system.h"
 #include "tachyon/zk/plonk/halo2/witness_collection.h"
@@ -21,6 +23,7 @@ template <typename PCS>
 class Synthesizer {
  public:
   using F = typename PCS::Field;
+  using Commitment = typename PCS::Commitment;
   using Poly = typename PCS::Poly;
   using Evals = typename PCS::Evals;
   using RationalEvals = typename PCS::RationalEvals;
@@ -29,11 +32,14 @@ class Synthesizer {
   Synthesizer(size_t num_circuits, const ConstraintSystem<F>* constraint_system)
       : num_circuits_(num_circuits), constraint_system_(constraint_system) {
     advice_columns_vec_.resize(num_circuits_);
+    advice_polys_vec_.resize(num_circuits_);
     advice_blinds_vec_.resize(num_circuits_);
     for (size_t i = 0; i < num_circuits_; ++i) {
       // And these may be assigned with random order.
       advice_columns_vec_[i] = base::CreateVector(
           constraint_system->num_advice_columns(), Evals::Zero());
+      advice_polys_vec_[i] = base::CreateVector(
+          constraint_system->num_advice_columns(), Poly::Zero());
       advice_blinds_vec_[i] = base::CreateVector(
           constraint_system->num_advice_columns(), F::Zero());
     }
@@ -56,6 +62,8 @@ class Synthesizer {
                                  num_circuits_);
     }
     for (Phase current_phase : constraint_system_->GetPhases()) {
+      std::vector<Evals> phase_advice_columns;
+      std::vector<std::pair<size_t, size_t>> phase_advice_indices;
       for (size_t i = 0; i < num_circuits_; ++i) {
         std::vector<RationalEvals> rational_advice_columns =
             GenerateRationalAdvices(prover, current_phase,
@@ -74,16 +82,19 @@ class Synthesizer {
           // Add blinding factors to advice columns
           evaluated[prover->pcs().N() - 1] = F::One();
 
-          Evals evaluated_evals(std::move(evaluated));
-          if constexpr (PCS::kSupportsBatchMode) {
-            prover->BatchCommitAt(evaluated_evals, write_idx++);
-          } else {
-            prover->CommitAndWriteToProof(evaluated_evals);
-          }
-          SetAdviceColumn(i, j, std::move(evaluated_evals),
-                          prover->blinder().Generate());
+          phase_advice_columns.push_back(Evals(std::move(evaluated)));
+          phase_advice_indices.emplace_back(i, j);
         }
       }
+      std::vector<Poly> phase_advice_polys =
+          CommitAdviceColumns(prover, phase_advice_columns, write_idx);
+      write_idx += phase_advice_columns.size();
+      for (size_t k = 0; k < phase_advice_columns.size(); ++k) {
+        const auto& [i, j] = phase_advice_indices[k];
+        SetAdviceColumn(i, j, std::move(phase_advice_columns[k]),
+                        std::move(phase_advice_polys[k]),
+                        prover->blinder().Generate());
+      }
       UpdateChallenges(prover, current_phase);
     }
     if constexpr (PCS::kSupportsBatchMode) {
@@ -109,19 +120,69 @@ class Synthesizer {
   std::vector<std::vector<Evals>>&& TakeAdviceColumnsVec() && {
     return std::move(advice_columns_vec_);
   };
+  std::vector<std::vector<Poly>>&& TakeAdvicePolysVec() && {
+    return std::move(advice_polys_vec_);
+  };
   std::vector<std::vector<F>>&& TakeAdviceBlindsVec() && {
     return std::move(advice_blinds_vec_);
   };
 
  private:
   void SetAdviceColumn(size_t circuit_idx, size_t column_idx, Evals&& column,
-                       F&& blind) {
+                       Poly&& poly, F&& blind) {
     CHECK_LT(circuit_idx, num_circuits_);
     CHECK_LT(column_idx, constraint_system_->num_advice_columns());
     advice_columns_vec_[circuit_idx][column_idx] = std::move(column);
+    advice_polys_vec_[circuit_idx][column_idx] = std::move(poly);
     advice_blinds_vec_[circuit_idx][column_idx] = std::move(blind);
   }
 
+  // Commits to |columns| and returns their polynomials in coefficient form.
+  // The MSMs and the IFFTs of the columns run on a |base::TaskGraph|, so that
+  // they overlap. The commitments are written to the proof in the order of
+  // |columns|. In batch mode, they are stored starting at |write_idx| and
+  // written later.
+  static std::vector<Poly> CommitAdviceColumns(
+      ProverBase<PCS>* prover, const std::vector<Evals>& columns,
+      size_t write_idx) {
+    std::vector<Poly> polys(columns.size());
+    std::vector<Commitment> commitments;
+    base::TaskGraph graph;
+    if constexpr (PCS::kSupportsBatchMode) {
+      // NOTE(chokobole): In batch mode, the advice columns of a phase are
+      // committed all together, since every commitment shares the same
+      // lagrange bases.
+      graph.AddTask([prover, &columns, write_idx]() {
+        prover->BatchCommitEvalsAt(columns, write_idx);
+      });
+    } else {
+      commitments.resize(columns.size());
+      std::optional<base::TaskGraph::TaskId> prev_write;
+      for (size_t i = 0; i < columns.size(); ++i) {
+        base::TaskGraph::TaskId commit =
+            graph.AddTask([prover, &columns, &commitments, i]() {
+              commitments[i] = prover->Commit(columns[i]);
+            });
+        // NOTE(chokobole): The writing tasks are chained to keep the order of
+        // the proof.
+        std::vector<base::TaskGraph::TaskId> write_dependencies = {commit};
+        if (prev_write.has_value()) write_dependencies.push_back(*prev_write);
+        prev_write = graph.AddTask(
+            [prover, &commitments, i]() {
+              CHECK(prover->GetWriter()->WriteToProof(commitments[i]));
+            },
+            write_dependencies);
+      }
+    }
+    for (size_t i = 0; i < columns.size(); ++i) {
+      graph.AddTask([prover, &columns, &polys, i]() {
+        polys[i] = prover->domain()->IFFT(columns[i]);
+      });
+    }
+    graph.Run();
+    return polys;
+  }
+
   // Performs synthesis for a specific |circuit| and a specific |phase|, and
   // returns a vector of |RationalEvals|.
   template <typename Circuit>
@@ -161,6 +222,7 @@ class Synthesizer {
 
   absl::btree_map<size_t, F> challenges_;
   std::vector<std::vector<Evals>> advice_columns_vec_;
+  std::vector<std::vector<Poly>> advice_polys_vec_;
   std::vector<std::vector<F>> advice_blinds_vec_;
 };
 
@@ -7,6 +7,7 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_VERIFIER_H_
 #define TACHYON_ZK_PLONK_HALO2_VERIFIER_H_
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -16,8 +17,10 @@
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/threading/parallel_for.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/zk/base/entities/verifier_base.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_verification.h"
 #include "tachyon/zk/lookup/lookup_verification.h"
 #include "tachyon/zk/plonk/halo2/proof_reader.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
@@ -38,15 +41,78 @@ class Verifier : public VerifierBase<PCS> {
 
   using VerifierBase<PCS>::VerifierBase;
 
+  // A proof to be verified by |VerifyProofs()| together with its instances.
+  struct BatchEntry {
+    std::unique_ptr<crypto::TranscriptReader<Commitment>> transcript;
+    std::vector<std::vector<Evals>> instance_columns_vec;
+  };
+
   [[nodiscard]] bool VerifyProof(
       const VerifyingKey<PCS>& vkey,
       const std::vector<std::vector<Evals>>& instance_columns_vec) {
     return VerifyProofForTesting(vkey, instance_columns_vec, nullptr, nullptr);
   }
 
+  // Verifies all the proofs of |batch| against |vkey|. Each proof is reduced
+  // to an accumulator of the opening proof without the pairing, and the
+  // accumulators are checked at once with a single pairing. See
+  // |PCS::VerifyAccumulators()|. If the check fails, every accumulator is
+  // checked on its own and the indices of the invalid proofs are stored in
+  // |invalid_indices| if it's not null.
+  [[nodiscard]] bool VerifyProofs(const VerifyingKey<PCS>& vkey,
+                                  std::vector<BatchEntry>& batch,
+                                  std::vector<size_t>* invalid_indices =
+                                      nullptr) {
+    using Accumulator = typename PCS::Accumulator;
+
+    std::vector<Accumulator> accumulators(batch.size());
+    // NOTE(chokobole): |char| is used instead of |bool| since the elements of
+    // |std::vector<bool>| can't be written from multiple threads.
+    std::vector<char> results(batch.size());
+    base::ParallelFor(0, batch.size(), [this, &vkey, &batch, &accumulators,
+                                        &results](size_t i) {
+      crypto::TranscriptReader<Commitment>* transcript =
+          batch[i].transcript.get();
+      Accumulator* accumulator = &accumulators[i];
+      results[i] = ReadAndVerifyProof(
+          vkey, batch[i].instance_columns_vec, transcript, nullptr, nullptr,
+          [this, transcript, accumulator](const std::vector<Opening>& queries) {
+            return this->pcs_.ComputeAccumulator(queries, transcript,
+                                                 accumulator);
+          });
+    });
+
+    bool all_read = std::all_of(results.begin(), results.end(),
+                                [](char result) { return result; });
+    if (all_read && this->pcs_.VerifyAccumulators(accumulators)) {
+      if (invalid_indices) invalid_indices->clear();
+      return true;
+    }
+
+    // Pinpoints the invalid proofs.
+    base::ParallelFor(0, batch.size(),
+                      [this, &accumulators, &results](size_t i) {
+                        if (results[i]) {
+                          results[i] =
+                              this->pcs_.VerifyAccumulator(accumulators[i]);
+                        }
+                      });
+    if (invalid_indices) {
+      invalid_indices->clear();
+      for (size_t i = 0; i < batch.size(); ++i) {
+        if (!results[i]) invalid_indices->push_back(i);
+      }
+    }
+    return false;
+  }
+
  private:
   FRIEND_TEST(SimpleCircuitTest, Verify);
   FRIEND_TEST(SimpleLookupCircuitTest, Verify);
+  FRIEND_TEST(SimpleLookupCircuitTest, VerifyWithLogDerivativeLookup);
+  FRIEND_TEST(SimpleLookupCircuitTest, VerifyWithChunkedLogDerivativeLookups);
+  FRIEND_TEST(SimpleLookupCircuitTest,
+              VerifyWithWrongLogDerivativeLookupMultiplicity);
   FRIEND_TEST(SimpleV1CircuitTest, Verify);
   FRIEND_TEST(SimpleLookupV1CircuitTest, Verify);
 
@@ -54,6 +120,24 @@ class Verifier : public VerifierBase<PCS> {
       const VerifyingKey<PCS>& vkey,
       const std::vector<std::vector<Evals>>& instance_columns_vec,
       Proof<F, Commitment>* proof_out, F* expected_h_eval_out) {
+    crypto::TranscriptReader<Commitment>* transcript = this->GetReader();
+    return ReadAndVerifyProof(
+        vkey, instance_columns_vec, transcript, proof_out, expected_h_eval_out,
+        [this, transcript](const std::vector<Opening>& queries) {
+          return this->pcs_.VerifyOpeningProof(queries, transcript);
+        });
+  }
+
+  // Reads the proof from |transcript| and calls
+  // |verify_opening_proof(queries)| with the queries of the opening proof,
+  // which is left unread in |transcript|.
+  template <typename VerifyOpeningProof>
+  bool ReadAndVerifyProof(
+      const VerifyingKey<PCS>& vkey,
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      crypto::TranscriptReader<Commitment>* transcript,
+      Proof<F, Commitment>* proof_out, F* expected_h_eval_out,
+      VerifyOpeningProof verify_opening_proof) {
     if (!ValidateInstanceColumnsVec(vkey, instance_columns_vec)) return false;
 
     std::vector<std::vector<Commitment>> instance_commitments_vec;
@@ -63,7 +147,6 @@ class Verifier : public VerifierBase<PCS> {
       instance_commitments_vec.resize(instance_columns_vec.size());
     }
 
-    crypto::TranscriptReader<Commitment>* transcript = this->GetReader();
     CHECK(transcript->WriteToTranscript(vkey.transcript_repr()));
 
     if constexpr (PCS::kQueryInstance) {
@@ -75,29 +158,42 @@ class Verifier : public VerifierBase<PCS> {
     ProofReader<PCS> proof_reader(vkey, transcript,
                                   instance_commitments_vec.size());
     Proof<F, Commitment>& proof = proof_reader.proof();
-    proof_reader.ReadAdviceCommitmentsVecAndChallenges();
-    proof_reader.ReadTheta();
-    proof_reader.ReadLookupPermutedCommitments();
-    proof_reader.ReadBetaAndGamma();
-    proof_reader.ReadPermutationProductCommitments();
-    proof_reader.ReadLookupProductCommitments();
-    proof_reader.ReadVanishingRandomPolyCommitment();
-    proof_reader.ReadY();
-    proof_reader.ReadVanishingHPolyCommitments();
-    proof_reader.ReadX();
+    if (!proof_reader.ReadAdviceCommitmentsVecAndChallenges()) return false;
+    if (!proof_reader.ReadTheta()) return false;
+    LookupType lookup_type = vkey.constraint_system().lookup_type();
+    if (lookup_type == LookupType::kHalo2) {
+      if (!proof_reader.ReadLookupPermutedCommitments()) return false;
+    } else {
+      if (!proof_reader.ReadLookupMultiplicityCommitments()) return false;
+    }
+    if (!proof_reader.ReadBetaAndGamma()) return false;
+    if (!proof_reader.ReadPermutationProductCommitments()) return false;
+    if (lookup_type == LookupType::kHalo2) {
+      if (!proof_reader.ReadLookupProductCommitments()) return false;
+    } else {
+      if (!proof_reader.ReadLookupGrandSumCommitments()) return false;
+    }
+    if (!proof_reader.ReadVanishingRandomPolyCommitment()) return false;
+    if (!proof_reader.ReadY()) return false;
+    if (!proof_reader.ReadVanishingHPolyCommitments()) return false;
+    if (!proof_reader.ReadX()) return false;
     if constexpr (PCS::kQueryInstance) {
-      proof_reader.ReadInstanceEvalsIfQueryInstance();
+      if (!proof_reader.ReadInstanceEvalsIfQueryInstance()) return false;
     } else {
-      proof_reader.ReadInstanceEvalsIfNoQueryInstance();
+      if (!proof_reader.ReadInstanceEvalsIfNoQueryInstance()) return false;
       proof.instance_evals_vec =
           ComputeInstanceEvalsVec(vkey, instance_columns_vec, proof.x);
     }
-    proof_reader.ReadAdviceEvals();
-    proof_reader.ReadFixedEvals();
-    proof_reader.ReadVanishingRandomEval();
-    proof_reader.ReadCommonPermutationEvals();
-    proof_reader.ReadPermutationEvals();
-    proof_reader.ReadLookupEvals();
+    if (!proof_reader.ReadAdviceEvals()) return false;
+    if (!proof_reader.ReadFixedEvals()) return false;
+    if (!proof_reader.ReadVanishingRandomEval()) return false;
+    if (!proof_reader.ReadCommonPermutationEvals()) return false;
+    if (!proof_reader.ReadPermutationEvals()) return false;
+    if (lookup_type == LookupType::kHalo2) {
+      if (!proof_reader.ReadLookupEvals()) return false;
+    } else {
+      if (!proof_reader.ReadLogDerivativeLookupEvals()) return false;
+    }
 
     if (proof_out) {
       *proof_out = proof;
@@ -105,7 +201,8 @@ class Verifier : public VerifierBase<PCS> {
 
     ComputeAuxValues(vkey.constraint_system(), proof);
 
-    return DoVerify(instance_commitments_vec, vkey, proof, expected_h_eval_out);
+    return DoVerify(instance_commitments_vec, vkey, proof, expected_h_eval_out,
+                    verify_opening_proof);
   }
 
   void ComputeAuxValues(const ConstraintSystem<F>& constraint_system,
@@ -288,6 +385,20 @@ class Verifier : public VerifierBase<PCS> {
     std::vector<F> expressions;
     const std::vector<Gate<F>>& gates = constraint_system.gates();
     const std::vector<LookupArgument<F>>& lookups = constraint_system.lookups();
+    std::vector<LogDerivativeLookupArgument<F>> log_derivative_lookups;
+    size_t lookup_expressions_size;
+    if (constraint_system.lookup_type() == LookupType::kHalo2) {
+      lookup_expressions_size =
+          lookups.size() * GetSizeOfLookupVerificationExpressions();
+    } else {
+      log_derivative_lookups = constraint_system.ComputeLogDerivativeLookups();
+      lookup_expressions_size = std::accumulate(
+          log_derivative_lookups.begin(), log_derivative_lookups.end(), 0,
+          [](size_t acc, const LogDerivativeLookupArgument<F>& argument) {
+            return acc + GetSizeOfLogDerivativeLookupVerificationExpressions(
+                             argument);
+          });
+    }
     size_t polys_size = std::accumulate(gates.begin(), gates.end(), 0,
                                         [](size_t acc, const Gate<F>& gate) {
                                           return acc + gate.polys().size();
@@ -296,11 +407,15 @@ class Verifier : public VerifierBase<PCS> {
         num_circuits *
         (polys_size +
          GetSizeOfPermutationVerificationExpressions(constraint_system) +
-         lookups.size() * GetSizeOfLookupVerificationExpressions());
+         lookup_expressions_size);
     expressions.reserve(expressions_size);
     for (size_t i = 0; i < num_circuits; ++i) {
+      // NOTE(chokobole): |VanishingVerificationEvaluator| holds a reference to
+      // the data, so it must outlive the evaluator.
+      VanishingVerificationData<F> vanishing_verification_data =
+          proof.ToVanishingVerificationData(i);
       VanishingVerificationEvaluator<F> vanishing_verification_evaluator(
-          proof.ToVanishingVerificationData(i));
+          vanishing_verification_data);
       for (const Gate<F>& gate : gates) {
         for (const std::unique_ptr<Expression<F>>& poly : gate.polys()) {
           expressions.push_back(
@@ -316,13 +431,33 @@ class Verifier : public VerifierBase<PCS> {
           std::make_move_iterator(permutation_expressions.begin()),
           std::make_move_iterator(permutation_expressions.end()));
 
-      for (size_t j = 0; j < lookups.size(); ++j) {
-        const LookupArgument<F>& lookup = lookups[j];
-        std::vector<F> lookup_expressions = CreateLookupVerificationExpressions(
-            proof.ToLookupVerificationData(i, j), lookup);
-        expressions.insert(expressions.end(),
-                           std::make_move_iterator(lookup_expressions.begin()),
-                           std::make_move_iterator(lookup_expressions.end()));
+      if (constraint_system.lookup_type() == LookupType::kHalo2) {
+        for (size_t j = 0; j < lookups.size(); ++j) {
+          const LookupArgument<F>& lookup = lookups[j];
+          std::vector<F> lookup_expressions =
+              CreateLookupVerificationExpressions(
+                  proof.ToLookupVerificationData(i, j), lookup);
+          expressions.insert(
+              expressions.end(),
+              std::make_move_iterator(lookup_expressions.begin()),
+              std::make_move_iterator(lookup_expressions.end()));
+        }
+      } else {
+        size_t grand_sum_offset = 0;
+        for (size_t j = 0; j < log_derivative_lookups.size(); ++j) {
+          const LogDerivativeLookupArgument<F>& argument =
+              log_derivative_lookups[j];
+          std::vector<F> lookup_expressions =
+              CreateLogDerivativeLookupVerificationExpressions(
+                  proof.ToLogDerivativeLookupVerificationData(
+                      i, j, grand_sum_offset, argument.num_chunks()),
+                  argument);
+          grand_sum_offset += argument.num_chunks();
+          expressions.insert(
+              expressions.end(),
+              std::make_move_iterator(lookup_expressions.begin()),
+              std::make_move_iterator(lookup_expressions.end()));
+        }
       }
     }
     DCHECK_EQ(expressions.size(), expressions_size);
@@ -361,10 +496,11 @@ class Verifier : public VerifierBase<PCS> {
     }
   }
 
+  template <typename VerifyOpeningProof>
   bool DoVerify(
       const std::vector<std::vector<Commitment>>& instance_commitments_vec,
       const VerifyingKey<PCS>& vkey, const Proof<F, Commitment>& proof,
-      F* expected_h_eval_out) {
+      F* expected_h_eval_out, VerifyOpeningProof verify_opening_proof) {
     std::vector<Opening> queries;
     size_t num_circuits = instance_commitments_vec.size();
 
@@ -374,11 +510,23 @@ class Verifier : public VerifierBase<PCS> {
         constraint_system.fixed_queries();
     const std::vector<Commitment>& common_permutation_commitments =
         vkey.permutation_verifying_key().commitments();
+    std::vector<LogDerivativeLookupArgument<F>> log_derivative_lookups;
+    size_t lookup_queries_size;
+    if (constraint_system.lookup_type() == LookupType::kHalo2) {
+      lookup_queries_size = lookups.size() * GetSizeOfLookupVerifierQueries();
+    } else {
+      log_derivative_lookups = constraint_system.ComputeLogDerivativeLookups();
+      lookup_queries_size = std::accumulate(
+          log_derivative_lookups.begin(), log_derivative_lookups.end(), 0,
+          [](size_t acc, const LogDerivativeLookupArgument<F>& argument) {
+            return acc + GetSizeOfLogDerivativeLookupVerifierQueries(argument);
+          });
+    }
     size_t queries_size =
         num_circuits *
             (GetSizeOfAdviceInstanceColumnQueries(constraint_system) +
              GetSizeOfPermutationVerifierQueries(constraint_system) +
-             lookups.size() * GetSizeOfLookupVerifierQueries()) +
+             lookup_queries_size) +
         fixed_queries.size() + common_permutation_commitments.size() + 2;
     queries.reserve(queries_size);
 
@@ -407,12 +555,29 @@ class Verifier : public VerifierBase<PCS> {
                      std::make_move_iterator(permutation_queries.begin()),
                      std::make_move_iterator(permutation_queries.end()));
 
-      for (size_t j = 0; j < lookups.size(); ++j) {
-        std::vector<Opening> lookup_queries =
-            CreateLookupQueries<PCS>(proof.ToLookupVerificationData(i, j));
-        queries.insert(queries.end(),
-                       std::make_move_iterator(lookup_queries.begin()),
-                       std::make_move_iterator(lookup_queries.end()));
+      if (constraint_system.lookup_type() == LookupType::kHalo2) {
+        for (size_t j = 0; j < lookups.size(); ++j) {
+          std::vector<Opening> lookup_queries =
+              CreateLookupQueries<PCS>(proof.ToLookupVerificationData(i, j));
+          queries.insert(queries.end(),
+                         std::make_move_iterator(lookup_queries.begin()),
+                         std::make_move_iterator(lookup_queries.end()));
+        }
+      } else {
+        size_t grand_sum_offset = 0;
+        for (size_t j = 0; j < log_derivative_lookups.size(); ++j) {
+          const LogDerivativeLookupArgument<F>& argument =
+              log_derivative_lookups[j];
+          std::vector<Opening> lookup_queries =
+              CreateLogDerivativeLookupQueries<PCS>(
+                  proof.ToLogDerivativeLookupVerificationData(
+                      i, j, grand_sum_offset, argument.num_chunks()),
+                  argument);
+          grand_sum_offset += argument.num_chunks();
+          queries.insert(queries.end(),
+                         std::make_move_iterator(lookup_queries.begin()),
+                         std::make_move_iterator(lookup_queries.end()));
+        }
       }
     }
 
@@ -446,7 +611,7 @@ class Verifier : public VerifierBase<PCS> {
                          proof.vanishing_random_eval);
     DCHECK_EQ(queries.size(), queries_size);
     DCHECK_EQ(points.size(), points_size);
-    return this->pcs_.VerifyOpeningProof(queries, this->GetReader());
+    return verify_opening_proof(queries);
   }
 };
 
@@ -0,0 +1,376 @@
+#ifndef TACHYON_ZK_PLONK_KEYS_MAPPED_PROVING_KEY_H_
+#define TACHYON_ZK_PLONK_KEYS_MAPPED_PROVING_KEY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/parallel_for.h"
+
+namespace tachyon::zk {
+
+// The field vectors of a |ProvingKey| are laid out on disk as follows, so
+// that they can be memory-mapped and read in place:
+//
+// | Contents                | Size                                      |
+// |-------------------------|-------------------------------------------|
+// | MappedProvingKeyHeader  | sizeof(MappedProvingKeyHeader)            |
+// | MappedVectorEntry table | |num_vectors| * sizeof(MappedVectorEntry) |
+// | padding                 | up to |kAlignment|                        |
+// | vector 0                | |size| * sizeof(F), padded                |
+// | ...                     |                                           |
+//
+// The vectors are the transcript repr of the verifying key, l_first, l_last,
+// l_active_row, the fixed columns, the fixed polys, the permutations and the
+// permutation polys in this order. The transcript repr is a vector of a single
+// element, which binds the vectors to the verifying key they were computed
+// from. The field
+// elements are stored in their in-memory representation, which is the
+// Montgomery form in the host endian, so the file is only portable between
+// hosts of the same endian and the same field implementation.
+struct MappedProvingKeyHeader {
+  constexpr static char kMagic[8] = {'T', 'C', 'H', 'Y', 'P', 'K', 'E', 'Y'};
+  constexpr static uint32_t kVersion = 2;
+  constexpr static uint32_t kEndianTag = 0x01020304;
+  // Every vector starts at a multiple of this, which is at least the size of
+  // a cache line.
+  constexpr static uint64_t kAlignment = 64;
+
+  char magic[8];
+  uint32_t version;
+  uint32_t endian_tag;
+  uint32_t element_size;
+  uint32_t reserved;
+  // The checksum of the modulus of the field.
+  uint64_t field_checksum;
+  uint64_t num_fixed_columns;
+  uint64_t num_permutations;
+  uint64_t file_size;
+  // The checksum of the |MappedVectorEntry| table.
+  uint64_t entries_checksum;
+  // The checksum of the header above this field.
+  uint64_t header_checksum;
+};
+
+struct MappedVectorEntry {
+  // The offset from the start of the file in bytes.
+  uint64_t offset;
+  // The number of the field elements.
+  uint64_t size;
+  uint64_t checksum;
+};
+
+namespace internal {
+
+// Returns a 64-bit FNV-1a style checksum of |data|, which reads 8 bytes at a
+// time to keep up with the disk. This is not cryptographic and only detects a
+// truncated or corrupted file.
+inline uint64_t ComputeMappedChecksum(absl::Span<const uint8_t> data) {
+  constexpr uint64_t kOffsetBasis = 0xcbf29ce484222325;
+  constexpr uint64_t kPrime = 0x100000001b3;
+  uint64_t hash = kOffsetBasis ^ data.size();
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= data.size(); i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, &data[i], sizeof(uint64_t));
+    hash = (hash ^ word) * kPrime;
+    hash ^= hash >> 32;
+  }
+  for (; i < data.size(); ++i) {
+    hash = (hash ^ data[i]) * kPrime;
+  }
+  return hash;
+}
+
+template <typename T>
+uint64_t ComputeMappedChecksum(const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  return ComputeMappedChecksum(absl::Span<const uint8_t>(
+      reinterpret_cast<const uint8_t*>(&value), sizeof(T)));
+}
+
+template <typename F>
+uint64_t ComputeMappedChecksum(absl::Span<const F> values) {
+  return ComputeMappedChecksum(absl::Span<const uint8_t>(
+      reinterpret_cast<const uint8_t*>(values.data()),
+      values.size() * sizeof(F)));
+}
+
+constexpr uint64_t AlignMappedOffset(uint64_t offset) {
+  return (offset + MappedProvingKeyHeader::kAlignment - 1) &
+         ~(MappedProvingKeyHeader::kAlignment - 1);
+}
+
+}  // namespace internal
+
+// Writes the field vectors of |proving_key| into |buffer| in the layout
+// described above. |buffer| must be growable or large enough.
+template <typename ProvingKeyTy>
+[[nodiscard]] bool WriteMappedProvingKey(const ProvingKeyTy& proving_key,
+                                         base::Buffer* buffer) {
+  using F = typename ProvingKeyTy::F;
+  static_assert(std::is_trivially_copyable_v<F>);
+
+  std::vector<absl::Span<const F>> vectors;
+  vectors.push_back(
+      absl::MakeConstSpan(&proving_key.verifying_key().transcript_repr(), 1));
+  auto add_poly = [&vectors](const auto& poly) {
+    vectors.push_back(absl::MakeConstSpan(poly.coefficients().coefficients()));
+  };
+  auto add_evals = [&vectors](const auto& evals) {
+    vectors.push_back(absl::MakeConstSpan(evals.evaluations()));
+  };
+  add_poly(proving_key.l_first());
+  add_poly(proving_key.l_last());
+  add_poly(proving_key.l_active_row());
+  for (const auto& evals : proving_key.fixed_columns()) {
+    add_evals(evals);
+  }
+  for (const auto& poly : proving_key.fixed_polys()) {
+    add_poly(poly);
+  }
+  const auto& permutation_proving_key = proving_key.permutation_proving_key();
+  for (const auto& evals : permutation_proving_key.permutations()) {
+    add_evals(evals);
+  }
+  for (const auto& poly : permutation_proving_key.polys()) {
+    add_poly(poly);
+  }
+
+  std::vector<MappedVectorEntry> entries(vectors.size());
+  uint64_t offset = internal::AlignMappedOffset(
+      sizeof(MappedProvingKeyHeader) +
+      entries.size() * sizeof(MappedVectorEntry));
+  base::ParallelFor(0, vectors.size(), [&vectors, &entries](size_t i) {
+    entries[i].checksum = internal::ComputeMappedChecksum(vectors[i]);
+  });
+  for (size_t i = 0; i < vectors.size(); ++i) {
+    entries[i].offset = offset;
+    entries[i].size = vectors[i].size();
+    offset =
+        internal::AlignMappedOffset(offset + vectors[i].size() * sizeof(F));
+  }
+
+  MappedProvingKeyHeader header = {};
+  memcpy(header.magic, MappedProvingKeyHeader::kMagic,
+         sizeof(MappedProvingKeyHeader::kMagic));
+  header.version = MappedProvingKeyHeader::kVersion;
+  header.endian_tag = MappedProvingKeyHeader::kEndianTag;
+  header.element_size = sizeof(F);
+  header.field_checksum = internal::ComputeMappedChecksum(F::Config::kModulus);
+  header.num_fixed_columns = proving_key.fixed_columns().size();
+  header.num_permutations = permutation_proving_key.permutations().size();
+  header.file_size = offset;
+  header.entries_checksum =
+      internal::ComputeMappedChecksum(absl::Span<const uint8_t>(
+          reinterpret_cast<const uint8_t*>(entries.data()),
+          entries.size() * sizeof(MappedVectorEntry)));
+  header.header_checksum = internal::ComputeMappedChecksum(
+      absl::Span<const uint8_t>(reinterpret_cast<const uint8_t*>(&header),
+                                offsetof(MappedProvingKeyHeader,
+                                         header_checksum)));
+
+  // The gaps between the vectors are filled with zeros so that the file is
+  // deterministic.
+  size_t start = buffer->buffer_offset();
+  std::vector<uint8_t> zeros(MappedProvingKeyHeader::kAlignment, 0);
+  auto pad_to = [buffer, start, &zeros](uint64_t offset) {
+    return buffer->Write(zeros.data(),
+                         start + offset - buffer->buffer_offset());
+  };
+  if (!buffer->Write(reinterpret_cast<const uint8_t*>(&header),
+                     sizeof(header)))
+    return false;
+  if (!buffer->Write(reinterpret_cast<const uint8_t*>(entries.data()),
+                     entries.size() * sizeof(MappedVectorEntry)))
+    return false;
+  for (size_t i = 0; i < vectors.size(); ++i) {
+    if (!pad_to(entries[i].offset)) return false;
+    if (!buffer->Write(reinterpret_cast<const uint8_t*>(vectors[i].data()),
+                       vectors[i].size() * sizeof(F)))
+      return false;
+  }
+  if (!pad_to(header.file_size)) return false;
+  return true;
+}
+
+// |MappedProvingKey| maps a file written by |WriteMappedProvingKey()| and
+// exposes its field vectors as spans over the mapping without copying them.
+template <typename F>
+class MappedProvingKey {
+ public:
+  MappedProvingKey() = default;
+  MappedProvingKey(const MappedProvingKey&) = delete;
+  MappedProvingKey& operator=(const MappedProvingKey&) = delete;
+
+  size_t num_fixed_columns() const { return num_fixed_columns_; }
+  size_t num_permutations() const { return num_permutations_; }
+
+  const F& transcript_repr() const { return vectors_[0][0]; }
+  absl::Span<const F> l_first() const { return vectors_[1]; }
+  absl::Span<const F> l_last() const { return vectors_[2]; }
+  absl::Span<const F> l_active_row() const { return vectors_[3]; }
+  absl::Span<const F> fixed_column(size_t i) const {
+    return vectors_[kNumLeadingVectors + i];
+  }
+  absl::Span<const F> fixed_poly(size_t i) const {
+    return vectors_[kNumLeadingVectors + num_fixed_columns_ + i];
+  }
+  absl::Span<const F> permutation(size_t i) const {
+    return vectors_[kNumLeadingVectors + 2 * num_fixed_columns_ + i];
+  }
+  absl::Span<const F> permutation_poly(size_t i) const {
+    return vectors_[kNumLeadingVectors + 2 * num_fixed_columns_ +
+                    num_permutations_ + i];
+  }
+
+  // Maps the file at |path| and validates it. If |verify_checksums| is false,
+  // the checksums of the vectors are not computed, which avoids touching
+  // every page of the file.
+  [[nodiscard]] bool Load(const base::FilePath& path,
+                          bool verify_checksums = true) {
+    if (!file_.Initialize(path)) return false;
+    return Parse(file_.bytes(), verify_checksums);
+  }
+
+  // Validates |bytes| and points the spans into it. |bytes| must outlive this
+  // and be aligned to |alignof(F)|.
+  [[nodiscard]] bool Parse(absl::Span<const uint8_t> bytes,
+                           bool verify_checksums = true) {
+    vectors_.clear();
+    MappedProvingKeyHeader header;
+    if (bytes.size() < sizeof(header)) {
+      LOG(ERROR) << "Mapped proving key is too short";
+      return false;
+    }
+    memcpy(&header, bytes.data(), sizeof(header));
+    if (!ValidateHeader(header, bytes)) return false;
+
+    // NOTE(chokobole): Every vector has an entry in the file, so the counts
+    // are bounded by the number of entries that fit in |bytes| before they are
+    // added up, which also keeps |num_vectors| from overflowing.
+    uint64_t max_num_entries = bytes.size() / sizeof(MappedVectorEntry);
+    if (header.num_fixed_columns > max_num_entries ||
+        header.num_permutations > max_num_entries) {
+      LOG(ERROR) << "Mapped proving key is too short";
+      return false;
+    }
+    size_t num_vectors =
+        kNumLeadingVectors +
+        2 * (header.num_fixed_columns + header.num_permutations);
+    size_t entries_size = num_vectors * sizeof(MappedVectorEntry);
+    if (bytes.size() - sizeof(header) < entries_size) {
+      LOG(ERROR) << "Mapped proving key is too short";
+      return false;
+    }
+    absl::Span<const uint8_t> entries_bytes =
+        bytes.subspan(sizeof(header), entries_size);
+    if (internal::ComputeMappedChecksum(entries_bytes) !=
+        header.entries_checksum) {
+      LOG(ERROR) << "Checksum of the vector table doesn't match";
+      return false;
+    }
+    std::vector<MappedVectorEntry> entries(num_vectors);
+    memcpy(entries.data(), entries_bytes.data(), entries_size);
+
+    std::vector<absl::Span<const F>> vectors(num_vectors);
+    for (size_t i = 0; i < num_vectors; ++i) {
+      const MappedVectorEntry& entry = entries[i];
+      if (entry.offset % MappedProvingKeyHeader::kAlignment != 0 ||
+          entry.offset > bytes.size() ||
+          entry.size > (bytes.size() - entry.offset) / sizeof(F)) {
+        LOG(ERROR) << "Vector [" << i << "] is out of range";
+        return false;
+      }
+      const uint8_t* data = bytes.data() + entry.offset;
+      if (reinterpret_cast<uintptr_t>(data) % alignof(F) != 0) {
+        LOG(ERROR) << "Vector [" << i << "] is not aligned";
+        return false;
+      }
+      vectors[i] = absl::Span<const F>(reinterpret_cast<const F*>(data),
+                                       entry.size);
+    }
+
+    if (vectors[0].size() != 1) {
+      LOG(ERROR) << "Transcript repr is missing";
+      return false;
+    }
+
+    if (verify_checksums) {
+      std::atomic<bool> valid(true);
+      base::ParallelFor(0, num_vectors, [&vectors, &entries, &valid](size_t i) {
+        if (internal::ComputeMappedChecksum(vectors[i]) !=
+            entries[i].checksum) {
+          valid.store(false, std::memory_order_relaxed);
+        }
+      });
+      if (!valid.load(std::memory_order_relaxed)) {
+        LOG(ERROR) << "Checksum of the vectors doesn't match";
+        return false;
+      }
+    }
+
+    num_fixed_columns_ = header.num_fixed_columns;
+    num_permutations_ = header.num_permutations;
+    vectors_ = std::move(vectors);
+    return true;
+  }
+
+ private:
+  // The transcript repr, l_first, l_last and l_active_row.
+  constexpr static size_t kNumLeadingVectors = 4;
+
+  static bool ValidateHeader(const MappedProvingKeyHeader& header,
+                             absl::Span<const uint8_t> bytes) {
+    if (memcmp(header.magic, MappedProvingKeyHeader::kMagic,
+               sizeof(MappedProvingKeyHeader::kMagic)) != 0) {
+      LOG(ERROR) << "Not a mapped proving key";
+      return false;
+    }
+    if (header.version != MappedProvingKeyHeader::kVersion) {
+      LOG(ERROR) << "Unsupported version: " << header.version;
+      return false;
+    }
+    if (header.endian_tag != MappedProvingKeyHeader::kEndianTag) {
+      LOG(ERROR) << "Mapped proving key was written in a different endian";
+      return false;
+    }
+    if (internal::ComputeMappedChecksum(absl::Span<const uint8_t>(
+            bytes.data(), offsetof(MappedProvingKeyHeader,
+                                   header_checksum))) !=
+        header.header_checksum) {
+      LOG(ERROR) << "Checksum of the header doesn't match";
+      return false;
+    }
+    if (header.element_size != sizeof(F) ||
+        header.field_checksum !=
+            internal::ComputeMappedChecksum(F::Config::kModulus)) {
+      LOG(ERROR) << "Mapped proving key was written for a different field";
+      return false;
+    }
+    if (header.file_size != bytes.size()) {
+      LOG(ERROR) << "Size of mapped proving key doesn't match";
+      return false;
+    }
+    return true;
+  }
+
+  base::MemoryMappedFile file_;
+  size_t num_fixed_columns_ = 0;
+  size_t num_permutations_ = 0;
+  std::vector<absl::Span<const F>> vectors_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_PLONK_KEYS_MAPPED_PROVING_KEY_H_
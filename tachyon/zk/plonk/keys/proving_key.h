@@ -10,11 +10,16 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/logging.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/base/threading/parallel_for.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/plonk/keys/mapped_proving_key.h"
+#include "tachyon/zk/plonk/keys/proving_key_cosets.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
 #include "tachyon/zk/plonk/permutation/permutation_proving_key.h"
 #include "tachyon/zk/plonk/vanishing/vanishing_argument.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
 
 namespace tachyon {
 namespace halo2_api {
@@ -46,6 +51,112 @@ class ProvingKey : public Key<PCS> {
   const PermutationProvingKey<Poly, Evals>& permutation_proving_key() const {
     return permutation_proving_key_;
   }
+  const ProvingKeyCosets<Evals>& cosets() const { return cosets_; }
+
+  // Evaluates l_first, l_last, l_active_row, the fixed polys and the
+  // permutation polys over every part of the extended domain of |prover| and
+  // keeps them in |cosets_|, so that |CircuitPolynomialBuilder| doesn't redo
+  // the FFTs for every proof. This is opt-in since it takes a lot of memory.
+  // See |ProvingKeyCosets|.
+  void PrecomputeCosets(const ProverBase<PCS>* prover) {
+    using Domain = typename PCS::Domain;
+    using ExtendedDomain = typename PCS::ExtendedDomain;
+
+    const Domain* domain = prover->domain();
+    const ExtendedDomain* extended_domain = prover->extended_domain();
+    size_t num_parts = extended_domain->size() >> domain->log_size_of_group();
+    size_t num_fixed_columns = fixed_polys_.size();
+    const std::vector<Poly>& permutation_polys =
+        permutation_proving_key_.polys();
+
+    std::vector<const Poly*> polys;
+    polys.reserve(3 + num_fixed_columns + permutation_polys.size());
+    polys.push_back(&l_first_);
+    polys.push_back(&l_last_);
+    polys.push_back(&l_active_row_);
+    for (const Poly& poly : fixed_polys_) {
+      polys.push_back(&poly);
+    }
+    for (const Poly& poly : permutation_polys) {
+      polys.push_back(&poly);
+    }
+
+    F zeta = GetHalo2Zeta<F>();
+    F extended_omega_factor = F::One();
+    std::vector<ProvingKeyCosetPart<Evals>> parts;
+    parts.reserve(num_parts);
+    for (size_t i = 0; i < num_parts; ++i) {
+      std::vector<Evals> cosets =
+          CoeffsToExtendedPart(domain, polys, zeta, extended_omega_factor);
+      auto fixed_begin = cosets.begin() + 3;
+      auto fixed_end = fixed_begin + num_fixed_columns;
+      ProvingKeyCosetPart<Evals> part;
+      part.l_first = std::move(cosets[0]);
+      part.l_last = std::move(cosets[1]);
+      part.l_active_row = std::move(cosets[2]);
+      part.fixed_columns =
+          std::vector<Evals>(std::make_move_iterator(fixed_begin),
+                             std::make_move_iterator(fixed_end));
+      part.permutations =
+          std::vector<Evals>(std::make_move_iterator(fixed_end),
+                             std::make_move_iterator(cosets.end()));
+      parts.push_back(std::move(part));
+      extended_omega_factor *= extended_domain->group_gen();
+    }
+    cosets_ = ProvingKeyCosets<Evals>(verifying_key_.transcript_repr(), zeta,
+                                      std::move(parts));
+  }
+
+  // Return true if |cosets|, which were computed by |PrecomputeCosets()| and
+  // possibly read back from a file, were computed from this key and fit it on
+  // |prover|.
+  [[nodiscard]] bool SetCosets(const ProverBase<PCS>* prover,
+                               ProvingKeyCosets<Evals>&& cosets) {
+    if (cosets.transcript_repr() != verifying_key_.transcript_repr()) {
+      LOG(ERROR) << "Cosets were computed from another key";
+      return false;
+    }
+    size_t num_parts = prover->extended_domain()->size() >>
+                       prover->domain()->log_size_of_group();
+    if (cosets.num_parts() != num_parts) {
+      LOG(ERROR) << "Number of parts doesn't match";
+      return false;
+    }
+    if (cosets.zeta() != GetHalo2Zeta<F>()) {
+      LOG(ERROR) << "Zeta doesn't match";
+      return false;
+    }
+    size_t n = prover->domain()->size();
+    for (const ProvingKeyCosetPart<Evals>& part : cosets.parts()) {
+      if (part.fixed_columns.size() != fixed_polys_.size()) {
+        LOG(ERROR) << "Number of fixed columns doesn't match";
+        return false;
+      }
+      if (part.permutations.size() !=
+          permutation_proving_key_.polys().size()) {
+        LOG(ERROR) << "Number of permutations doesn't match";
+        return false;
+      }
+      for (const Evals* evals : {&part.l_first, &part.l_last,
+                                 &part.l_active_row}) {
+        if (evals->evaluations().size() != n) {
+          LOG(ERROR) << "Size of cosets doesn't match";
+          return false;
+        }
+      }
+      for (const std::vector<Evals>* columns :
+           {&part.fixed_columns, &part.permutations}) {
+        for (const Evals& evals : *columns) {
+          if (evals.evaluations().size() != n) {
+            LOG(ERROR) << "Size of cosets doesn't match";
+            return false;
+          }
+        }
+      }
+    }
+    cosets_ = std::move(cosets);
+    return true;
+  }
 
   // Return true if it is able to load from an instance of |circuit|.
   template <typename Circuit>
@@ -70,9 +181,96 @@ class ProvingKey : public Key<PCS> {
     return DoLoad(prover, std::move(pre_load_result), nullptr);
   }
 
+  // Return true if it is able to load from a |verifying_key| and the field
+  // vectors in |mapped|, which were written by |WriteMappedProvingKey()| for
+  // a domain of size |n|.
+  // NOTE(chokobole): |Evals| and |Poly| own their elements in a
+  // |std::vector|, and the prover writes through them, so the vectors can't
+  // alias the read-only mapping. Each vector is copied out of the mapping at
+  // once instead, and |mapped| can be dropped after this returns.
+  [[nodiscard]] bool LoadFromMapped(size_t n, VerifyingKey<PCS>&& verifying_key,
+                                    const MappedProvingKey<F>& mapped) {
+    const ConstraintSystem<F>& constraint_system =
+        verifying_key.constraint_system();
+    if (mapped.transcript_repr() != verifying_key.transcript_repr()) {
+      LOG(ERROR) << "Mapped proving key was written for another verifying key";
+      return false;
+    }
+    if (mapped.num_fixed_columns() != constraint_system.num_fixed_columns()) {
+      LOG(ERROR) << "Number of fixed columns doesn't match";
+      return false;
+    }
+    if (mapped.num_permutations() !=
+        constraint_system.permutation().columns().size()) {
+      LOG(ERROR) << "Number of permutations doesn't match";
+      return false;
+    }
+    if (!HasMappedVectorsOfSize(mapped, n)) {
+      LOG(ERROR) << "Size of mapped vectors doesn't match";
+      return false;
+    }
+    verifying_key_ = std::move(verifying_key);
+
+    auto to_poly = [](absl::Span<const F> coefficients) {
+      return Poly(typename Poly::Coefficients(
+          std::vector<F>(coefficients.begin(), coefficients.end())));
+    };
+    auto to_evals = [](absl::Span<const F> evaluations) {
+      return Evals(std::vector<F>(evaluations.begin(), evaluations.end()));
+    };
+    l_first_ = to_poly(mapped.l_first());
+    l_last_ = to_poly(mapped.l_last());
+    l_active_row_ = to_poly(mapped.l_active_row());
+
+    size_t num_fixed_columns = mapped.num_fixed_columns();
+    fixed_columns_.resize(num_fixed_columns);
+    fixed_polys_.resize(num_fixed_columns);
+    base::ParallelFor(0, num_fixed_columns, [this, &mapped, &to_poly,
+                                             &to_evals](size_t i) {
+      fixed_columns_[i] = to_evals(mapped.fixed_column(i));
+      fixed_polys_[i] = to_poly(mapped.fixed_poly(i));
+    });
+
+    size_t num_permutations = mapped.num_permutations();
+    std::vector<Evals> permutations(num_permutations);
+    std::vector<Poly> permutation_polys(num_permutations);
+    base::ParallelFor(0, num_permutations,
+                      [&mapped, &to_poly, &to_evals, &permutations,
+                       &permutation_polys](size_t i) {
+                        permutations[i] = to_evals(mapped.permutation(i));
+                        permutation_polys[i] =
+                            to_poly(mapped.permutation_poly(i));
+                      });
+    permutation_proving_key_ = PermutationProvingKey<Poly, Evals>(
+        std::move(permutations), std::move(permutation_polys));
+
+    vanishing_argument_ =
+        VanishingArgument<F>::Create(verifying_key_.constraint_system());
+    cosets_ = ProvingKeyCosets<Evals>();
+    return true;
+  }
+
  private:
   friend class halo2_api::ProvingKeyImpl<PCS>;
 
+  static bool HasMappedVectorsOfSize(const MappedProvingKey<F>& mapped,
+                                     size_t n) {
+    if (mapped.l_first().size() != n || mapped.l_last().size() != n ||
+        mapped.l_active_row().size() != n)
+      return false;
+    for (size_t i = 0; i < mapped.num_fixed_columns(); ++i) {
+      if (mapped.fixed_column(i).size() != n ||
+          mapped.fixed_poly(i).size() != n)
+        return false;
+    }
+    for (size_t i = 0; i < mapped.num_permutations(); ++i) {
+      if (mapped.permutation(i).size() != n ||
+          mapped.permutation_poly(i).size() != n)
+        return false;
+    }
+    return true;
+  }
+
   bool DoLoad(ProverBase<PCS>* prover, PreLoadResult&& pre_load_result,
               VerifyingKeyLoadResult* vk_load_result) {
     using Domain = typename PCS::Domain;
@@ -164,6 +362,7 @@ class ProvingKey : public Key<PCS> {
 
     vanishing_argument_ =
         VanishingArgument<F>::Create(verifying_key_.constraint_system());
+    cosets_ = ProvingKeyCosets<Evals>();
     return true;
   }
 
@@ -175,6 +374,8 @@ class ProvingKey : public Key<PCS> {
   std::vector<Poly> fixed_polys_;
   PermutationProvingKey<Poly, Evals> permutation_proving_key_;
   VanishingArgument<F> vanishing_argument_;
+  // It is empty unless |PrecomputeCosets()| or |SetCosets()| is called.
+  ProvingKeyCosets<Evals> cosets_;
 };
 
 }  // namespace zk
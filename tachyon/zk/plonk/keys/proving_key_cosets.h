@@ -0,0 +1,155 @@
+#ifndef TACHYON_ZK_PLONK_KEYS_PROVING_KEY_COSETS_H_
+#define TACHYON_ZK_PLONK_KEYS_PROVING_KEY_COSETS_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon {
+namespace zk {
+
+// The evaluations of the polynomials of a |ProvingKey| over a single part of
+// the extended domain.
+template <typename Evals>
+struct ProvingKeyCosetPart {
+  Evals l_first;
+  Evals l_last;
+  Evals l_active_row;
+  std::vector<Evals> fixed_columns;
+  std::vector<Evals> permutations;
+
+  bool operator==(const ProvingKeyCosetPart& other) const {
+    return l_first == other.l_first && l_last == other.l_last &&
+           l_active_row == other.l_active_row &&
+           fixed_columns == other.fixed_columns &&
+           permutations == other.permutations;
+  }
+  bool operator!=(const ProvingKeyCosetPart& other) const {
+    return !operator==(other);
+  }
+};
+
+// |ProvingKeyCosets| holds the evaluations of the polynomials of a
+// |ProvingKey| over every part of the extended domain. The parts are the
+// cosets ζωₑⁱH for i in [0, |num_parts()|), where ωₑ is the generator of the
+// extended domain. See |CircuitPolynomialBuilder|.
+//
+// They are the same for every proof, so precomputing them saves
+// |num_parts()| FFTs per polynomial per proof, at the cost of keeping
+// (3 + |num_fixed_columns()| + |num_permutations()|) * |num_parts()| * n field
+// elements in memory.
+//
+// They are bound to the key by the |transcript_repr()| of its verifying key,
+// which commits to the fixed polys, the permutation polys and the constraint
+// system, so that the cosets of another key are never used by mistake.
+template <typename Evals>
+class ProvingKeyCosets {
+ public:
+  using F = typename Evals::Field;
+  using Part = ProvingKeyCosetPart<Evals>;
+
+  ProvingKeyCosets() = default;
+  ProvingKeyCosets(const F& transcript_repr, const F& zeta,
+                   std::vector<Part>&& parts)
+      : transcript_repr_(transcript_repr),
+        zeta_(zeta),
+        parts_(std::move(parts)) {}
+
+  const F& transcript_repr() const { return transcript_repr_; }
+  const F& zeta() const { return zeta_; }
+  const std::vector<Part>& parts() const { return parts_; }
+
+  bool empty() const { return parts_.empty(); }
+  size_t num_parts() const { return parts_.size(); }
+  size_t num_fixed_columns() const {
+    return empty() ? 0 : parts_[0].fixed_columns.size();
+  }
+  size_t num_permutations() const {
+    return empty() ? 0 : parts_[0].permutations.size();
+  }
+
+  const Part& part(size_t i) const {
+    CHECK_LT(i, parts_.size());
+    return parts_[i];
+  }
+
+  bool operator==(const ProvingKeyCosets& other) const {
+    return transcript_repr_ == other.transcript_repr_ &&
+           zeta_ == other.zeta_ && parts_ == other.parts_;
+  }
+  bool operator!=(const ProvingKeyCosets& other) const {
+    return !operator==(other);
+  }
+
+ private:
+  // The |VerifyingKey::transcript_repr()| of the key they were computed from.
+  F transcript_repr_;
+  F zeta_;
+  std::vector<Part> parts_;
+};
+
+}  // namespace zk
+
+namespace base {
+
+template <typename Evals>
+class Copyable<zk::ProvingKeyCosetPart<Evals>> {
+ public:
+  static bool WriteTo(const zk::ProvingKeyCosetPart<Evals>& part,
+                      Buffer* buffer) {
+    return buffer->WriteMany(part.l_first, part.l_last, part.l_active_row,
+                             part.fixed_columns, part.permutations);
+  }
+
+  static bool ReadFrom(const Buffer& buffer,
+                       zk::ProvingKeyCosetPart<Evals>* part) {
+    return buffer.ReadMany(&part->l_first, &part->l_last, &part->l_active_row,
+                           &part->fixed_columns, &part->permutations);
+  }
+
+  static size_t EstimateSize(const zk::ProvingKeyCosetPart<Evals>& part) {
+    return base::EstimateSize(part.l_first) + base::EstimateSize(part.l_last) +
+           base::EstimateSize(part.l_active_row) +
+           base::EstimateSize(part.fixed_columns) +
+           base::EstimateSize(part.permutations);
+  }
+};
+
+template <typename Evals>
+class Copyable<zk::ProvingKeyCosets<Evals>> {
+ public:
+  using F = typename Evals::Field;
+
+  static bool WriteTo(const zk::ProvingKeyCosets<Evals>& cosets,
+                      Buffer* buffer) {
+    return buffer->WriteMany(cosets.transcript_repr(), cosets.zeta(),
+                             cosets.parts());
+  }
+
+  static bool ReadFrom(const Buffer& buffer,
+                       zk::ProvingKeyCosets<Evals>* cosets) {
+    F transcript_repr;
+    F zeta;
+    std::vector<zk::ProvingKeyCosetPart<Evals>> parts;
+    if (!buffer.ReadMany(&transcript_repr, &zeta, &parts)) return false;
+
+    *cosets =
+        zk::ProvingKeyCosets<Evals>(transcript_repr, zeta, std::move(parts));
+    return true;
+  }
+
+  static size_t EstimateSize(const zk::ProvingKeyCosets<Evals>& cosets) {
+    return base::EstimateSize(cosets.transcript_repr()) +
+           base::EstimateSize(cosets.zeta()) +
+           base::EstimateSize(cosets.parts());
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_ZK_PLONK_KEYS_PROVING_KEY_COSETS_H_
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/parallelize.h"
@@ -55,8 +56,12 @@ class GrandProductArgument {
   }
 
  private:
+  FRIEND_TEST(GrandProductArgumentTest, DoCreatePolynomial);
+  FRIEND_TEST(GrandProductArgumentTest, DoCreatePolynomialOnThreadPool);
   FRIEND_TEST(LookupArgumentRunnerTest, ComputePermutationProduct);
 
+  constexpr static size_t kDefaultParallelThreshold = 1024;
+
   template <typename Evals, typename Callable>
   static Evals CreatePolynomial(size_t size, RowIndex blinding_factors,
                                 Callable numerator_callback,
@@ -97,6 +102,12 @@ class GrandProductArgument {
                                      blinding_factors);
   }
 
+  // Computes z[i + 1] = z[i] * |grand_product[i]|, where z[0] = |last_z|,
+  // as a parallel scan:
+  // 1. Each chunk computes the running products of its own part.
+  // 2. The products of the chunks are scanned serially.
+  // 3. Each chunk multiplies its running products by the product of all
+  //    the preceding chunks.
   template <typename Evals, typename F>
   static Evals DoCreatePolynomial(F& last_z, size_t size,
                                   const std::vector<F>& grand_product,
@@ -104,10 +115,43 @@ class GrandProductArgument {
     std::vector<F> z;
     z.resize(size);
     z[0] = last_z;
-    for (size_t i = 0; i < size - blinding_factors - 1; ++i) {
-      z[i + 1] = z[i] * grand_product[i];
+    size_t num_products = size - blinding_factors - 1;
+    absl::Span<F> products = absl::MakeSpan(z).subspan(1, num_products);
+
+    std::vector<F> chunk_products = base::ParallelizeMap(
+        products,
+        [&grand_product](absl::Span<F> chunk, size_t chunk_offset,
+                         size_t chunk_size) {
+          size_t start = chunk_offset * chunk_size;
+          F product = F::One();
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            product *= grand_product[start + i];
+            chunk[i] = product;
+          }
+          return product;
+        },
+        kDefaultParallelThreshold);
+
+    std::vector<F> chunk_prefixes(chunk_products.size());
+    F prefix = last_z;
+    for (size_t i = 0; i < chunk_products.size(); ++i) {
+      chunk_prefixes[i] = prefix;
+      prefix *= chunk_products[i];
     }
-    last_z = z[size - blinding_factors - 1];
+
+    // NOTE(chokobole): The same threshold must be used as above so that
+    // |chunk_offset| points to the same chunk.
+    base::Parallelize(
+        products,
+        [&chunk_prefixes](absl::Span<F> chunk, size_t chunk_offset) {
+          const F& chunk_prefix = chunk_prefixes[chunk_offset];
+          if (chunk_prefix.IsOne()) return;
+          for (F& value : chunk) {
+            value *= chunk_prefix;
+          }
+        },
+        kDefaultParallelThreshold);
+    last_z = z[num_products];
     return Evals(std::move(z));
   }
 };
@@ -0,0 +1,83 @@
+#include "tachyon/zk/plonk/permutation/grand_product_argument.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/threading/task_group.h"
+#include "tachyon/base/threading/thread_pool.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+class GrandProductArgumentTest : public testing::Test {
+ public:
+  using F = math::bn254::Fr;
+  using Evals = math::UnivariateEvaluations<F, (size_t{1} << 12) - 1>;
+
+  static void SetUpTestSuite() { F::Init(); }
+};
+
+}  // namespace
+
+TEST_F(GrandProductArgumentTest, DoCreatePolynomial) {
+  constexpr RowIndex kBlindingFactors = 5;
+
+  for (size_t size : {size_t{kBlindingFactors + 1}, size_t{1} << 4,
+                      size_t{1} << 12}) {
+    std::vector<F> grand_product =
+        base::CreateVector(size, []() { return F::Random(); });
+    F initial_z = F::Random();
+
+    std::vector<F> expected(size, F::Zero());
+    expected[0] = initial_z;
+    for (size_t i = 0; i < size - kBlindingFactors - 1; ++i) {
+      expected[i + 1] = expected[i] * grand_product[i];
+    }
+
+    F last_z = initial_z;
+    Evals z = GrandProductArgument::DoCreatePolynomial<Evals>(
+        last_z, size, grand_product, kBlindingFactors);
+    EXPECT_EQ(z.evaluations(), expected);
+    EXPECT_EQ(last_z, expected[size - kBlindingFactors - 1]);
+  }
+}
+
+// The sizes above |GrandProductArgument::kDefaultParallelThreshold| are split
+// into a chunk per thread of the pool, so the scan over the chunks is checked
+// against the serial product on a pool of a single thread and of 4 threads.
+TEST_F(GrandProductArgumentTest, DoCreatePolynomialOnThreadPool) {
+  constexpr RowIndex kBlindingFactors = 5;
+
+  for (size_t size : {size_t{3001}, size_t{1} << 12}) {
+    std::vector<F> grand_product =
+        base::CreateVector(size, []() { return F::Random(); });
+    F initial_z = F::Random();
+
+    std::vector<F> expected(size, F::Zero());
+    expected[0] = initial_z;
+    for (size_t i = 0; i < size - kBlindingFactors - 1; ++i) {
+      expected[i + 1] = expected[i] * grand_product[i];
+    }
+
+    for (size_t num_threads : {size_t{1}, size_t{4}}) {
+      base::ThreadPool pool(num_threads);
+      F last_z = initial_z;
+      Evals z;
+      base::TaskGroup group(&pool);
+      group.Run([&last_z, &z, size, &grand_product]() {
+        z = GrandProductArgument::DoCreatePolynomial<Evals>(
+            last_z, size, grand_product, kBlindingFactors);
+      });
+      group.Wait();
+      EXPECT_EQ(z.evaluations(), expected);
+      EXPECT_EQ(last_z, expected[size - kBlindingFactors - 1]);
+    }
+  }
+}
+
+}  // namespace tachyon::zk
@@ -33,6 +33,39 @@ class TACHYON_EXPORT Calculation {
     kStore,
   };
 
+  struct Pair {
+    ValueSource left;
+    ValueSource right;
+
+    Pair() = default;
+    Pair(const ValueSource& left, const ValueSource& right)
+        : left(left), right(right) {}
+
+    bool operator==(const Pair& other) const {
+      return left == other.left && right == other.right;
+    }
+    bool operator!=(const Pair& other) const { return !operator==(other); }
+  };
+
+  struct HornerData {
+    ValueSource init;
+    std::vector<ValueSource> parts;
+    ValueSource factor;
+
+    HornerData() = default;
+    HornerData(const ValueSource& init, const std::vector<ValueSource>& parts,
+               const ValueSource& factor)
+        : init(init), parts(parts), factor(factor) {}
+
+    bool operator==(const HornerData& other) const {
+      return init == other.init && parts == other.parts &&
+             factor == other.factor;
+    }
+    bool operator!=(const HornerData& other) const {
+      return !operator==(other);
+    }
+  };
+
   Calculation() : Calculation(Type::kAdd) {}
 
   static Calculation Add(const ValueSource& left, const ValueSource& right) {
@@ -68,6 +101,20 @@ class TACHYON_EXPORT Calculation {
   }
   bool operator!=(const Calculation& other) const { return !operator==(other); }
 
+  Type type() const { return type_; }
+  const ValueSource& value() const {
+    CHECK(value_.has_value());
+    return value_.value();
+  }
+  const Pair& pair() const {
+    CHECK(pair_.has_value());
+    return pair_.value();
+  }
+  const HornerData& horner() const {
+    CHECK(horner_.has_value());
+    return horner_.value();
+  }
+
   template <typename Poly, typename Evals, typename F>
   F Evaluate(const EvaluationInput<Poly, Evals>& data,
              const std::vector<F>& constants, const F& previous_value) const {
@@ -107,39 +154,6 @@ class TACHYON_EXPORT Calculation {
   std::string ToString() const;
 
  private:
-  struct Pair {
-    ValueSource left;
-    ValueSource right;
-
-    Pair() = default;
-    Pair(const ValueSource& left, const ValueSource& right)
-        : left(left), right(right) {}
-
-    bool operator==(const Pair& other) const {
-      return left == other.left && right == other.right;
-    }
-    bool operator!=(const Pair& other) const { return !operator==(other); }
-  };
-
-  struct HornerData {
-    ValueSource init;
-    std::vector<ValueSource> parts;
-    ValueSource factor;
-
-    HornerData() = default;
-    HornerData(const ValueSource& init, const std::vector<ValueSource>& parts,
-               const ValueSource& factor)
-        : init(init), parts(parts), factor(factor) {}
-
-    bool operator==(const HornerData& other) const {
-      return init == other.init && parts == other.parts &&
-             factor == other.factor;
-    }
-    bool operator!=(const HornerData& other) const {
-      return !operator==(other);
-    }
-  };
-
   explicit Calculation(Type type) : type_(type) {}
   Calculation(Type type, const ValueSource& value)
       : type_(type), value_(value) {}
@@ -149,19 +163,6 @@ class TACHYON_EXPORT Calculation {
               const std::vector<ValueSource>& parts, const ValueSource& factor)
       : type_(type), horner_(HornerData(init, parts, factor)) {}
 
-  const ValueSource& value() const {
-    CHECK(value_.has_value());
-    return value_.value();
-  }
-  const Pair& pair() const {
-    CHECK(pair_.has_value());
-    return pair_.value();
-  }
-  const HornerData& horner() const {
-    CHECK(horner_.has_value());
-    return horner_.value();
-  }
-
   Type type_;
   std::optional<ValueSource> value_;
   std::optional<Pair> pair_;
@@ -6,6 +6,7 @@
 #ifndef TACHYON_ZK_PLONK_VANISHING_CIRCUIT_POLYNOMIAL_BUILDER_H_
 #define TACHYON_ZK_PLONK_VANISHING_CIRCUIT_POLYNOMIAL_BUILDER_H_
 
+#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -14,13 +15,16 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/numerics/checked_math.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_argument.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_committed.h"
 #include "tachyon/zk/lookup/lookup_committed.h"
 #include "tachyon/zk/plonk/base/column_key.h"
-#include "tachyon/zk/plonk/base/owned_table.h"
 #include "tachyon/zk/plonk/base/ref_table.h"
 #include "tachyon/zk/plonk/constraint_system/rotation.h"
+#include "tachyon/zk/plonk/keys/proving_key_cosets.h"
 #include "tachyon/zk/plonk/permutation/permutation_committed.h"
 #include "tachyon/zk/plonk/permutation/unpermuted_table.h"
+#include "tachyon/zk/plonk/vanishing/compiled_graph_evaluator.h"
 #include "tachyon/zk/plonk/vanishing/evaluation_input.h"
 #include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
 #include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
@@ -46,14 +50,16 @@ class CircuitPolynomialBuilder {
 
   CircuitPolynomialBuilder() = default;
 
+  // |L| is either |LookupCommitted<Poly>| or
+  // |LogDerivativeLookupCommitted<Poly>|.
+  template <typename L>
   static CircuitPolynomialBuilder Create(
       const Domain* domain, const ExtendedDomain* extended_domain, size_t n,
       RowIndex blinding_factors, size_t cs_degree, const F* beta,
       const F* gamma, const F* theta, const F* y, const F* zeta,
       absl::Span<const F> challenges, const ProvingKey<PCS>* proving_key,
       const std::vector<PermutationCommitted<Poly>>* committed_permutations,
-      const std::vector<std::vector<LookupCommitted<Poly>>>*
-          committed_lookups_vec,
+      const std::vector<std::vector<L>>* committed_lookups_vec,
       const std::vector<RefTable<Poly>>* poly_tables) {
     CircuitPolynomialBuilder builder;
     builder.domain_ = domain;
@@ -78,7 +84,7 @@ class CircuitPolynomialBuilder {
 
     builder.proving_key_ = proving_key;
     builder.committed_permutations_ = committed_permutations;
-    builder.committed_lookups_vec_ = committed_lookups_vec;
+    builder.SetCommittedLookupsVec(committed_lookups_vec);
     builder.poly_tables_ = poly_tables;
 
     return builder;
@@ -86,13 +92,32 @@ class CircuitPolynomialBuilder {
 
   void UpdateCurrentExtendedOmega() {
     current_extended_omega_ *= *extended_omega_;
+    ++current_part_;
   }
 
   // Returns an evaluation-formed polynomial as below.
   // - gate₀(X) + y * gate₁(X) + ... + yⁱ * gateᵢ(X) + ...
   ExtendedEvals BuildExtendedCircuitColumn(
       const GraphEvaluator<F>& custom_gate_evaluator,
-      const std::vector<GraphEvaluator<F>>& lookup_evaluators) {
+      const std::vector<GraphEvaluator<F>>& lookup_evaluators,
+      const std::vector<std::vector<GraphEvaluator<F>>>&
+          log_derivative_lookup_evaluators,
+      const std::vector<std::vector<size_t>>&
+          log_derivative_lookup_chunk_sizes) {
+    auto compile = [](const GraphEvaluator<F>& evaluator) {
+      return CompiledGraphEvaluator<F>(evaluator);
+    };
+    CompiledGraphEvaluator<F> compiled_custom_gate_evaluator(
+        custom_gate_evaluator);
+    std::vector<CompiledGraphEvaluator<F>> compiled_lookup_evaluators =
+        base::Map(lookup_evaluators, compile);
+    std::vector<std::vector<CompiledGraphEvaluator<F>>>
+        compiled_log_derivative_lookup_evaluators = base::Map(
+            log_derivative_lookup_evaluators,
+            [&compile](const std::vector<GraphEvaluator<F>>& evaluators) {
+              return base::Map(evaluators, compile);
+            });
+
     std::vector<std::vector<F>> value_parts;
     value_parts.reserve(num_parts_);
     // Calculate the quotient polynomial for each part
@@ -104,16 +129,24 @@ class CircuitPolynomialBuilder {
       size_t circuit_num = poly_tables_->size();
       for (size_t j = 0; j < circuit_num; ++j) {
         UpdateVanishingTable(j);
-        UpdateValuesByCustomGates(custom_gate_evaluator, value_part);
+        UpdateValuesByCustomGates(compiled_custom_gate_evaluator, value_part);
 
         // Do iff there are permutation constraints.
         if ((*committed_permutations_)[j].product_polys().size() > 0) {
           UpdateVanishingPermutation(j);
           UpdateValuesByPermutation(value_part);
         }
-        if ((*committed_lookups_vec_)[j].size() > 0) {
+        if (committed_lookups_vec_ &&
+            (*committed_lookups_vec_)[j].size() > 0) {
           UpdateVanishingLookups(j);
-          UpdateValuesByLookups(lookup_evaluators, value_part);
+          UpdateValuesByLookups(compiled_lookup_evaluators, value_part);
+        }
+        if (committed_log_derivative_lookups_vec_ &&
+            (*committed_log_derivative_lookups_vec_)[j].size() > 0) {
+          UpdateVanishingLogDerivativeLookups(j);
+          UpdateValuesByLogDerivativeLookups(
+              compiled_log_derivative_lookup_evaluators,
+              log_derivative_lookup_chunk_sizes, value_part);
         }
       }
       value_parts.push_back(std::move(value_part));
@@ -125,10 +158,10 @@ class CircuitPolynomialBuilder {
   }
 
   void UpdateValuesByLookups(
-      const std::vector<GraphEvaluator<F>>& lookup_evaluators,
+      const std::vector<CompiledGraphEvaluator<F>>& lookup_evaluators,
       std::vector<F>& values) {
     for (size_t i = 0; i < committed_lookups_vec_->size(); ++i) {
-      const GraphEvaluator<F>& ev = lookup_evaluators[i];
+      const CompiledGraphEvaluator<F>& ev = lookup_evaluators[i];
 
       base::Parallelize(values, [this, i, &ev](absl::Span<F> chunk,
                                                size_t chunk_offset,
@@ -136,16 +169,19 @@ class CircuitPolynomialBuilder {
         const Evals& input_coset = lookup_input_cosets_[i];
         const Evals& table_coset = lookup_table_cosets_[i];
         const Evals& product_coset = lookup_product_cosets_[i];
-
-        EvaluationInput<Poly, Evals> evaluation_input = ExtractEvaluationInput(
-            ev.CreateInitialIntermediates(), ev.CreateEmptyRotations());
+        const Evals& l_first = *l_first_;
+        const Evals& l_last = *l_last_;
+        const Evals& l_active_row = *l_active_row_;
 
         size_t start = chunk_offset * chunk_size;
+        std::vector<F> table_values =
+            base::CreateVector(chunk.size(), F::Zero());
+        ev.Evaluate(ExtractEvaluationInput({}, {}), start, rot_scale_,
+                    absl::MakeSpan(table_values));
+
         for (size_t j = 0; j < chunk.size(); ++j) {
           size_t idx = start + j;
-
-          F zero = F::Zero();
-          F table_value = ev.Evaluate(evaluation_input, idx, rot_scale_, zero);
+          const F& table_value = table_values[j];
 
           RowIndex r_next = Rotation(1).GetIndex(idx, rot_scale_, n_);
           RowIndex r_prev = Rotation(-1).GetIndex(idx, rot_scale_, n_);
@@ -154,12 +190,12 @@ class CircuitPolynomialBuilder {
 
           // l_first(X) * (1 - z(X)) = 0
           chunk[j] *= *y_;
-          chunk[j] += (one_ - *product_coset[idx]) * *l_first_[idx];
+          chunk[j] += (one_ - *product_coset[idx]) * *l_first[idx];
 
           // l_last(X) * (z(X)² - z(X)) = 0
           chunk[j] *= *y_;
           chunk[j] += (product_coset[idx]->Square() - *product_coset[idx]) *
-                      *l_last_[idx];
+                      *l_last[idx];
 
           // clang-format off
           // A * (B - C) = 0 where
@@ -171,13 +207,13 @@ class CircuitPolynomialBuilder {
           chunk[j] += (*product_coset[r_next] * (*input_coset[idx] + *beta_) *
                            (*table_coset[idx] + *gamma_) -
                        *product_coset[idx] * table_value) *
-                      *l_active_row_[idx];
+                      *l_active_row[idx];
 
           // Check that the first values in the permuted input expression and
           // permuted fixed expression are the same.
           // l_first(X) * (a'(X) - s'(X)) = 0
           chunk[j] *= *y_;
-          chunk[j] += a_minus_s * *l_first_[idx];
+          chunk[j] += a_minus_s * *l_first[idx];
 
           // Check that each value in the permuted lookup input expression is
           // either equal to the value above it, or the value at the same
@@ -185,7 +221,92 @@ class CircuitPolynomialBuilder {
           // (a′(X) − s′(X))⋅(a′(X) − a′(w⁻¹X)) = 0
           chunk[j] *= *y_;
           chunk[j] += a_minus_s * (*input_coset[idx] - *input_coset[r_prev]) *
-                      *l_active_row_[idx];
+                      *l_active_row[idx];
+        }
+      });
+    }
+  }
+
+  // |lookup_evaluators[i]| evaluates fⱼ(X) + β for each input of the i-th
+  // |LogDerivativeLookupArgument| followed by t(X) + β, and |chunk_sizes[i]|
+  // are the numbers of the inputs of its chunks in order.
+  void UpdateValuesByLogDerivativeLookups(
+      const std::vector<std::vector<CompiledGraphEvaluator<F>>>&
+          lookup_evaluators,
+      const std::vector<std::vector<size_t>>& chunk_sizes,
+      std::vector<F>& values) {
+    for (size_t i = 0; i < lookup_evaluators.size(); ++i) {
+      const std::vector<CompiledGraphEvaluator<F>>& evs = lookup_evaluators[i];
+      const std::vector<size_t>& sizes = chunk_sizes[i];
+
+      base::Parallelize(values, [this, i, &evs, &sizes](absl::Span<F> chunk,
+                                                        size_t chunk_offset,
+                                                        size_t chunk_size) {
+        const Evals& multiplicity_coset =
+            log_derivative_lookup_multiplicity_cosets_[i];
+        const std::vector<Evals>& grand_sum_cosets =
+            log_derivative_lookup_grand_sum_cosets_[i];
+        const Evals& l_first = *l_first_;
+        const Evals& l_last = *l_last_;
+        const Evals& l_active_row = *l_active_row_;
+
+        size_t start = chunk_offset * chunk_size;
+        std::vector<std::vector<F>> values_plus_beta =
+            base::Map(evs, [this, start, &chunk](
+                               const CompiledGraphEvaluator<F>& ev) {
+              std::vector<F> ret = base::CreateVector(chunk.size(), F::Zero());
+              ev.Evaluate(ExtractEvaluationInput({}, {}), start, rot_scale_,
+                          absl::MakeSpan(ret));
+              return ret;
+            });
+        size_t num_inputs = values_plus_beta.size() - 1;
+        const std::vector<F>& table_values_plus_beta = values_plus_beta.back();
+
+        std::vector<F> inputs_plus_beta(num_inputs);
+        for (size_t j = 0; j < chunk.size(); ++j) {
+          size_t idx = start + j;
+          RowIndex r_next = Rotation(1).GetIndex(idx, rot_scale_, n_);
+          for (size_t k = 0; k < num_inputs; ++k) {
+            inputs_plus_beta[k] = values_plus_beta[k][j];
+          }
+
+          // l_first(X) * φₖ(X) = 0
+          for (const Evals& grand_sum_coset : grand_sum_cosets) {
+            chunk[j] *= *y_;
+            chunk[j] += *grand_sum_coset[idx] * *l_first[idx];
+          }
+
+          // l_last(X) * Σₖ φₖ(X) = 0
+          F grand_sum_last = F::Zero();
+          for (const Evals& grand_sum_coset : grand_sum_cosets) {
+            grand_sum_last += *grand_sum_coset[idx];
+          }
+          chunk[j] *= *y_;
+          chunk[j] += grand_sum_last * *l_last[idx];
+
+          // clang-format off
+          // (1 - (l_last(X) + l_blind(X))) * (
+          //   (φₖ(ωX) - φₖ(X)) * Πᵢ(fᵢ(X) + β) * (t(X) + β) -
+          //   Σᵢ Πⱼ≠ᵢ(fⱼ(X) + β) * (t(X) + β) + m(X) * Πᵢ(fᵢ(X) + β)) = 0,
+          // where t(X) + β is 1 and m(X) is 0 for k > 0.
+          // clang-format on
+          size_t offset = 0;
+          for (size_t k = 0; k < sizes.size(); ++k) {
+            const Evals& grand_sum_coset = grand_sum_cosets[k];
+            absl::Span<const F> chunk_inputs_plus_beta =
+                absl::MakeConstSpan(&inputs_plus_beta[offset], sizes[k]);
+            offset += sizes[k];
+            F constraint =
+                k == 0 ? ComputeGrandSumConstraint<F>(
+                             chunk_inputs_plus_beta, table_values_plus_beta[j],
+                             *multiplicity_coset[idx], *grand_sum_coset[idx],
+                             *grand_sum_coset[r_next])
+                       : ComputeGrandSumConstraint<F>(
+                             chunk_inputs_plus_beta, F::One(), F::Zero(),
+                             *grand_sum_coset[idx], *grand_sum_coset[r_next]);
+            chunk[j] *= *y_;
+            chunk[j] += constraint * *l_active_row[idx];
+          }
         }
       });
     }
@@ -195,7 +316,10 @@ class CircuitPolynomialBuilder {
     base::Parallelize(values, [this](absl::Span<F> chunk, size_t chunk_offset,
                                      size_t chunk_size) {
       const std::vector<Evals>& product_cosets = permutation_product_cosets_;
-      const std::vector<Evals>& cosets = permutation_cosets_;
+      const std::vector<Evals>& cosets = *permutation_cosets_;
+      const Evals& l_first = *l_first_;
+      const Evals& l_last = *l_last_;
+      const Evals& l_active_row = *l_active_row_;
 
       size_t start = chunk_offset * chunk_size;
       F beta_term = current_extended_omega_ * omega_->Pow(start);
@@ -204,13 +328,13 @@ class CircuitPolynomialBuilder {
 
         // Enforce only for the first set: l_first(X) * (1 - z₀(X)) = 0
         chunk[i] *= *y_;
-        chunk[i] += (one_ - *product_cosets.front()[idx]) * *l_first_[idx];
+        chunk[i] += (one_ - *product_cosets.front()[idx]) * *l_first[idx];
 
         // Enforce only for the last set: l_last(X) * (z_l(X)² - z_l(X)) = 0
         const Evals& last_coset = product_cosets.back();
         chunk[i] *= *y_;
         chunk[i] +=
-            *l_last_[idx] * (last_coset[idx]->Square() - *last_coset[idx]);
+            *l_last[idx] * (last_coset[idx]->Square() - *last_coset[idx]);
 
         // Except for the first set, enforce:
         // l_first(X) * (zᵢ(X) - zᵢ₋₁(w⁻¹X)) = 0
@@ -218,7 +342,7 @@ class CircuitPolynomialBuilder {
         for (size_t set_idx = 0; set_idx < product_cosets.size(); ++set_idx) {
           if (set_idx == 0) continue;
           chunk[i] *= *y_;
-          chunk[i] += *l_first_[idx] * (*product_cosets[set_idx][idx] -
+          chunk[i] += *l_first[idx] * (*product_cosets[set_idx][idx] -
                                         *product_cosets[set_idx - 1][r_last]);
         }
 
@@ -249,7 +373,7 @@ class CircuitPolynomialBuilder {
           F right = CalculateRight(column_chunk, &current_delta, idx,
                                    product_cosets[j][idx]);
           chunk[i] *= *y_;
-          chunk[i] += (left - right) * *l_active_row_[idx];
+          chunk[i] += (left - right) * *l_active_row[idx];
         }
         beta_term *= *omega_;
       }
@@ -257,6 +381,18 @@ class CircuitPolynomialBuilder {
   }
 
  private:
+  void SetCommittedLookupsVec(
+      const std::vector<std::vector<LookupCommitted<Poly>>>*
+          committed_lookups_vec) {
+    committed_lookups_vec_ = committed_lookups_vec;
+  }
+
+  void SetCommittedLookupsVec(
+      const std::vector<std::vector<LogDerivativeLookupCommitted<Poly>>>*
+          committed_lookups_vec) {
+    committed_log_derivative_lookups_vec_ = committed_lookups_vec;
+  }
+
   EvaluationInput<Poly, Evals> ExtractEvaluationInput(
       std ::vector<F>&& intermediates, std::vector<int32_t>&& rotations) {
     return EvaluationInput<Poly, Evals>(
@@ -287,48 +423,101 @@ class CircuitPolynomialBuilder {
     return right;
   }
 
-  void UpdateValuesByCustomGates(const GraphEvaluator<F>& custom_gate_evaluator,
-                                 std::vector<F>& values) {
+  void UpdateValuesByCustomGates(
+      const CompiledGraphEvaluator<F>& custom_gate_evaluator,
+      std::vector<F>& values) {
     base::Parallelize(values, [this, &custom_gate_evaluator](
                                   absl::Span<F> chunk, size_t chunk_offset,
                                   size_t chunk_size) {
-      EvaluationInput<Poly, Evals> evaluation_input = ExtractEvaluationInput(
-          custom_gate_evaluator.CreateInitialIntermediates(),
-          custom_gate_evaluator.CreateEmptyRotations());
-
-      size_t start = chunk_offset * chunk_size;
-      for (size_t i = 0; i < chunk.size(); ++i) {
-        chunk[i] = custom_gate_evaluator.Evaluate(evaluation_input, start + i,
-                                                  rot_scale_, chunk[i]);
-      }
+      custom_gate_evaluator.Evaluate(ExtractEvaluationInput({}, {}),
+                                     chunk_offset * chunk_size, rot_scale_,
+                                     chunk);
     });
   }
 
+  // NOTE(chokobole): Every polynomial that is needed for the current part is
+  // evaluated by a single |CoeffsToExtendedPart()| call, so that the
+  // transforms share the twiddle factors.
+  std::vector<Evals> CoeffsToCurrentExtendedPart(
+      const std::vector<const Poly*>& polys) const {
+    return CoeffsToExtendedPart(domain_, polys, *zeta_,
+                                current_extended_omega_);
+  }
+
+  // Returns the cosets of the current part that were precomputed by
+  // |ProvingKey::PrecomputeCosets()|, or nullptr if there are none for the
+  // current extended domain.
+  const ProvingKeyCosetPart<Evals>* GetPrecomputedCosets() const {
+    const ProvingKeyCosets<Evals>& cosets = proving_key_->cosets();
+    if (cosets.num_parts() != num_parts_ || cosets.zeta() != *zeta_) {
+      return nullptr;
+    }
+    return &cosets.part(current_part_);
+  }
+
   void UpdateVanishingProvingKey() {
-    l_first_ = CoeffToExtendedPart(domain_, proving_key_->l_first(), *zeta_,
-                                   current_extended_omega_);
-    l_last_ = CoeffToExtendedPart(domain_, proving_key_->l_last(), *zeta_,
-                                  current_extended_omega_);
-    l_active_row_ = CoeffToExtendedPart(domain_, proving_key_->l_active_row(),
-                                        *zeta_, current_extended_omega_);
+    if (const ProvingKeyCosetPart<Evals>* precomputed =
+            GetPrecomputedCosets()) {
+      l_first_ = &precomputed->l_first;
+      l_last_ = &precomputed->l_last;
+      l_active_row_ = &precomputed->l_active_row;
+      return;
+    }
+    proving_key_cosets_ = CoeffsToCurrentExtendedPart(
+        {&proving_key_->l_first(), &proving_key_->l_last(),
+         &proving_key_->l_active_row()});
+    l_first_ = &proving_key_cosets_[0];
+    l_last_ = &proving_key_cosets_[1];
+    l_active_row_ = &proving_key_cosets_[2];
   }
 
   void UpdateVanishingPermutation(size_t circuit_idx) {
-    permutation_product_cosets_ = CoeffsToExtendedPart(
-        domain_,
-        absl::MakeConstSpan(
-            (*committed_permutations_)[circuit_idx].product_polys()),
-        *zeta_, current_extended_omega_);
-    permutation_cosets_ = CoeffsToExtendedPart(
-        domain_,
-        absl::MakeConstSpan(proving_key_->permutation_proving_key().polys()),
-        *zeta_, current_extended_omega_);
+    const std::vector<BlindedPolynomial<Poly>>& product_polys =
+        (*committed_permutations_)[circuit_idx].product_polys();
+    const std::vector<Poly>& permutation_polys =
+        proving_key_->permutation_proving_key().polys();
+    const ProvingKeyCosetPart<Evals>* precomputed = GetPrecomputedCosets();
+    std::vector<const Poly*> polys;
+    polys.reserve(product_polys.size() + permutation_polys.size());
+    for (const BlindedPolynomial<Poly>& product_poly : product_polys) {
+      polys.push_back(&product_poly.poly());
+    }
+    if (!precomputed) {
+      for (const Poly& permutation_poly : permutation_polys) {
+        polys.push_back(&permutation_poly);
+      }
+    }
+
+    std::vector<Evals> cosets = CoeffsToCurrentExtendedPart(polys);
+    auto product_cosets_end = cosets.begin() + product_polys.size();
+    permutation_product_cosets_ =
+        std::vector<Evals>(std::make_move_iterator(cosets.begin()),
+                           std::make_move_iterator(product_cosets_end));
+    if (precomputed) {
+      permutation_cosets_ = &precomputed->permutations;
+      return;
+    }
+    owned_permutation_cosets_ =
+        std::vector<Evals>(std::make_move_iterator(product_cosets_end),
+                           std::make_move_iterator(cosets.end()));
+    permutation_cosets_ = &owned_permutation_cosets_;
   }
 
   void UpdateVanishingLookups(size_t circuit_idx) {
     size_t num_lookups = committed_lookups_vec_->size();
-    std::vector<LookupCommitted<Poly>> current_committed_lookups =
+    const std::vector<LookupCommitted<Poly>>& current_committed_lookups =
         (*committed_lookups_vec_)[circuit_idx];
+    std::vector<const Poly*> polys;
+    polys.reserve(3 * num_lookups);
+    for (size_t i = 0; i < num_lookups; ++i) {
+      polys.push_back(&current_committed_lookups[i].product_poly().poly());
+      polys.push_back(
+          &current_committed_lookups[i].permuted_input_poly().poly());
+      polys.push_back(
+          &current_committed_lookups[i].permuted_table_poly().poly());
+    }
+
+    std::vector<Evals> cosets = CoeffsToCurrentExtendedPart(polys);
     lookup_product_cosets_.clear();
     lookup_input_cosets_.clear();
     lookup_table_cosets_.clear();
@@ -336,31 +525,80 @@ class CircuitPolynomialBuilder {
     lookup_input_cosets_.reserve(num_lookups);
     lookup_table_cosets_.reserve(num_lookups);
     for (size_t i = 0; i < num_lookups; ++i) {
-      lookup_product_cosets_.push_back(CoeffToExtendedPart(
-          domain_, current_committed_lookups[i].product_poly(), *zeta_,
-          current_extended_omega_));
-      lookup_input_cosets_.push_back(CoeffToExtendedPart(
-          domain_, current_committed_lookups[i].permuted_input_poly(), *zeta_,
-          current_extended_omega_));
-      lookup_table_cosets_.push_back(CoeffToExtendedPart(
-          domain_, current_committed_lookups[i].permuted_table_poly(), *zeta_,
-          current_extended_omega_));
+      lookup_product_cosets_.push_back(std::move(cosets[3 * i]));
+      lookup_input_cosets_.push_back(std::move(cosets[3 * i + 1]));
+      lookup_table_cosets_.push_back(std::move(cosets[3 * i + 2]));
+    }
+  }
+
+  void UpdateVanishingLogDerivativeLookups(size_t circuit_idx) {
+    const std::vector<LogDerivativeLookupCommitted<Poly>>&
+        current_committed_lookups =
+            (*committed_log_derivative_lookups_vec_)[circuit_idx];
+    size_t num_lookups = current_committed_lookups.size();
+    std::vector<const Poly*> polys;
+    for (const LogDerivativeLookupCommitted<Poly>& committed_lookup :
+         current_committed_lookups) {
+      polys.push_back(&committed_lookup.multiplicity_poly().poly());
+      for (const BlindedPolynomial<Poly>& grand_sum_poly :
+           committed_lookup.grand_sum_polys()) {
+        polys.push_back(&grand_sum_poly.poly());
+      }
+    }
+
+    std::vector<Evals> cosets = CoeffsToCurrentExtendedPart(polys);
+    log_derivative_lookup_multiplicity_cosets_.clear();
+    log_derivative_lookup_grand_sum_cosets_.clear();
+    log_derivative_lookup_multiplicity_cosets_.reserve(num_lookups);
+    log_derivative_lookup_grand_sum_cosets_.reserve(num_lookups);
+    auto it = std::make_move_iterator(cosets.begin());
+    for (const LogDerivativeLookupCommitted<Poly>& committed_lookup :
+         current_committed_lookups) {
+      size_t num_chunks = committed_lookup.grand_sum_polys().size();
+      log_derivative_lookup_multiplicity_cosets_.push_back(*it);
+      ++it;
+      log_derivative_lookup_grand_sum_cosets_.emplace_back(it, it + num_chunks);
+      it += num_chunks;
     }
   }
 
   void UpdateVanishingTable(size_t circuit_idx) {
-    std::vector<Evals> fixed_columns = CoeffsToExtendedPart(
-        domain_, (*poly_tables_)[circuit_idx].GetFixedColumns(), *zeta_,
-        current_extended_omega_);
-    std::vector<Evals> advice_columns = CoeffsToExtendedPart(
-        domain_, (*poly_tables_)[circuit_idx].GetAdviceColumns(), *zeta_,
-        current_extended_omega_);
-    std::vector<Evals> instance_columns = CoeffsToExtendedPart(
-        domain_, (*poly_tables_)[circuit_idx].GetInstanceColumns(), *zeta_,
-        current_extended_omega_);
-    table_ =
-        OwnedTable<Evals>(std::move(fixed_columns), std::move(advice_columns),
-                          std::move(instance_columns));
+    const RefTable<Poly>& poly_table = (*poly_tables_)[circuit_idx];
+    absl::Span<const Poly> fixed_polys = poly_table.GetFixedColumns();
+    absl::Span<const Poly> advice_polys = poly_table.GetAdviceColumns();
+    absl::Span<const Poly> instance_polys = poly_table.GetInstanceColumns();
+    // NOTE(chokobole): The precomputed cosets can be used only if the fixed
+    // columns of the table are the ones of the proving key.
+    const ProvingKeyCosetPart<Evals>* precomputed =
+        fixed_polys.data() == proving_key_->fixed_polys().data()
+            ? GetPrecomputedCosets()
+            : nullptr;
+    if (precomputed) fixed_polys = {};
+    std::vector<const Poly*> polys;
+    polys.reserve(fixed_polys.size() + advice_polys.size() +
+                  instance_polys.size());
+    for (absl::Span<const Poly> column_polys :
+         {fixed_polys, advice_polys, instance_polys}) {
+      for (const Poly& poly : column_polys) {
+        polys.push_back(&poly);
+      }
+    }
+
+    std::vector<Evals> cosets = CoeffsToCurrentExtendedPart(polys);
+    auto fixed_end = cosets.begin() + fixed_polys.size();
+    auto advice_end = fixed_end + advice_polys.size();
+    fixed_cosets_ = std::vector<Evals>(std::make_move_iterator(cosets.begin()),
+                                       std::make_move_iterator(fixed_end));
+    advice_cosets_ = std::vector<Evals>(std::make_move_iterator(fixed_end),
+                                        std::make_move_iterator(advice_end));
+    instance_cosets_ =
+        std::vector<Evals>(std::make_move_iterator(advice_end),
+                           std::make_move_iterator(cosets.end()));
+    table_ = RefTable<Evals>(
+        precomputed ? absl::MakeConstSpan(precomputed->fixed_columns)
+                    : absl::MakeConstSpan(fixed_cosets_),
+        absl::MakeConstSpan(advice_cosets_),
+        absl::MakeConstSpan(instance_cosets_));
   }
 
   // not owned
@@ -368,6 +606,8 @@ class CircuitPolynomialBuilder {
 
   F one_ = F::One();
   F current_extended_omega_ = F::One();
+  // The index of the current part of the extended domain.
+  size_t current_part_ = 0;
   size_t rot_scale_ = 1;
 
   int32_t n_ = 0;
@@ -397,22 +637,43 @@ class CircuitPolynomialBuilder {
   // not owned
   const std::vector<PermutationCommitted<Poly>>* committed_permutations_;
   // not owned
-  const std::vector<std::vector<LookupCommitted<Poly>>>* committed_lookups_vec_;
+  const std::vector<std::vector<LookupCommitted<Poly>>>*
+      committed_lookups_vec_ = nullptr;
+  // not owned
+  const std::vector<std::vector<LogDerivativeLookupCommitted<Poly>>>*
+      committed_log_derivative_lookups_vec_ = nullptr;
   // not owned
   const std::vector<RefTable<Poly>>* poly_tables_;
 
-  Evals l_first_;
-  Evals l_last_;
-  Evals l_active_row_;
+  // The cosets of l_first, l_last and l_active_row if they are not
+  // precomputed.
+  std::vector<Evals> proving_key_cosets_;
+  // not owned
+  const Evals* l_first_ = nullptr;
+  // not owned
+  const Evals* l_last_ = nullptr;
+  // not owned
+  const Evals* l_active_row_ = nullptr;
 
   std::vector<Evals> permutation_product_cosets_;
-  std::vector<Evals> permutation_cosets_;
+  // The cosets of the permutation polys if they are not precomputed.
+  std::vector<Evals> owned_permutation_cosets_;
+  // not owned
+  const std::vector<Evals>* permutation_cosets_ = nullptr;
 
   std::vector<Evals> lookup_product_cosets_;
   std::vector<Evals> lookup_input_cosets_;
   std::vector<Evals> lookup_table_cosets_;
 
-  OwnedTable<Evals> table_;
+  std::vector<Evals> log_derivative_lookup_multiplicity_cosets_;
+  // |log_derivative_lookup_grand_sum_cosets_[i][k]| is the coset of the grand
+  // sum of the k-th chunk of the i-th |LogDerivativeLookupArgument|.
+  std::vector<std::vector<Evals>> log_derivative_lookup_grand_sum_cosets_;
+
+  std::vector<Evals> fixed_cosets_;
+  std::vector<Evals> advice_cosets_;
+  std::vector<Evals> instance_cosets_;
+  RefTable<Evals> table_;
 };
 
 }  // namespace tachyon::zk
@@ -0,0 +1,436 @@
+#ifndef TACHYON_ZK_PLONK_VANISHING_COMPILED_GRAPH_EVALUATOR_H_
+#define TACHYON_ZK_PLONK_VANISHING_COMPILED_GRAPH_EVALUATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/plonk/vanishing/evaluation_input.h"
+#include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
+
+namespace tachyon::zk {
+
+// |CompiledGraphEvaluator| evaluates the same value as |GraphEvaluator| does,
+// but over blocks of rows instead of a single row.
+//
+// The calculations of a |GraphEvaluator| are lowered once into a flat list of
+// instructions whose operands are already resolved to one of the following:
+// - a scalar: a constant, a challenge, β, γ, θ or y.
+// - a column: a fixed, advice or instance column at a rotation.
+// - a register: a scratch buffer that holds the result of an instruction.
+// - the previous value.
+// A |Calculation::Type::kStore| doesn't emit any instruction, since its
+// result just aliases its operand. The registers are reused once their
+// values are dead, so the scratch stays small enough to fit in the cache.
+//
+// Each instruction then runs as a tight loop over |kBlockSize| rows. The rows
+// of a rotated column are contiguous within a block unless the block crosses
+// the end of the column, so the wraparound is handled only at the block edges
+// by gathering the rows into a scratch buffer.
+template <typename F>
+class CompiledGraphEvaluator {
+ public:
+  // The number of rows that an instruction processes at once.
+  constexpr static size_t kBlockSize = 256;
+
+  CompiledGraphEvaluator() = default;
+  explicit CompiledGraphEvaluator(const GraphEvaluator<F>& evaluator)
+      : constants_(evaluator.constants()) {
+    Compile(evaluator);
+  }
+
+  size_t num_instructions() const { return instructions_.size(); }
+  size_t num_registers() const { return num_registers_; }
+
+  // Evaluates the rows [|start|, |start| + |values.size()|). |values[i]| is
+  // the previous value of the row |start| + i and it is overwritten by the
+  // result. This is equivalent to calling |GraphEvaluator::Evaluate()| for
+  // each row.
+  template <typename Poly, typename Evals>
+  void Evaluate(const EvaluationInput<Poly, Evals>& data, size_t start,
+                int32_t scale, absl::Span<F> values) const {
+    if (values.empty()) return;
+    if (!result_.has_value()) {
+      std::fill(values.begin(), values.end(), F::Zero());
+      return;
+    }
+
+    size_t n = static_cast<size_t>(data.n());
+    CHECK_LE(values.size(), n);
+    std::vector<F> scalars =
+        base::Map(scalars_, [this, &data](const ValueSource& source) {
+          return source.Get(data, constants_, F::Zero());
+        });
+    std::vector<const F*> column_bases =
+        base::Map(columns_, [&data, n](const ColumnOperand& column) {
+          const Evals& evals = GetColumn(data, column.source);
+          CHECK_EQ(evals.evaluations().size(), n);
+          return evals.evaluations().data();
+        });
+    std::vector<size_t> column_offsets =
+        base::Map(columns_, [scale, n](const ColumnOperand& column) {
+          int64_t size = static_cast<int64_t>(n);
+          int64_t offset = int64_t{column.rotation} * scale % size;
+          if (offset < 0) offset += size;
+          return static_cast<size_t>(offset);
+        });
+
+    std::vector<F> registers(num_registers_ * kBlockSize);
+    // NOTE(chokobole): This is allocated only if a block crosses the end of
+    // a column.
+    std::vector<F> gathered;
+    std::vector<const F*> columns(columns_.size());
+    for (size_t block_start = 0; block_start < values.size();
+         block_start += kBlockSize) {
+      size_t len = std::min(kBlockSize, values.size() - block_start);
+      size_t row = start + block_start;
+      for (size_t i = 0; i < columns_.size(); ++i) {
+        size_t begin = (row + column_offsets[i]) % n;
+        if (begin + len <= n) {
+          columns[i] = column_bases[i] + begin;
+          continue;
+        }
+        if (gathered.empty()) gathered.resize(columns_.size() * kBlockSize);
+        F* dst = &gathered[i * kBlockSize];
+        size_t len_to_end = n - begin;
+        std::copy_n(column_bases[i] + begin, len_to_end, dst);
+        std::copy_n(column_bases[i], len - len_to_end, dst + len_to_end);
+        columns[i] = dst;
+      }
+
+      auto resolve = [&](const Operand& operand) -> const F* {
+        switch (operand.type) {
+          case OperandType::kScalar:
+            return &scalars[operand.index];
+          case OperandType::kColumn:
+            return columns[operand.index];
+          case OperandType::kRegister:
+            return &registers[operand.index * kBlockSize];
+          case OperandType::kPreviousValue:
+            return &values[block_start];
+        }
+        NOTREACHED();
+        return nullptr;
+      };
+
+      for (const Instruction& instruction : instructions_) {
+        RunInstruction(instruction, resolve,
+                       &registers[instruction.dst * kBlockSize], len);
+      }
+      Copy(resolve(*result_), result_->IsScalar(), &values[block_start], len);
+    }
+  }
+
+ private:
+  enum class OperandType {
+    kScalar,
+    kColumn,
+    kRegister,
+    kPreviousValue,
+  };
+
+  struct Operand {
+    OperandType type;
+    // The index to |scalars_|, |columns_| or the registers.
+    size_t index = 0;
+
+    bool IsScalar() const { return type == OperandType::kScalar; }
+  };
+
+  struct ColumnOperand {
+    ValueSource source;
+    int32_t rotation;
+
+    bool operator==(const ColumnOperand& other) const {
+      return source.type() == other.source.type() &&
+             source.column_index() == other.source.column_index() &&
+             rotation == other.rotation;
+    }
+  };
+
+  struct Instruction {
+    Calculation::Type type;
+    size_t dst;
+    // - kAdd, kSub, kMul: {left, right}
+    // - kSquare, kDouble, kNegate: {value}
+    // - kHorner: {init, factor, parts...}
+    std::vector<Operand> operands;
+  };
+
+  template <typename Poly, typename Evals>
+  static const Evals& GetColumn(const EvaluationInput<Poly, Evals>& data,
+                                const ValueSource& source) {
+    switch (source.type()) {
+      case ValueSource::Type::kFixed:
+        return data.table().GetFixedColumns()[source.column_index()];
+      case ValueSource::Type::kAdvice:
+        return data.table().GetAdviceColumns()[source.column_index()];
+      case ValueSource::Type::kInstance:
+        return data.table().GetInstanceColumns()[source.column_index()];
+      default:
+        break;
+    }
+    NOTREACHED();
+    return data.table().GetFixedColumns()[0];
+  }
+
+  static void Copy(const F* src, bool is_scalar, F* dst, size_t len) {
+    if (is_scalar) {
+      std::fill_n(dst, len, *src);
+    } else if (src != dst) {
+      std::copy_n(src, len, dst);
+    }
+  }
+
+  template <typename Op>
+  static void RunUnary(Op op, const F* a, bool a_is_scalar, F* dst,
+                       size_t len) {
+    if (a_is_scalar) {
+      std::fill_n(dst, len, op(*a));
+      return;
+    }
+    for (size_t i = 0; i < len; ++i) {
+      dst[i] = op(a[i]);
+    }
+  }
+
+  // NOTE(chokobole): |dst| may be the same as |a| or |b|, which is fine since
+  // every row is read before it is written.
+  template <typename Op>
+  static void RunBinary(Op op, const F* a, bool a_is_scalar, const F* b,
+                        bool b_is_scalar, F* dst, size_t len) {
+    if (a_is_scalar && b_is_scalar) {
+      std::fill_n(dst, len, op(*a, *b));
+    } else if (a_is_scalar) {
+      for (size_t i = 0; i < len; ++i) {
+        dst[i] = op(*a, b[i]);
+      }
+    } else if (b_is_scalar) {
+      for (size_t i = 0; i < len; ++i) {
+        dst[i] = op(a[i], *b);
+      }
+    } else {
+      for (size_t i = 0; i < len; ++i) {
+        dst[i] = op(a[i], b[i]);
+      }
+    }
+  }
+
+  template <typename Resolve>
+  static void RunInstruction(const Instruction& instruction, Resolve& resolve,
+                             F* dst, size_t len) {
+    const std::vector<Operand>& operands = instruction.operands;
+    const F* a = resolve(operands[0]);
+    bool a_is_scalar = operands[0].IsScalar();
+    switch (instruction.type) {
+      case Calculation::Type::kAdd:
+        RunBinary([](const F& l, const F& r) { return l + r; }, a, a_is_scalar,
+                  resolve(operands[1]), operands[1].IsScalar(), dst, len);
+        return;
+      case Calculation::Type::kSub:
+        RunBinary([](const F& l, const F& r) { return l - r; }, a, a_is_scalar,
+                  resolve(operands[1]), operands[1].IsScalar(), dst, len);
+        return;
+      case Calculation::Type::kMul:
+        RunBinary([](const F& l, const F& r) { return l * r; }, a, a_is_scalar,
+                  resolve(operands[1]), operands[1].IsScalar(), dst, len);
+        return;
+      case Calculation::Type::kSquare:
+        RunUnary([](const F& v) { return v.Square(); }, a, a_is_scalar, dst,
+                 len);
+        return;
+      case Calculation::Type::kDouble:
+        RunUnary([](const F& v) { return v.Double(); }, a, a_is_scalar, dst,
+                 len);
+        return;
+      case Calculation::Type::kNegate:
+        RunUnary([](const F& v) { return -v; }, a, a_is_scalar, dst, len);
+        return;
+      case Calculation::Type::kHorner: {
+        // NOTE(chokobole): The register allocator never assigns |dst| to any
+        // operand of a horner, since |dst| is written before the parts are
+        // read.
+        Copy(a, a_is_scalar, dst, len);
+        const F* factor = resolve(operands[1]);
+        bool factor_is_scalar = operands[1].IsScalar();
+        for (size_t i = 2; i < operands.size(); ++i) {
+          const F* part = resolve(operands[i]);
+          bool part_is_scalar = operands[i].IsScalar();
+          for (size_t j = 0; j < len; ++j) {
+            dst[j] *= factor_is_scalar ? *factor : factor[j];
+            dst[j] += part_is_scalar ? *part : part[j];
+          }
+        }
+        return;
+      }
+      case Calculation::Type::kStore:
+        break;
+    }
+    NOTREACHED();
+  }
+
+  void Compile(const GraphEvaluator<F>& evaluator) {
+    const std::vector<CalculationInfo>& calculations =
+        evaluator.calculations();
+    if (calculations.empty()) return;
+
+    // Lowers the calculations, where the registers are numbered by the
+    // instructions that write them for now.
+    std::vector<Operand> intermediates(evaluator.num_intermediates());
+    auto lower = [this, &evaluator,
+                  &intermediates](const ValueSource& source) -> Operand {
+      switch (source.type()) {
+        case ValueSource::Type::kIntermediate:
+          return intermediates[source.index()];
+        case ValueSource::Type::kFixed:
+        case ValueSource::Type::kAdvice:
+        case ValueSource::Type::kInstance:
+          return {OperandType::kColumn,
+                  AddColumn(
+                      {source,
+                       evaluator.rotations()[source.rotation_index()]})};
+        case ValueSource::Type::kPreviousValue:
+          return {OperandType::kPreviousValue};
+        case ValueSource::Type::kConstant:
+        case ValueSource::Type::kChallenge:
+        case ValueSource::Type::kBeta:
+        case ValueSource::Type::kGamma:
+        case ValueSource::Type::kTheta:
+        case ValueSource::Type::kY:
+          return {OperandType::kScalar, AddScalar(source)};
+      }
+      NOTREACHED();
+      return {};
+    };
+    for (const CalculationInfo& info : calculations) {
+      const Calculation& calculation = info.calculation;
+      Instruction instruction{calculation.type(), instructions_.size(), {}};
+      switch (calculation.type()) {
+        case Calculation::Type::kStore:
+          intermediates[info.target] = lower(calculation.value());
+          continue;
+        case Calculation::Type::kAdd:
+        case Calculation::Type::kSub:
+        case Calculation::Type::kMul:
+          instruction.operands = {lower(calculation.pair().left),
+                                  lower(calculation.pair().right)};
+          break;
+        case Calculation::Type::kSquare:
+        case Calculation::Type::kDouble:
+        case Calculation::Type::kNegate:
+          instruction.operands = {lower(calculation.value())};
+          break;
+        case Calculation::Type::kHorner: {
+          const Calculation::HornerData& horner = calculation.horner();
+          instruction.operands = {lower(horner.init), lower(horner.factor)};
+          for (const ValueSource& part : horner.parts) {
+            instruction.operands.push_back(lower(part));
+          }
+          break;
+        }
+      }
+      intermediates[info.target] = {OperandType::kRegister, instruction.dst};
+      instructions_.push_back(std::move(instruction));
+    }
+    result_ = intermediates[calculations.back().target];
+    AllocateRegisters();
+  }
+
+  // Maps the registers to the smallest number of scratch buffers by a linear
+  // scan over the instructions.
+  void AllocateRegisters() {
+    if (instructions_.empty()) return;
+    size_t num_instructions = instructions_.size();
+    // A register that is never read is dead right after it is written.
+    std::vector<size_t> last_uses =
+        base::CreateRangedVector(size_t{0}, num_instructions);
+    for (size_t i = 0; i < num_instructions; ++i) {
+      for (const Operand& operand : instructions_[i].operands) {
+        if (operand.type == OperandType::kRegister) {
+          last_uses[operand.index] = i;
+        }
+      }
+    }
+    if (result_->type == OperandType::kRegister) {
+      last_uses[result_->index] = num_instructions;
+    }
+
+    std::vector<size_t> physical(num_instructions);
+    std::vector<size_t> free_registers;
+    auto release = [&](const Instruction& instruction, size_t i) {
+      for (const Operand& operand : instruction.operands) {
+        if (operand.type != OperandType::kRegister) continue;
+        if (last_uses[operand.index] != i) continue;
+        size_t reg = physical[operand.index];
+        // NOTE(chokobole): An operand may appear more than once, e.g., the
+        // both sides of x * x.
+        if (std::find(free_registers.begin(), free_registers.end(), reg) ==
+            free_registers.end()) {
+          free_registers.push_back(reg);
+        }
+      }
+    };
+    auto allocate = [&]() {
+      if (free_registers.empty()) return num_registers_++;
+      size_t reg = free_registers.back();
+      free_registers.pop_back();
+      return reg;
+    };
+    for (size_t i = 0; i < num_instructions; ++i) {
+      Instruction& instruction = instructions_[i];
+      bool is_horner = instruction.type == Calculation::Type::kHorner;
+      if (!is_horner) release(instruction, i);
+      physical[instruction.dst] = allocate();
+      if (is_horner) release(instruction, i);
+      if (last_uses[instruction.dst] == i) {
+        free_registers.push_back(physical[instruction.dst]);
+      }
+    }
+
+    auto rename = [&physical](Operand& operand) {
+      if (operand.type == OperandType::kRegister) {
+        operand.index = physical[operand.index];
+      }
+    };
+    for (Instruction& instruction : instructions_) {
+      for (Operand& operand : instruction.operands) {
+        rename(operand);
+      }
+      instruction.dst = physical[instruction.dst];
+    }
+    rename(*result_);
+  }
+
+  size_t AddScalar(const ValueSource& source) {
+    std::optional<size_t> index = base::FindIndex(scalars_, source);
+    if (index.has_value()) return index.value();
+    scalars_.push_back(source);
+    return scalars_.size() - 1;
+  }
+
+  size_t AddColumn(const ColumnOperand& column) {
+    std::optional<size_t> index = base::FindIndex(columns_, column);
+    if (index.has_value()) return index.value();
+    columns_.push_back(column);
+    return columns_.size() - 1;
+  }
+
+  std::vector<F> constants_;
+  std::vector<ValueSource> scalars_;
+  std::vector<ColumnOperand> columns_;
+  std::vector<Instruction> instructions_;
+  size_t num_registers_ = 0;
+  // It is empty if there's no calculation.
+  std::optional<Operand> result_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_COMPILED_GRAPH_EVALUATOR_H_
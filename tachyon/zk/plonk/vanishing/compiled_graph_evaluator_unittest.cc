@@ -0,0 +1,202 @@
+#include "tachyon/zk/plonk/vanishing/compiled_graph_evaluator.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+// NOTE(chokobole): The number of rows is chosen to be bigger than the block
+// size and not to be a multiple of it, so that both the contiguous blocks and
+// the blocks that wrap around are tested.
+constexpr size_t kNumRows = 600;
+constexpr size_t kMaxDegree = kNumRows - 1;
+
+using GF7 = math::GF7;
+using Poly = math::UnivariateDensePolynomial<GF7, kMaxDegree>;
+using Evals = math::UnivariateEvaluations<GF7, kMaxDegree>;
+using Expr = std::unique_ptr<Expression<GF7>>;
+
+class CompiledGraphEvaluatorTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { GF7::Init(); }
+
+  void SetUp() override {
+    auto create_columns = [](size_t num_columns) {
+      return base::CreateVector(num_columns, []() {
+        return Evals(base::CreateVector(kNumRows, []() {
+          return GF7::Random();
+        }));
+      });
+    };
+    fixed_columns_ = create_columns(2);
+    advice_columns_ = create_columns(2);
+    instance_columns_ = create_columns(1);
+    table_ = RefTable<Evals>(absl::MakeConstSpan(fixed_columns_),
+                             absl::MakeConstSpan(advice_columns_),
+                             absl::MakeConstSpan(instance_columns_));
+    challenges_ = base::CreateVector(2, []() { return GF7::Random(); });
+    beta_ = GF7::Random();
+    gamma_ = GF7::Random();
+    theta_ = GF7::Random();
+    y_ = GF7::Random();
+  }
+
+  EvaluationInput<Poly, Evals> CreateEvaluationInput(
+      const GraphEvaluator<GF7>& evaluator) const {
+    return EvaluationInput<Poly, Evals>(
+        evaluator.CreateInitialIntermediates(),
+        evaluator.CreateEmptyRotations(), &table_, challenges_, &beta_,
+        &gamma_, &theta_, &y_, kNumRows);
+  }
+
+  // Checks that |CompiledGraphEvaluator| evaluates the same values as
+  // |GraphEvaluator| for the rows [|start|, |end|).
+  void TestEvaluate(const GraphEvaluator<GF7>& evaluator, size_t start,
+                    size_t end, int32_t scale) const {
+    std::vector<GF7> previous_values =
+        base::CreateVector(end - start, []() { return GF7::Random(); });
+
+    EvaluationInput<Poly, Evals> input = CreateEvaluationInput(evaluator);
+    std::vector<GF7> expected = base::CreateVector(
+        end - start, [&evaluator, &input, &previous_values, start,
+                      scale](size_t i) {
+          return evaluator.Evaluate(input, start + i, scale,
+                                    previous_values[i]);
+        });
+
+    CompiledGraphEvaluator<GF7> compiled(evaluator);
+    std::vector<GF7> values = previous_values;
+    compiled.Evaluate(CreateEvaluationInput(evaluator), start, scale,
+                      absl::MakeSpan(values));
+    EXPECT_EQ(values, expected);
+  }
+
+  static Expr Fixed(size_t column_index, int32_t rotation) {
+    return ExpressionFactory<GF7>::Fixed(
+        FixedQuery(0, Rotation(rotation), FixedColumnKey(column_index)));
+  }
+
+  static Expr Advice(size_t column_index, int32_t rotation) {
+    return ExpressionFactory<GF7>::Advice(
+        AdviceQuery(0, Rotation(rotation), AdviceColumnKey(column_index)));
+  }
+
+  static Expr Instance(size_t column_index, int32_t rotation) {
+    return ExpressionFactory<GF7>::Instance(
+        InstanceQuery(0, Rotation(rotation), InstanceColumnKey(column_index)));
+  }
+
+ protected:
+  std::vector<Evals> fixed_columns_;
+  std::vector<Evals> advice_columns_;
+  std::vector<Evals> instance_columns_;
+  RefTable<Evals> table_;
+  std::vector<GF7> challenges_;
+  GF7 beta_;
+  GF7 gamma_;
+  GF7 theta_;
+  GF7 y_;
+};
+
+}  // namespace
+
+TEST_F(CompiledGraphEvaluatorTest, Empty) {
+  GraphEvaluator<GF7> evaluator;
+  CompiledGraphEvaluator<GF7> compiled(evaluator);
+  EXPECT_EQ(compiled.num_instructions(), 0);
+  TestEvaluate(evaluator, 0, kNumRows, 1);
+}
+
+TEST_F(CompiledGraphEvaluatorTest, Store) {
+  GraphEvaluator<GF7> evaluator;
+  Expr expr = Advice(1, -1);
+  evaluator.AddExpression(expr.get());
+  CompiledGraphEvaluator<GF7> compiled(evaluator);
+  EXPECT_EQ(compiled.num_instructions(), 0);
+  EXPECT_EQ(compiled.num_registers(), 0);
+  TestEvaluate(evaluator, 0, kNumRows, 1);
+}
+
+TEST_F(CompiledGraphEvaluatorTest, CustomGates) {
+  // clang-format off
+  // - f₀(X) * a₀(X) * a₁(ωX) + f₁(X) * (a₀(X) - i₀(ω⁻¹X))
+  // - 3 * c₀ * a₁(ω²X) - (-f₀(ω⁻²X))
+  // - (a₀(X) + β)² * (i₀(X) + γ) + a₀(X) * a₀(X)
+  // clang-format on
+  std::vector<Expr> polys;
+  polys.push_back(ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Product(
+          ExpressionFactory<GF7>::Product(Fixed(0, 0), Advice(0, 0)),
+          Advice(1, 1)),
+      ExpressionFactory<GF7>::Product(
+          Fixed(1, 0), ExpressionFactory<GF7>::Sum(
+                           Advice(0, 0), ExpressionFactory<GF7>::Negated(
+                                             Instance(0, -1))))));
+  polys.push_back(ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Scaled(
+          ExpressionFactory<GF7>::Product(
+              ExpressionFactory<GF7>::Challenge(Challenge(0, Phase(0))),
+              Advice(1, 2)),
+          GF7(3)),
+      ExpressionFactory<GF7>::Negated(
+          ExpressionFactory<GF7>::Negated(Fixed(0, -2)))));
+
+  GraphEvaluator<GF7> evaluator;
+  std::vector<ValueSource> parts =
+      base::Map(polys, [&evaluator](const Expr& poly) {
+        return evaluator.AddExpression(poly.get());
+      });
+  ValueSource a0_plus_beta = evaluator.AddCalculation(Calculation::Add(
+      evaluator.AddExpression(Advice(0, 0).get()), ValueSource::Beta()));
+  ValueSource i0_plus_gamma = evaluator.AddCalculation(Calculation::Add(
+      evaluator.AddExpression(Instance(0, 0).get()), ValueSource::Gamma()));
+  ValueSource a0 = evaluator.AddExpression(Advice(0, 0).get());
+  parts.push_back(evaluator.AddCalculation(Calculation::Add(
+      evaluator.AddCalculation(Calculation::Mul(
+          evaluator.AddCalculation(Calculation::Square(a0_plus_beta)),
+          i0_plus_gamma)),
+      evaluator.AddCalculation(Calculation::Mul(a0, a0)))));
+  evaluator.AddCalculation(Calculation::Horner(ValueSource::PreviousValue(),
+                                               std::move(parts),
+                                               ValueSource::Y()));
+
+  CompiledGraphEvaluator<GF7> compiled(evaluator);
+  EXPECT_LT(compiled.num_registers(), compiled.num_instructions());
+
+  for (int32_t scale : {1, 2, 5}) {
+    TestEvaluate(evaluator, 0, kNumRows, scale);
+    // A range that doesn't start at the block boundary.
+    TestEvaluate(evaluator, 100, 400, scale);
+    TestEvaluate(evaluator, kNumRows - 3, kNumRows, scale);
+  }
+}
+
+TEST_F(CompiledGraphEvaluatorTest, Lookup) {
+  GraphEvaluator<GF7> evaluator;
+  std::vector<ValueSource> parts;
+  parts.push_back(evaluator.AddExpression(Advice(0, 0).get()));
+  parts.push_back(evaluator.AddExpression(Fixed(1, 1).get()));
+  ValueSource compressed = evaluator.AddCalculation(Calculation::Horner(
+      ValueSource::ZeroConstant(), std::move(parts), ValueSource::Theta()));
+  ValueSource left = evaluator.AddCalculation(
+      Calculation::Add(compressed, ValueSource::Beta()));
+  ValueSource right = evaluator.AddCalculation(Calculation::Double(
+      evaluator.AddCalculation(Calculation::Sub(compressed, left))));
+  evaluator.AddCalculation(Calculation::Mul(left, right));
+
+  TestEvaluate(evaluator, 0, kNumRows, 1);
+  TestEvaluate(evaluator, 250, 260, 3);
+}
+
+}  // namespace tachyon::zk
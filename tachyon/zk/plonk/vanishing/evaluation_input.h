@@ -12,7 +12,7 @@
 #include <utility>
 #include <vector>
 
-#include "tachyon/zk/plonk/base/owned_table.h"
+#include "tachyon/zk/plonk/base/ref_table.h"
 
 namespace tachyon::zk {
 
@@ -23,7 +23,7 @@ class EvaluationInput {
 
   EvaluationInput(std::vector<F>&& intermediates,
                   std::vector<int32_t>&& rotations,
-                  const OwnedTable<Evals>* table,
+                  const RefTable<Evals>* table,
                   absl::Span<const F> challenges, const F* beta, const F* gamma,
                   const F* theta, const F* y, int32_t n)
       : intermediates_(std::move(intermediates)),
@@ -40,7 +40,7 @@ class EvaluationInput {
   std::vector<F>& intermediates() { return intermediates_; }
   const std::vector<int32_t>& rotations() const { return rotations_; }
   std::vector<int32_t>& rotations() { return rotations_; }
-  const OwnedTable<Evals>& table() const { return *table_; }
+  const RefTable<Evals>& table() const { return *table_; }
   absl::Span<const F> challenges() const { return challenges_; }
   const F& beta() const { return *beta_; }
   const F& gamma() const { return *gamma_; }
@@ -52,7 +52,7 @@ class EvaluationInput {
   std::vector<F> intermediates_;
   std::vector<int32_t> rotations_;
   // not owned
-  const OwnedTable<Evals>* table_ = nullptr;
+  const RefTable<Evals>* table_ = nullptr;
   absl::Span<const F> challenges_;
   // not owned
   const F* beta_ = nullptr;
@@ -15,6 +15,7 @@
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_argument.h"
 #include "tachyon/zk/plonk/constraint_system/constraint_system.h"
 #include "tachyon/zk/plonk/vanishing/circuit_polynomial_builder.h"
 #include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
@@ -46,37 +47,24 @@ class VanishingArgument {
     evaluator.custom_gates_.AddCalculation(Calculation::Horner(
         ValueSource::PreviousValue(), std::move(parts), ValueSource::Y()));
 
-    for (const LookupArgument<F>& lookup : constraint_system.lookups()) {
-      GraphEvaluator<F> graph;
-
-      auto compress =
-          [&graph](
-              const std::vector<std::unique_ptr<Expression<F>>>& expressions) {
-            std::vector<ValueSource> parts = base::Map(
-                expressions,
-                [&graph](const std::unique_ptr<Expression<F>>& expression) {
-                  return graph.AddExpression(expression.get());
-                });
-            return graph.AddCalculation(
-                Calculation::Horner(ValueSource::ZeroConstant(),
-                                    std::move(parts), ValueSource::Theta()));
-          };
-
-      // A_compressed(X) = θᵐ⁻¹A₀(X) + θᵐ⁻²A₁(X) + ... + θAₘ₋₂(X) + Aₘ₋₁(X)
-      ValueSource compressed_input_coset = compress(lookup.input_expressions());
-      // S_compressed(X) = θᵐ⁻¹S₀(X) + θᵐ⁻²S₁(X) + ... + θSₘ₋₂(X) + Sₘ₋₁(X)
-      ValueSource compressed_table_coset = compress(lookup.table_expressions());
-
-      // S_compressed(X) + γ
-      ValueSource right = graph.AddCalculation(
-          Calculation::Add(compressed_table_coset, ValueSource::Gamma()));
-      // A_compressed(X) + β
-      ValueSource left = graph.AddCalculation(
-          Calculation::Add(compressed_input_coset, ValueSource::Beta()));
-      // (A_compressed(X) + β) * (S_compressed(X) + γ)
-      graph.AddCalculation(Calculation::Mul(left, right));
-
-      evaluator.lookups_.push_back(std::move(graph));
+    switch (constraint_system.lookup_type()) {
+      case LookupType::kHalo2:
+        for (const LookupArgument<F>& lookup : constraint_system.lookups()) {
+          evaluator.lookups_.push_back(CreateLookupGraph(lookup));
+        }
+        break;
+      case LookupType::kLogDerivative:
+        for (const LogDerivativeLookupArgument<F>& argument :
+             constraint_system.ComputeLogDerivativeLookups()) {
+          evaluator.log_derivative_lookups_.push_back(
+              CreateLogDerivativeLookupGraphs(argument));
+          evaluator.log_derivative_lookup_chunk_sizes_.push_back(base::Map(
+              argument.chunks(),
+              [](const typename LogDerivativeLookupArgument<F>::Chunk& chunk) {
+                return chunk.size();
+              }));
+        }
+        break;
     }
 
     return evaluator;
@@ -84,16 +72,26 @@ class VanishingArgument {
 
   const GraphEvaluator<F>& custom_gates() const { return custom_gates_; }
   const std::vector<GraphEvaluator<F>> lookups() const { return lookups_; }
+  const std::vector<std::vector<GraphEvaluator<F>>>& log_derivative_lookups()
+      const {
+    return log_derivative_lookups_;
+  }
+  const std::vector<std::vector<size_t>>& log_derivative_lookup_chunk_sizes()
+      const {
+    return log_derivative_lookup_chunk_sizes_;
+  }
 
-  template <typename PCS, typename Poly = typename PCS::Poly,
+  // |L| is either |LookupCommitted<Poly>| or
+  // |LogDerivativeLookupCommitted<Poly>| depending on the lookup type of the
+  // constraint system.
+  template <typename PCS, typename L, typename Poly = typename PCS::Poly,
             typename ExtendedEvals = typename PCS::ExtendedEvals>
   ExtendedEvals BuildExtendedCircuitColumn(
       ProverBase<PCS>* prover, const ProvingKey<PCS>& proving_key,
       const F& beta, const F& gamma, const F& theta, const F& y, const F& zeta,
       absl::Span<const F> challenges,
       const std::vector<PermutationCommitted<Poly>>& committed_permutations,
-      const std::vector<std::vector<LookupCommitted<Poly>>>&
-          committed_lookups_vec,
+      const std::vector<std::vector<L>>& committed_lookups_vec,
       const std::vector<RefTable<Poly>>& poly_tables) const {
     RowIndex blinding_factors = prover->blinder().blinding_factors();
     size_t cs_degree =
@@ -106,12 +104,72 @@ class VanishingArgument {
             challenges, &proving_key, &committed_permutations,
             &committed_lookups_vec, &poly_tables);
 
-    return builder.BuildExtendedCircuitColumn(custom_gates_, lookups_);
+    return builder.BuildExtendedCircuitColumn(
+        custom_gates_, lookups_, log_derivative_lookups_,
+        log_derivative_lookup_chunk_sizes_);
   }
 
  private:
+  // Returns θᵐ⁻¹E₀(X) + θᵐ⁻²E₁(X) + ... + θEₘ₋₂(X) + Eₘ₋₁(X) of |expressions|.
+  static ValueSource Compress(
+      GraphEvaluator<F>& graph,
+      const std::vector<std::unique_ptr<Expression<F>>>& expressions) {
+    std::vector<ValueSource> parts = base::Map(
+        expressions,
+        [&graph](const std::unique_ptr<Expression<F>>& expression) {
+          return graph.AddExpression(expression.get());
+        });
+    return graph.AddCalculation(Calculation::Horner(
+        ValueSource::ZeroConstant(), std::move(parts), ValueSource::Theta()));
+  }
+
+  static GraphEvaluator<F> CreateLookupGraph(const LookupArgument<F>& lookup) {
+    GraphEvaluator<F> graph;
+
+    // A_compressed(X) = θᵐ⁻¹A₀(X) + θᵐ⁻²A₁(X) + ... + θAₘ₋₂(X) + Aₘ₋₁(X)
+    ValueSource compressed_input_coset =
+        Compress(graph, lookup.input_expressions());
+    // S_compressed(X) = θᵐ⁻¹S₀(X) + θᵐ⁻²S₁(X) + ... + θSₘ₋₂(X) + Sₘ₋₁(X)
+    ValueSource compressed_table_coset =
+        Compress(graph, lookup.table_expressions());
+
+    // S_compressed(X) + γ
+    ValueSource right = graph.AddCalculation(
+        Calculation::Add(compressed_table_coset, ValueSource::Gamma()));
+    // A_compressed(X) + β
+    ValueSource left = graph.AddCalculation(
+        Calculation::Add(compressed_input_coset, ValueSource::Beta()));
+    // (A_compressed(X) + β) * (S_compressed(X) + γ)
+    graph.AddCalculation(Calculation::Mul(left, right));
+    return graph;
+  }
+
+  // Returns the graphs of fᵢ(X) + β for each input of the chunks of |argument|
+  // in order followed by the graph of t(X) + β.
+  static std::vector<GraphEvaluator<F>> CreateLogDerivativeLookupGraphs(
+      const LogDerivativeLookupArgument<F>& argument) {
+    auto create_graph =
+        [](const std::vector<std::unique_ptr<Expression<F>>>& expressions) {
+          GraphEvaluator<F> graph;
+          graph.AddCalculation(Calculation::Add(Compress(graph, expressions),
+                                                ValueSource::Beta()));
+          return graph;
+        };
+
+    std::vector<GraphEvaluator<F>> graphs = base::Map(
+        argument.lookups(), [&create_graph](const LookupArgument<F>* lookup) {
+          return create_graph(lookup->input_expressions());
+        });
+    graphs.push_back(create_graph(argument.table_expressions()));
+    return graphs;
+  }
+
   GraphEvaluator<F> custom_gates_;
   std::vector<GraphEvaluator<F>> lookups_;
+  std::vector<std::vector<GraphEvaluator<F>>> log_derivative_lookups_;
+  // |log_derivative_lookup_chunk_sizes_[i][k]| is the number of the inputs of
+  // the k-th chunk of the i-th |LogDerivativeLookupArgument|.
+  std::vector<std::vector<size_t>> log_derivative_lookup_chunk_sizes_;
 };
 
 }  // namespace tachyon::zk
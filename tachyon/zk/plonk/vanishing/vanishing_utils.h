@@ -12,7 +12,9 @@
 
 #include "absl/types/span.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/math/finite_fields/packed_prime_field.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 
@@ -83,17 +85,32 @@ ExtendedEvals& DivideByVanishingPolyInPlace(
   F::BatchInverseInPlace(t_evaluations);
 
   // Multiply the inverse to obtain the quotient polynomial in the coset
-  // evaluation domain.
+  // evaluation domain. If the CPU multiplies |PackedF| with SIMD instructions,
+  // |PackedF::kLanes| evaluations are multiplied at once.
+  using PackedF = math::PackedPrimeField<F>;
   std::vector<F>& evaluations = evals.evaluations();
-  base::Parallelize(evaluations,
-                    [&t_evaluations](absl::Span<F> chunk, size_t chunk_idx,
-                                     size_t chunk_size) {
-                      size_t index = chunk_idx * chunk_size;
-                      for (F& h : chunk) {
-                        h *= t_evaluations[index % t_evaluations.size()];
-                        ++index;
-                      }
-                    });
+  bool use_packed = PackedF::IsSimdMulSupported();
+  base::Parallelize(
+      evaluations,
+      [&t_evaluations, use_packed](absl::Span<F> chunk, size_t chunk_idx,
+                                   size_t chunk_size) {
+        size_t index = chunk_idx * chunk_size;
+        size_t i = 0;
+        if (use_packed) {
+          for (; i + PackedF::kLanes <= chunk.size(); i += PackedF::kLanes) {
+            PackedF t;
+            for (size_t j = 0; j < PackedF::kLanes; ++j) {
+              t[j] = t_evaluations[(index + i + j) % t_evaluations.size()];
+            }
+            PackedF h = PackedF::Load(&chunk[i]);
+            h *= t;
+            h.Store(&chunk[i]);
+          }
+        }
+        for (; i < chunk.size(); ++i) {
+          chunk[i] *= t_evaluations[(index + i) % t_evaluations.size()];
+        }
+      });
 
   return evals;
 }
@@ -177,15 +194,39 @@ Evals CoeffToExtendedPart(const Domain* domain, const Poly& poly, const F& zeta,
   return domain->FFT(cloned);
 }
 
+namespace internal {
+
+template <typename Poly>
+const Poly& GetPoly(const Poly& poly) {
+  return poly;
+}
+
+template <typename Poly>
+const Poly& GetPoly(const BlindedPolynomial<Poly>& poly) {
+  return poly.poly();
+}
+
+}  // namespace internal
+
+// Evaluates all of |polys| over the same part of the extended domain at once.
+// See |UnivariateEvaluationDomain::CosetFFTs()|.
+template <typename Domain, typename F, typename Evals = typename Domain::Evals>
+std::vector<Evals> CoeffsToExtendedPart(
+    const Domain* domain,
+    const std::vector<const typename Domain::DensePoly*>& polys, const F& zeta,
+    const F& extended_omega_factor) {
+  return domain->CosetFFTs(polys, zeta * extended_omega_factor);
+}
+
 template <typename Domain, typename Poly, typename F,
           typename Evals = typename Domain::Evals>
 std::vector<Evals> CoeffsToExtendedPart(const Domain* domain,
                                         absl::Span<Poly> polys, const F& zeta,
                                         const F& extended_omega_factor) {
-  return base::Map(
-      polys, [domain, &zeta, &extended_omega_factor](const Poly& poly) {
-        return CoeffToExtendedPart(domain, poly, zeta, extended_omega_factor);
-      });
+  std::vector<const typename Domain::DensePoly*> poly_ptrs =
+      base::Map(polys,
+                [](const Poly& poly) { return &internal::GetPoly(poly); });
+  return CoeffsToExtendedPart(domain, poly_ptrs, zeta, extended_omega_factor);
 }
 
 template <typename F>
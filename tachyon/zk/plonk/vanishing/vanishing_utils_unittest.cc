@@ -64,6 +64,25 @@ TEST_F(VanishingUtilsTest, CoeffToExtendedPart) {
   EXPECT_EQ(extended_part, domain->FFT(expected_poly));
 }
 
+TEST_F(VanishingUtilsTest, CoeffsToExtendedPart) {
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+
+  F zeta = GetHalo2Zeta<F>();
+  F extended_omega_factor = F::Random();
+  std::vector<Poly> polys =
+      base::CreateVector(5, [&domain]() { return domain->Random<Poly>(); });
+
+  std::vector<Evals> extended_parts = CoeffsToExtendedPart(
+      domain.get(), absl::MakeConstSpan(polys), zeta, extended_omega_factor);
+
+  ASSERT_EQ(extended_parts.size(), polys.size());
+  for (size_t i = 0; i < polys.size(); ++i) {
+    EXPECT_EQ(extended_parts[i], CoeffToExtendedPart(domain.get(), polys[i],
+                                                     zeta,
+                                                     extended_omega_factor));
+  }
+}
+
 TEST_F(VanishingUtilsTest, BuildExtendedColumnWithColumns) {
   base::Range<size_t> range = base::Range<size_t>::Until(4);
   std::vector<std::vector<F>> columns =
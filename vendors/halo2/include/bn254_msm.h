@@ -19,6 +19,11 @@ rust::Box<G1JacobianPoint> g1_point2_msm(G1MSM* msm,
                                          rust::Slice<const G1Point2> bases,
                                          rust::Slice<const Fr> scalars);
 
+void g1_msm_precompute_point2(G1MSM* msm, rust::Slice<const G1Point2> bases);
+
+rust::Box<G1JacobianPoint> g1_precomputed_msm(G1MSM* msm,
+                                              rust::Slice<const Fr> scalars);
+
 void create_proof(uint8_t degree);
 
 }  // namespace tachyon::halo2_api::bn254
@@ -17,6 +17,7 @@ class SHPlonkProvingKeyImpl;
 class SHPlonkProvingKey {
  public:
   explicit SHPlonkProvingKey(rust::Slice<const uint8_t> pk_bytes);
+  explicit SHPlonkProvingKey(std::shared_ptr<SHPlonkProvingKeyImpl> impl);
 
   const SHPlonkProvingKeyImpl* impl() const { return impl_.get(); }
 
@@ -29,6 +30,7 @@ class SHPlonkProvingKey {
   size_t num_instance_columns() const;
   rust::Vec<uint8_t> phases() const;
   rust::Box<Fr> transcript_repr(const SHPlonkProver& prover);
+  bool write_to_file(rust::Str path) const;
 
  private:
   std::shared_ptr<SHPlonkProvingKeyImpl> impl_;
@@ -37,6 +39,10 @@ class SHPlonkProvingKey {
 std::unique_ptr<SHPlonkProvingKey> new_proving_key(
     rust::Slice<const uint8_t> pk_bytes);
 
+// Returns nullptr if it fails to read a proving key file at |path|, which was
+// written by |SHPlonkProvingKey::write_to_file()|.
+std::unique_ptr<SHPlonkProvingKey> new_proving_key_from_file(rust::Str path);
+
 }  // namespace tachyon::halo2_api::bn254
 
 #endif  // VENDORS_HALO2_INCLUDE_BN254_SHPLONK_PROVING_KEY_H_
@@ -56,6 +56,8 @@ pub mod ffi {
             bases: &[G1Point2],
             scalars: &[Fr],
         ) -> Box<G1JacobianPoint>;
+        unsafe fn g1_msm_precompute_point2(msm: *mut G1MSM, bases: &[G1Point2]);
+        unsafe fn g1_precomputed_msm(msm: *mut G1MSM, scalars: &[Fr]) -> Box<G1JacobianPoint>;
         #[cfg(feature = "gpu")]
         fn create_g1_msm_gpu(degree: u8, algorithm: i32) -> Box<G1MSMGpu>;
         #[cfg(feature = "gpu")]
@@ -85,6 +87,7 @@ pub mod ffi {
         type SHPlonkProvingKey;
 
         fn new_proving_key(data: &[u8]) -> UniquePtr<SHPlonkProvingKey>;
+        fn new_proving_key_from_file(path: &str) -> UniquePtr<SHPlonkProvingKey>;
         fn advice_column_phases(&self) -> &[u8];
         fn blinding_factors(&self) -> u32;
         fn challenge_phases(&self) -> &[u8];
@@ -94,6 +97,7 @@ pub mod ffi {
         fn num_instance_columns(&self) -> usize;
         fn phases(&self) -> Vec<u8>;
         fn transcript_repr(self: Pin<&mut SHPlonkProvingKey>, prover: &SHPlonkProver) -> Box<Fr>;
+        fn write_to_file(&self, path: &str) -> bool;
     }
 
     unsafe extern "C++" {
@@ -256,6 +260,21 @@ impl SHPlonkProvingKey {
         }
     }
 
+    // Reads a proving key file written by |write_to_file()|. The field vectors
+    // are memory-mapped instead of being decoded element by element.
+    pub fn from_file(path: &str) -> Option<SHPlonkProvingKey> {
+        let inner = ffi::new_proving_key_from_file(path);
+        if inner.is_null() {
+            None
+        } else {
+            Some(SHPlonkProvingKey { inner })
+        }
+    }
+
+    pub fn write_to_file(&self, path: &str) -> bool {
+        self.inner.write_to_file(path)
+    }
+
     // NOTE(chokobole): We name this as plural since it contains multi phases.
     // pk.vk.cs.advice_column_phase
     pub fn advice_column_phases(&self) -> &[sealed::Phase] {
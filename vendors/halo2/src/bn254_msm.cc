@@ -27,4 +27,21 @@ rust::Box<G1JacobianPoint> g1_point2_msm(G1MSM* msm,
       reinterpret_cast<G1JacobianPoint*>(ret));
 }
 
+void g1_msm_precompute_point2(G1MSM* msm, rust::Slice<const G1Point2> bases) {
+  tachyon_bn254_g1_msm_precompute_point2(
+      reinterpret_cast<tachyon_bn254_g1_msm_ptr>(msm),
+      reinterpret_cast<const tachyon_bn254_g1_point2*>(bases.data()),
+      bases.length());
+}
+
+rust::Box<G1JacobianPoint> g1_precomputed_msm(G1MSM* msm,
+                                              rust::Slice<const Fr> scalars) {
+  auto ret = tachyon_bn254_g1_precomputed_msm(
+      reinterpret_cast<tachyon_bn254_g1_msm_ptr>(msm),
+      reinterpret_cast<const tachyon_bn254_fr*>(scalars.data()),
+      scalars.length());
+  return rust::Box<G1JacobianPoint>::from_raw(
+      reinterpret_cast<G1JacobianPoint*>(ret));
+}
+
 }  // namespace tachyon::halo2_api::bn254
@@ -1,5 +1,9 @@
 #include "vendors/halo2/include/bn254_shplonk_proving_key.h"
 
+#include <string>
+#include <utility>
+
+#include "tachyon/base/files/file_path.h"
 #include "tachyon/rs/base/container_util.h"
 #include "vendors/halo2/src/bn254.rs.h"
 #include "vendors/halo2/src/bn254_shplonk_proving_key_impl.h"
@@ -9,6 +13,10 @@ namespace tachyon::halo2_api::bn254 {
 SHPlonkProvingKey::SHPlonkProvingKey(rust::Slice<const uint8_t> pk_bytes)
     : impl_(new SHPlonkProvingKeyImpl(pk_bytes)) {}
 
+SHPlonkProvingKey::SHPlonkProvingKey(
+    std::shared_ptr<SHPlonkProvingKeyImpl> impl)
+    : impl_(std::move(impl)) {}
+
 rust::Slice<const uint8_t> SHPlonkProvingKey::advice_column_phases() const {
   return rs::ConvertCppContainerToRustSlice<uint8_t>(
       impl_->GetAdviceColumnPhases());
@@ -50,9 +58,21 @@ rust::Vec<uint8_t> SHPlonkProvingKey::phases() const {
       impl_->GetPhases(), [](zk::Phase phase) { return phase.value(); });
 }
 
+bool SHPlonkProvingKey::write_to_file(rust::Str path) const {
+  return impl_->WriteProvingKey(base::FilePath(static_cast<std::string>(path)));
+}
+
 std::unique_ptr<SHPlonkProvingKey> new_proving_key(
     rust::Slice<const uint8_t> pk_bytes) {
   return std::make_unique<SHPlonkProvingKey>(pk_bytes);
 }
 
+std::unique_ptr<SHPlonkProvingKey> new_proving_key_from_file(rust::Str path) {
+  std::shared_ptr<SHPlonkProvingKeyImpl> impl =
+      std::make_shared<SHPlonkProvingKeyImpl>();
+  if (!impl->ReadProvingKey(base::FilePath(static_cast<std::string>(path))))
+    return nullptr;
+  return std::make_unique<SHPlonkProvingKey>(std::move(impl));
+}
+
 }  // namespace tachyon::halo2_api::bn254
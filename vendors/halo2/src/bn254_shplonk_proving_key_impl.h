@@ -14,6 +14,7 @@ using PCS =
 
 class SHPlonkProvingKeyImpl : public ProvingKeyImpl<PCS> {
  public:
+  SHPlonkProvingKeyImpl() = default;
   explicit SHPlonkProvingKeyImpl(rust::Slice<const uint8_t> bytes)
       : ProvingKeyImpl<PCS>(bytes) {}
 };
@@ -81,6 +81,35 @@ mod test {
         }
     }
 
+    #[test]
+    fn test_precomputed_msm() {
+        let degree = 10;
+        let n = 1usize << degree;
+
+        let test_set = TestSet::create(n);
+
+        let expected = best_multiexp(&test_set.scalars, &test_set.bases);
+
+        unsafe {
+            let bases: Vec<CppG1Point2> = mem::transmute(test_set.bases);
+            let scalars: Vec<CppFr> = mem::transmute(test_set.scalars);
+
+            let mut msm = ffi::create_g1_msm(degree);
+
+            let mut timer = Timer::new();
+            ffi::g1_msm_precompute_point2(&mut *msm, &bases);
+            timer.end("msm_precompute");
+
+            timer.reset();
+            let actual = ffi::g1_precomputed_msm(&mut *msm, &scalars);
+            let actual: Box<G1> = mem::transmute(actual);
+            timer.end("precomputed_msm");
+            assert_eq!(*actual, expected);
+
+            ffi::destroy_g1_msm(msm);
+        }
+    }
+
     #[cfg(feature = "gpu")]
     #[test]
     fn test_msm_gpu() {
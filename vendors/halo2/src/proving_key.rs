@@ -51,5 +51,22 @@ mod test {
         );
         let phases = pk.vk.cs.phases().collect::<Vec<_>>();
         assert_eq!(phases, tachyon_pk.phases());
+
+        let path = std::env::temp_dir().join("tachyon_test_proving_key");
+        let path = path.to_str().unwrap();
+        assert!(tachyon_pk.write_to_file(path));
+        let mapped_pk = SHPlonkProvingKey::from_file(path).unwrap();
+        std::fs::remove_file(path).unwrap();
+        assert_eq!(
+            tachyon_pk.advice_column_phases(),
+            mapped_pk.advice_column_phases()
+        );
+        assert_eq!(tachyon_pk.blinding_factors(), mapped_pk.blinding_factors());
+        assert_eq!(tachyon_pk.constants(), mapped_pk.constants());
+        assert_eq!(
+            tachyon_pk.num_advice_columns(),
+            mapped_pk.num_advice_columns()
+        );
+        assert_eq!(tachyon_pk.phases(), mapped_pk.phases());
     }
 }
@@ -1,14 +1,21 @@
 #ifndef VENDORS_HALO2_SRC_SHPLONK_PROVING_KEY_IMPL_H_
 #define VENDORS_HALO2_SRC_SHPLONK_PROVING_KEY_IMPL_H_
 
+#include <string.h>
+
 #include <utility>
 #include <vector>
 
 #include "rust/cxx.h"
 
 #include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/zk/base/commitments/shplonk_extension.h"
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
+#include "tachyon/zk/plonk/keys/mapped_proving_key.h"
 #include "tachyon/zk/plonk/keys/proving_key.h"
 #include "vendors/halo2/include/proving_key_impl_forward.h"
 #include "vendors/halo2/src/buffer_reader.h"
@@ -27,9 +34,11 @@ class ProvingKeyImpl<
   using Evals = typename PCS::Evals;
   using Poly = typename PCS::Poly;
 
+  ProvingKeyImpl() = default;
+  // |bytes| is a proving key serialized by halo2.
   explicit ProvingKeyImpl(rust::Slice<const uint8_t> bytes) {
     base::Buffer buffer(const_cast<uint8_t*>(bytes.data()), bytes.size());
-    ReadProvingKey(buffer);
+    ReadHalo2ProvingKey(buffer);
   }
 
   const zk::ProvingKey<PCS>& key() const { return key_; }
@@ -75,9 +84,92 @@ class ProvingKeyImpl<
     return key_.verifying_key_.transcript_repr_;
   }
 
+  // The proving key file is laid out as follows:
+  //
+  // | Contents              | Size                                |
+  // |-----------------------|-------------------------------------|
+  // | size of verifying key | sizeof(uint64_t)                    |
+  // | verifying key         | the verifying key part of the halo2 |
+  // |                       | proving key                         |
+  // | padding               | up to |kAlignment|                  |
+  // | field vectors         | See |zk::WriteMappedProvingKey()|.  |
+  //
+  // Return true if it is able to read a proving key file at |path|, which was
+  // written by |WriteProvingKey()|. The field vectors are memory-mapped and
+  // validated by |zk::MappedProvingKey| instead of being decoded element by
+  // element.
+  [[nodiscard]] bool ReadProvingKey(const base::FilePath& path) {
+    base::MemoryMappedFile file;
+    if (!file.Initialize(path)) {
+      LOG(ERROR) << "Failed to map " << path.value();
+      return false;
+    }
+    absl::Span<const uint8_t> bytes = file.bytes();
+    uint64_t vk_size;
+    if (bytes.size() < sizeof(vk_size)) {
+      LOG(ERROR) << "Proving key file is too short";
+      return false;
+    }
+    memcpy(&vk_size, bytes.data(), sizeof(vk_size));
+    if (vk_size > bytes.size() - sizeof(vk_size)) {
+      LOG(ERROR) << "Proving key file is too short";
+      return false;
+    }
+    uint64_t mapped_offset =
+        zk::internal::AlignMappedOffset(sizeof(vk_size) + vk_size);
+    if (mapped_offset > bytes.size()) {
+      LOG(ERROR) << "Proving key file is too short";
+      return false;
+    }
+
+    absl::Span<const uint8_t> vk_bytes =
+        bytes.subspan(sizeof(vk_size), vk_size);
+    base::Buffer buffer(const_cast<uint8_t*>(vk_bytes.data()),
+                        vk_bytes.size());
+    zk::VerifyingKey<PCS> vkey;
+    size_t k = ReadVerifyingKey(buffer, vkey);
+    if (!buffer.Done()) {
+      LOG(ERROR) << "Verifying key has trailing bytes";
+      return false;
+    }
+
+    zk::MappedProvingKey<F> mapped;
+    if (!mapped.Parse(bytes.subspan(mapped_offset))) return false;
+    // NOTE(chokobole): The verifying key and the vectors are read from the same
+    // file, and the transcript repr of the verifying key is computed later by
+    // |GetTranscriptRepr()|, so the one that was written with the vectors is
+    // taken as is.
+    vkey.transcript_repr_ = mapped.transcript_repr();
+    if (!key_.LoadFromMapped(size_t{1} << k, std::move(vkey), mapped))
+      return false;
+    vk_bytes_ = std::vector<uint8_t>(vk_bytes.begin(), vk_bytes.end());
+    return true;
+  }
+
+  // Writes the proving key into a file at |path| so that it can be read back
+  // by |ReadProvingKey()|.
+  [[nodiscard]] bool WriteProvingKey(const base::FilePath& path) const {
+    base::Uint8VectorBuffer buffer;
+    uint64_t vk_size = vk_bytes_.size();
+    if (!buffer.Write(reinterpret_cast<const uint8_t*>(&vk_size),
+                      sizeof(vk_size)))
+      return false;
+    if (!buffer.Write(vk_bytes_.data(), vk_bytes_.size())) return false;
+    std::vector<uint8_t> padding(
+        zk::internal::AlignMappedOffset(buffer.buffer_offset()) -
+            buffer.buffer_offset(),
+        0);
+    if (!buffer.Write(padding.data(), padding.size())) return false;
+    if (!zk::WriteMappedProvingKey(key_, &buffer)) return false;
+    return base::WriteFile(path, buffer.owned_buffer());
+  }
+
  private:
-  void ReadProvingKey(base::Buffer& buffer) {
+  void ReadHalo2ProvingKey(base::Buffer& buffer) {
     ReadVerifyingKey(buffer, key_.verifying_key_);
+    const uint8_t* vk_data = reinterpret_cast<const uint8_t*>(buffer.buffer());
+    vk_bytes_ =
+        std::vector<uint8_t>(vk_data, vk_data + buffer.buffer_offset());
     ReadBuffer(buffer, key_.l_first_);
     ReadBuffer(buffer, key_.l_last_);
     ReadBuffer(buffer, key_.l_active_row_);
@@ -89,10 +181,10 @@ class ProvingKeyImpl<
     CHECK(buffer.Done());
   }
 
-  static void ReadVerifyingKey(base::Buffer& buffer,
-                               zk::VerifyingKey<PCS>& vkey) {
-    // NOTE(chokobole): For k
-    ReadU32AsSizeT(buffer);
+  // Returns k, where 2ᵏ is the size of the domain.
+  static size_t ReadVerifyingKey(base::Buffer& buffer,
+                                 zk::VerifyingKey<PCS>& vkey) {
+    size_t k = ReadU32AsSizeT(buffer);
     ReadBuffer(buffer, vkey.fixed_commitments_);
     ReadConstraintSystem(buffer, vkey.constraint_system_);
     size_t num_commitments =
@@ -104,6 +196,7 @@ class ProvingKeyImpl<
     }
     vkey.permutation_verifying_key_ =
         zk::PermutationVerifyingKey<Commitment>(std::move(commitments));
+    return k;
   }
 
   static void ReadConstraintSystem(base::Buffer& buffer,
@@ -129,6 +222,9 @@ class ProvingKeyImpl<
   }
 
   zk::ProvingKey<PCS> key_;
+  // The verifying key part of the halo2 proving key. This is kept to write
+  // the proving key file.
+  std::vector<uint8_t> vk_bytes_;
 };
 
 }  // namespace tachyon::halo2_api